@@ -20,6 +20,7 @@
 #include "ecma-conversion.h"
 #include "ecma-errors.h"
 #include "ecma-exceptions.h"
+#include "ecma-extended-info.h"
 #include "ecma-function-object.h"
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
@@ -90,6 +91,7 @@ typedef struct
   ecma_value_t snapshot_error;
   bool regex_found;
   bool class_found;
+  bool optimize_size;
 } snapshot_globals_t;
 
 /**
@@ -129,6 +131,686 @@ snapshot_write_to_buffer_by_offset (uint8_t *buffer_p, /**< buffer */
 #define JERRY_SNAPSHOT_MAXIMUM_WRITE_OFFSET (UINT32_MAX >> 1)
 #endif /* !JERRY_NUMBER_TYPE_FLOAT64 */
 
+/**
+ * Instruction decoded by the snapshot size optimizer.
+ */
+typedef struct
+{
+  uint8_t flags; /**< cbc flags of the opcode */
+  uint8_t opcode_length; /**< length of the opcode (including the CBC_EXT_OPCODE prefix) */
+  uint8_t literal_count; /**< number of literal arguments */
+  uint8_t branch_length; /**< length of the branch offset (0, if the instruction has no branch argument) */
+  uint8_t byte_arg; /**< byte argument */
+  uint16_t literals[3]; /**< literal arguments */
+  uint32_t branch_offset; /**< branch offset */
+} snapshot_decoded_instruction_t;
+
+/**
+ * Instruction layout computed by the snapshot size optimizer.
+ */
+typedef struct
+{
+  uint32_t offset; /**< offset of the instruction in the original byte code */
+  uint32_t new_offset; /**< offset of the instruction in the optimized byte code */
+  uint32_t target; /**< index of the branch target instruction */
+  uint8_t size; /**< size of the optimized instruction without the branch offset */
+  uint8_t branch_length; /**< length of the optimized branch offset (0, if the instruction has no branch argument) */
+} snapshot_instruction_t;
+
+/**
+ * Decode an instruction of a byte code stream.
+ *
+ * @return position after the instruction
+ */
+static const uint8_t *
+snapshot_decode_instruction (const uint8_t *byte_code_p, /**< start of the instruction */
+                             uint16_t encoding_limit, /**< literal encoding limit */
+                             uint16_t encoding_delta, /**< literal encoding delta */
+                             snapshot_decoded_instruction_t *instruction_p) /**< [out] decoded instruction */
+{
+  uint8_t opcode = *byte_code_p++;
+
+  instruction_p->opcode_length = 1;
+
+  if (opcode == CBC_EXT_OPCODE)
+  {
+    opcode = *byte_code_p++;
+    instruction_p->flags = cbc_ext_flags[opcode];
+    instruction_p->opcode_length = 2;
+  }
+  else
+  {
+    instruction_p->flags = cbc_flags[opcode];
+  }
+
+  uint8_t flags = instruction_p->flags;
+
+  instruction_p->literal_count = 0;
+
+  if (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
+  {
+    instruction_p->literal_count = 1;
+
+    if (flags & CBC_HAS_LITERAL_ARG2)
+    {
+      instruction_p->literal_count = (flags & CBC_HAS_LITERAL_ARG) ? 2 : 3;
+    }
+  }
+
+  for (uint8_t i = 0; i < instruction_p->literal_count; i++)
+  {
+    uint16_t literal_index = *byte_code_p++;
+
+    if (literal_index >= encoding_limit)
+    {
+      literal_index = (uint16_t) (((literal_index << 8) | *byte_code_p++) - encoding_delta);
+    }
+
+    instruction_p->literals[i] = literal_index;
+  }
+
+  instruction_p->byte_arg = 0;
+
+  if (flags & CBC_HAS_BYTE_ARG)
+  {
+    instruction_p->byte_arg = *byte_code_p++;
+  }
+
+  instruction_p->branch_length = 0;
+  instruction_p->branch_offset = 0;
+
+  if (flags & CBC_HAS_BRANCH_ARG)
+  {
+    instruction_p->branch_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
+    JERRY_ASSERT (instruction_p->branch_length >= 1 && instruction_p->branch_length <= 3);
+
+    for (uint8_t i = 0; i < instruction_p->branch_length; i++)
+    {
+      instruction_p->branch_offset = (instruction_p->branch_offset << 8) | *byte_code_p++;
+    }
+  }
+
+  return byte_code_p;
+} /* snapshot_decode_instruction */
+
+/**
+ * Checks whether the byte code stream continues at the given position. The byte code
+ * is followed by zero padding, and the CBC_EXT_NOP instruction is never emitted.
+ *
+ * @return true - if an instruction starts at the position, false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+snapshot_has_instruction (const uint8_t *byte_code_p, /**< current position */
+                          const uint8_t *byte_code_end_p) /**< end of the byte code area */
+{
+  return (byte_code_p < byte_code_end_p
+          && (*byte_code_p != CBC_EXT_OPCODE || (byte_code_p + 1 < byte_code_end_p && byte_code_p[1] != CBC_EXT_NOP)));
+} /* snapshot_has_instruction */
+
+/**
+ * Select the literals of a literal group which are stored at the one byte encodable indices.
+ *
+ * The most frequently used literals are selected, and both the selected and the remaining
+ * literals keep their original relative order.
+ */
+static void
+snapshot_reorder_literal_group (uint32_t *usage_p, /**< [in] usage counters of the literals,
+                                                    *   [out] new index of the literals relative to the group */
+                                uint32_t group_size, /**< number of literals in the group */
+                                uint32_t one_byte_count) /**< number of one byte encodable indices in the group */
+{
+  JERRY_ASSERT (one_byte_count < group_size);
+
+  uint32_t min_usage = 0;
+  uint32_t max_usage = 0;
+
+  for (uint32_t i = 0; i < group_size; i++)
+  {
+    if (usage_p[i] > max_usage)
+    {
+      max_usage = usage_p[i];
+    }
+  }
+
+  /* Find the largest usage limit which has at least one_byte_count literals above or at it. */
+  while (min_usage < max_usage)
+  {
+    uint32_t limit = min_usage + (max_usage - min_usage + 1) / 2;
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < group_size; i++)
+    {
+      if (usage_p[i] >= limit)
+      {
+        count++;
+      }
+    }
+
+    if (count >= one_byte_count)
+    {
+      min_usage = limit;
+    }
+    else
+    {
+      max_usage = limit - 1;
+    }
+  }
+
+  uint32_t above_count = 0;
+
+  for (uint32_t i = 0; i < group_size; i++)
+  {
+    if (usage_p[i] > min_usage)
+    {
+      above_count++;
+    }
+  }
+
+  uint32_t equal_count = one_byte_count - above_count;
+  uint32_t one_byte_index = 0;
+  uint32_t two_byte_index = one_byte_count;
+
+  for (uint32_t i = 0; i < group_size; i++)
+  {
+    bool is_selected = usage_p[i] > min_usage;
+
+    if (usage_p[i] == min_usage && equal_count > 0)
+    {
+      is_selected = true;
+      equal_count--;
+    }
+
+    usage_p[i] = is_selected ? one_byte_index++ : two_byte_index++;
+  }
+
+  JERRY_ASSERT (one_byte_index == one_byte_count && two_byte_index == group_size);
+} /* snapshot_reorder_literal_group */
+
+/**
+ * Rewrite the byte code of a compiled code copied into the snapshot buffer with
+ * shorter literal index and branch offset encodings.
+ *
+ * Note:
+ *      the literals of the group which contains the last one byte encodable literal index
+ *      are reordered by usage, and the branch offsets are recomputed from the final instruction
+ *      layout, since the parser chooses them before the literal indices are encoded
+ *
+ * @return size of the compiled code after the optimization
+ */
+static size_t
+snapshot_optimize_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled code in the snapshot buffer */
+{
+  uint8_t *byte_p = (uint8_t *) compiled_code_p;
+  size_t code_size = ((size_t) compiled_code_p->size) << JMEM_ALIGNMENT_LOG;
+  size_t header_size;
+  uint32_t register_end;
+  uint32_t ident_end;
+  uint32_t const_literal_end;
+  uint32_t literal_end;
+
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) byte_p;
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+    header_size = sizeof (cbc_uint16_arguments_t);
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) byte_p;
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+    header_size = sizeof (cbc_uint8_arguments_t);
+  }
+
+  uint16_t encoding_limit = CBC_SMALL_LITERAL_ENCODING_LIMIT;
+  uint16_t encoding_delta = CBC_SMALL_LITERAL_ENCODING_DELTA;
+
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING)
+  {
+    encoding_limit = CBC_FULL_LITERAL_ENCODING_LIMIT;
+    encoding_delta = CBC_FULL_LITERAL_ENCODING_DELTA;
+  }
+
+  ecma_value_t *literal_start_p = (ecma_value_t *) (byte_p + header_size) - register_end;
+  uint8_t *byte_code_start_p = (uint8_t *) (literal_start_p + literal_end);
+
+  /* The values and the extended info stored after the byte code are moved without changes. */
+  uint8_t *tail_p = (uint8_t *) ecma_snapshot_resolve_serializable_values (compiled_code_p, byte_p + code_size);
+
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_HAS_TAGGED_LITERALS)
+  {
+    tail_p -= sizeof (ecma_value_t);
+  }
+
+#if JERRY_LINE_INFO
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_HAS_LINE_INFO)
+  {
+    tail_p -= sizeof (ecma_value_t);
+  }
+#endif /* JERRY_LINE_INFO */
+
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_HAS_EXTENDED_INFO)
+  {
+    uint8_t *extended_info_p = tail_p - 1;
+    uint8_t extended_info = *extended_info_p;
+
+    if (extended_info & CBC_EXTENDED_CODE_FLAGS_HAS_ARGUMENT_LENGTH)
+    {
+      ecma_extended_info_decode_vlq (&extended_info_p);
+    }
+
+    if (extended_info & CBC_EXTENDED_CODE_FLAGS_HAS_SOURCE_CODE_RANGE)
+    {
+      ecma_extended_info_decode_vlq (&extended_info_p);
+      ecma_extended_info_decode_vlq (&extended_info_p);
+    }
+
+    tail_p = extended_info_p;
+  }
+
+  size_t tail_size = (size_t) (byte_p + code_size - tail_p);
+
+  /* Only the literals of the group which contains the last one byte encodable index are reordered. */
+  uint32_t group_start = register_end;
+  uint32_t group_end = ident_end;
+
+  if (group_end <= encoding_limit)
+  {
+    group_start = ident_end;
+    group_end = const_literal_end;
+  }
+
+  if (group_end <= encoding_limit)
+  {
+    group_start = const_literal_end;
+    group_end = literal_end;
+  }
+
+  uint32_t *literal_map_p = NULL;
+  uint32_t group_size = group_end - group_start;
+
+  if (group_start < encoding_limit && group_end > encoding_limit)
+  {
+    literal_map_p = (uint32_t *) jmem_heap_alloc_block_null_on_error (group_size * sizeof (uint32_t));
+
+    if (literal_map_p == NULL)
+    {
+      return code_size;
+    }
+
+    memset (literal_map_p, 0, group_size * sizeof (uint32_t));
+  }
+
+  snapshot_decoded_instruction_t instruction;
+  const uint8_t *byte_code_p = byte_code_start_p;
+  uint32_t instruction_count = 0;
+
+  while (snapshot_has_instruction (byte_code_p, tail_p))
+  {
+    byte_code_p = snapshot_decode_instruction (byte_code_p, encoding_limit, encoding_delta, &instruction);
+    instruction_count++;
+
+    if (literal_map_p != NULL)
+    {
+      for (uint8_t i = 0; i < instruction.literal_count; i++)
+      {
+        if (instruction.literals[i] >= group_start && instruction.literals[i] < group_end)
+        {
+          literal_map_p[instruction.literals[i] - group_start]++;
+        }
+      }
+    }
+  }
+
+  uint32_t byte_code_size = (uint32_t) (byte_code_p - byte_code_start_p);
+
+  if (literal_map_p != NULL)
+  {
+    snapshot_reorder_literal_group (literal_map_p, group_size, encoding_limit - group_start);
+  }
+
+  size_t instructions_size = (instruction_count + 1) * sizeof (snapshot_instruction_t);
+  snapshot_instruction_t *instructions_p =
+    (snapshot_instruction_t *) jmem_heap_alloc_block_null_on_error (instructions_size);
+
+  if (instructions_p == NULL)
+  {
+    if (literal_map_p != NULL)
+    {
+      jmem_heap_free_block (literal_map_p, group_size * sizeof (uint32_t));
+    }
+    return code_size;
+  }
+
+  /* The extra instruction represents the end of the byte code. */
+  instructions_p[instruction_count].offset = byte_code_size;
+  instructions_p[instruction_count].branch_length = 0;
+
+  byte_code_p = byte_code_start_p;
+
+  for (uint32_t i = 0; i < instruction_count; i++)
+  {
+    snapshot_instruction_t *current_p = instructions_p + i;
+
+    current_p->offset = (uint32_t) (byte_code_p - byte_code_start_p);
+    byte_code_p = snapshot_decode_instruction (byte_code_p, encoding_limit, encoding_delta, &instruction);
+
+    uint32_t size = instruction.opcode_length;
+
+    for (uint8_t j = 0; j < instruction.literal_count; j++)
+    {
+      uint32_t literal_index = instruction.literals[j];
+
+      if (literal_map_p != NULL && literal_index >= group_start && literal_index < group_end)
+      {
+        literal_index = group_start + literal_map_p[literal_index - group_start];
+      }
+
+      size += (literal_index < encoding_limit) ? 1 : 2;
+    }
+
+    if (instruction.flags & CBC_HAS_BYTE_ARG)
+    {
+      size++;
+    }
+
+    current_p->size = (uint8_t) size;
+    current_p->branch_length = (instruction.branch_length > 0) ? 1 : 0;
+
+    if (CBC_BRANCH_IS_FORWARD (instruction.flags))
+    {
+      current_p->target = current_p->offset + instruction.branch_offset;
+    }
+    else
+    {
+      current_p->target = current_p->offset - instruction.branch_offset;
+    }
+  }
+
+  bool is_valid = true;
+
+  /* Replace the branch target offsets with instruction indices. */
+  for (uint32_t i = 0; i < instruction_count && is_valid; i++)
+  {
+    if (instructions_p[i].branch_length == 0)
+    {
+      continue;
+    }
+
+    uint32_t target = instructions_p[i].target;
+    uint32_t low = 0;
+    uint32_t high = instruction_count;
+
+    while (low < high)
+    {
+      uint32_t middle = (low + high) / 2;
+
+      if (instructions_p[middle].offset < target)
+      {
+        low = middle + 1;
+      }
+      else
+      {
+        high = middle;
+      }
+    }
+
+    is_valid = (instructions_p[low].offset == target);
+    instructions_p[i].target = low;
+  }
+
+  /* Branch relaxation: the branch offsets start from their shortest form, and
+   * only grow until each branch can reach its target. */
+  uint32_t new_byte_code_size = 0;
+  bool is_changed = is_valid;
+
+  while (is_changed)
+  {
+    is_changed = false;
+    new_byte_code_size = 0;
+
+    for (uint32_t i = 0; i < instruction_count; i++)
+    {
+      instructions_p[i].new_offset = new_byte_code_size;
+      new_byte_code_size += (uint32_t) (instructions_p[i].size + instructions_p[i].branch_length);
+    }
+
+    instructions_p[instruction_count].new_offset = new_byte_code_size;
+
+    for (uint32_t i = 0; i < instruction_count; i++)
+    {
+      snapshot_instruction_t *current_p = instructions_p + i;
+
+      if (current_p->branch_length == 0)
+      {
+        continue;
+      }
+
+      uint32_t target_offset = instructions_p[current_p->target].new_offset;
+      uint32_t distance = (target_offset >= current_p->new_offset) ? (target_offset - current_p->new_offset)
+                                                                   : (current_p->new_offset - target_offset);
+      uint8_t branch_length = (distance <= UINT8_MAX) ? 1 : ((distance <= UINT16_MAX) ? 2 : 3);
+
+      if (branch_length > current_p->branch_length)
+      {
+        current_p->branch_length = branch_length;
+        is_changed = true;
+      }
+    }
+  }
+
+  size_t new_code_size = header_size + (literal_end - register_end) * sizeof (ecma_value_t);
+  new_code_size = JERRY_ALIGNUP (new_code_size + new_byte_code_size + tail_size, JMEM_ALIGNMENT);
+
+  uint8_t *new_byte_code_p = NULL;
+
+  if (is_valid && new_code_size < code_size)
+  {
+    new_byte_code_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (new_byte_code_size);
+  }
+
+  if (new_byte_code_p == NULL)
+  {
+    jmem_heap_free_block (instructions_p, instructions_size);
+
+    if (literal_map_p != NULL)
+    {
+      jmem_heap_free_block (literal_map_p, group_size * sizeof (uint32_t));
+    }
+    return code_size;
+  }
+
+  uint8_t *dst_p = new_byte_code_p;
+
+  for (uint32_t i = 0; i < instruction_count; i++)
+  {
+    snapshot_instruction_t *current_p = instructions_p + i;
+    const uint8_t *src_p = byte_code_start_p + current_p->offset;
+
+    snapshot_decode_instruction (src_p, encoding_limit, encoding_delta, &instruction);
+
+    memcpy (dst_p, src_p, instruction.opcode_length);
+    dst_p += instruction.opcode_length;
+
+    if (instruction.branch_length > 0)
+    {
+      /* The lowest two bits of branch opcodes specify the length of the branch offset. */
+      dst_p[-1] = (uint8_t) (dst_p[-1] - instruction.branch_length + current_p->branch_length);
+    }
+
+    for (uint8_t j = 0; j < instruction.literal_count; j++)
+    {
+      uint32_t literal_index = instruction.literals[j];
+
+      if (literal_map_p != NULL && literal_index >= group_start && literal_index < group_end)
+      {
+        literal_index = group_start + literal_map_p[literal_index - group_start];
+      }
+
+      if (literal_index < encoding_limit)
+      {
+        *dst_p++ = (uint8_t) literal_index;
+      }
+      else
+      {
+        uint16_t encoded_index = (uint16_t) (literal_index + encoding_delta);
+        *dst_p++ = (uint8_t) (encoded_index >> 8);
+        *dst_p++ = (uint8_t) (encoded_index & 0xff);
+      }
+    }
+
+    if (instruction.flags & CBC_HAS_BYTE_ARG)
+    {
+      *dst_p++ = instruction.byte_arg;
+    }
+
+    if (current_p->branch_length > 0)
+    {
+      uint32_t target_offset = instructions_p[current_p->target].new_offset;
+      uint32_t distance = (target_offset >= current_p->new_offset) ? (target_offset - current_p->new_offset)
+                                                                   : (current_p->new_offset - target_offset);
+
+      for (uint8_t j = current_p->branch_length; j > 0; j--)
+      {
+        *dst_p++ = (uint8_t) (distance >> ((j - 1) * 8));
+      }
+    }
+
+    JERRY_ASSERT (dst_p == new_byte_code_p + current_p->new_offset + current_p->size + current_p->branch_length);
+  }
+
+  JERRY_ASSERT (dst_p == new_byte_code_p + new_byte_code_size);
+
+  if (literal_map_p != NULL)
+  {
+    /* The usage counters are not needed anymore, so the literals are reordered in place
+     * by following the cycles of the permutation. */
+    for (uint32_t i = 0; i < group_size; i++)
+    {
+      while (literal_map_p[i] != i)
+      {
+        uint32_t new_index = literal_map_p[i];
+        ecma_value_t literal = literal_start_p[group_start + new_index];
+
+        literal_start_p[group_start + new_index] = literal_start_p[group_start + i];
+        literal_start_p[group_start + i] = literal;
+
+        literal_map_p[i] = literal_map_p[new_index];
+        literal_map_p[new_index] = new_index;
+      }
+    }
+
+    jmem_heap_free_block (literal_map_p, group_size * sizeof (uint32_t));
+  }
+
+  memcpy (byte_code_start_p, new_byte_code_p, new_byte_code_size);
+  memmove (byte_p + new_code_size - tail_size, tail_p, tail_size);
+  memset (byte_code_start_p + new_byte_code_size,
+          0,
+          (size_t) (byte_p + new_code_size - tail_size - (byte_code_start_p + new_byte_code_size)));
+
+  compiled_code_p->size = (uint16_t) (new_code_size >> JMEM_ALIGNMENT_LOG);
+
+  jmem_heap_free_block (new_byte_code_p, new_byte_code_size);
+  jmem_heap_free_block (instructions_p, instructions_size);
+  return new_code_size;
+} /* snapshot_optimize_compiled_code */
+
+/**
+ * Search a compiled code stored earlier in the snapshot buffer which is identical
+ * to the last stored compiled code, so the two can be shared.
+ *
+ * Note:
+ *      the reference counter of the function compiled codes is reset by jerry_snapshot_set_offsets,
+ *      until then it is zero while the function literals of the compiled code are not stored
+ *
+ * @return start offset of the identical compiled code - if found, 0 - otherwise
+ */
+static uint32_t
+snapshot_find_identical_compiled_code (const uint8_t *snapshot_buffer_p, /**< snapshot buffer */
+                                       size_t code_offset) /**< offset of the last compiled code */
+{
+  const ecma_compiled_code_t *compiled_code_p = (const ecma_compiled_code_t *) (snapshot_buffer_p + code_offset);
+  size_t code_size = ((size_t) compiled_code_p->size) << JMEM_ALIGNMENT_LOG;
+  size_t literal_start = 0;
+  size_t const_literal_end = 0;
+  size_t literal_end = 0;
+
+  if (CBC_IS_FUNCTION (compiled_code_p->status_flags))
+  {
+    if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+    {
+      cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) compiled_code_p;
+      literal_start = sizeof (cbc_uint16_arguments_t);
+      const_literal_end = (size_t) (args_p->const_literal_end - args_p->register_end);
+      literal_end = (size_t) (args_p->literal_end - args_p->register_end);
+    }
+    else
+    {
+      cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) compiled_code_p;
+      literal_start = sizeof (cbc_uint8_arguments_t);
+      const_literal_end = (size_t) (args_p->const_literal_end - args_p->register_end);
+      literal_end = (size_t) (args_p->literal_end - args_p->register_end);
+    }
+  }
+
+  size_t function_start = literal_start + const_literal_end * sizeof (ecma_value_t);
+  size_t function_end = literal_start + literal_end * sizeof (ecma_value_t);
+  size_t offset = JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t), JMEM_ALIGNMENT);
+
+  while (offset < code_offset)
+  {
+    const uint8_t *candidate_p = snapshot_buffer_p + offset;
+    const ecma_compiled_code_t *candidate_code_p = (const ecma_compiled_code_t *) candidate_p;
+    size_t candidate_size = ((size_t) candidate_code_p->size) << JMEM_ALIGNMENT_LOG;
+
+    if (candidate_size == code_size && candidate_code_p->refs == compiled_code_p->refs
+        && candidate_code_p->status_flags == compiled_code_p->status_flags)
+    {
+      const uint8_t *code_p = (const uint8_t *) compiled_code_p;
+      bool is_identical = (literal_start == 0
+                           || memcmp (candidate_p + sizeof (ecma_compiled_code_t),
+                                      code_p + sizeof (ecma_compiled_code_t),
+                                      function_start - sizeof (ecma_compiled_code_t))
+                                == 0);
+
+      /* Function literals are stored as relative offsets (zero represents a self reference). */
+      const ecma_value_t *candidate_literal_p = (const ecma_value_t *) (candidate_p + function_start);
+      const ecma_value_t *literal_p = (const ecma_value_t *) (code_p + function_start);
+
+      for (size_t i = 0; is_identical && i < literal_end - const_literal_end; i++)
+      {
+        if (candidate_literal_p[i] == 0 || literal_p[i] == 0)
+        {
+          is_identical = (candidate_literal_p[i] == literal_p[i]);
+        }
+        else
+        {
+          is_identical = (offset + (size_t) (int32_t) candidate_literal_p[i]
+                          == code_offset + (size_t) (int32_t) literal_p[i]);
+        }
+      }
+
+      size_t compared_start = (literal_start == 0) ? sizeof (ecma_compiled_code_t) : function_end;
+
+      if (is_identical
+          && memcmp (candidate_p + compared_start, code_p + compared_start, code_size - compared_start) == 0)
+      {
+        return (uint32_t) (offset - sizeof (jerry_snapshot_header_t));
+      }
+    }
+
+    offset += candidate_size;
+  }
+
+  return 0;
+} /* snapshot_find_identical_compiled_code */
+
 /**
  * Save snapshot helper.
  *
@@ -159,7 +841,8 @@ snapshot_add_compiled_code (const ecma_compiled_code_t *compiled_code_p, /**< co
    * so the base always starts right after the snapshot header. */
   uint32_t start_offset = (uint32_t) (globals_p->snapshot_buffer_write_offset - sizeof (jerry_snapshot_header_t));
 
-  uint8_t *copied_code_start_p = snapshot_buffer_p + globals_p->snapshot_buffer_write_offset;
+  size_t code_offset = globals_p->snapshot_buffer_write_offset;
+  uint8_t *copied_code_start_p = snapshot_buffer_p + code_offset;
   ecma_compiled_code_t *copied_code_p = (ecma_compiled_code_t *) copied_code_start_p;
 
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_HAS_TAGGED_LITERALS)
@@ -215,14 +898,50 @@ snapshot_add_compiled_code (const ecma_compiled_code_t *compiled_code_p, /**< co
     globals_p->regex_found = true;
     globals_p->snapshot_buffer_write_offset = JERRY_ALIGNUP (globals_p->snapshot_buffer_write_offset, JMEM_ALIGNMENT);
 
+    /* The compiled byte code is stored after the pattern, so the pattern does not need to be recompiled. */
+    size_t re_bytecode_offset = globals_p->snapshot_buffer_write_offset;
+    size_t re_bytecode_size = ((size_t) compiled_code_p->size) << JMEM_ALIGNMENT_LOG;
+
+    if (!snapshot_write_to_buffer_by_offset (snapshot_buffer_p,
+                                             snapshot_buffer_size,
+                                             &globals_p->snapshot_buffer_write_offset,
+                                             compiled_code_p,
+                                             re_bytecode_size))
+    {
+      globals_p->snapshot_error = jerry_throw_sz (JERRY_ERROR_RANGE, error_buffer_too_small_p);
+      return 0;
+    }
+
+    re_compiled_code_t *copied_re_bytecode_p = (re_compiled_code_t *) (snapshot_buffer_p + re_bytecode_offset);
+    copied_re_bytecode_p->header.refs = 1;
+    copied_re_bytecode_p->source = ECMA_VALUE_EMPTY;
+
     /* Regexp character size is stored in refs. */
     copied_code_p->refs = (uint16_t) pattern_size;
 
-    pattern_size += (lit_utf8_size_t) sizeof (ecma_compiled_code_t);
-    copied_code_p->size = (uint16_t) ((pattern_size + JMEM_ALIGNMENT - 1) >> JMEM_ALIGNMENT_LOG);
+    size_t total_size = globals_p->snapshot_buffer_write_offset - (size_t) (copied_code_start_p - snapshot_buffer_p);
 
+    if (total_size > (((size_t) UINT16_MAX) << JMEM_ALIGNMENT_LOG))
+    {
+      globals_p->snapshot_error =
+        jerry_throw_sz (JERRY_ERROR_RANGE, ecma_get_error_msg (ECMA_ERR_MAXIMUM_SNAPSHOT_SIZE));
+      return 0;
+    }
+
+    copied_code_p->size = (uint16_t) (total_size >> JMEM_ALIGNMENT_LOG);
     copied_code_p->status_flags = compiled_code_p->status_flags;
 
+    if (globals_p->optimize_size)
+    {
+      uint32_t identical_offset = snapshot_find_identical_compiled_code (snapshot_buffer_p, code_offset);
+
+      if (identical_offset != 0)
+      {
+        globals_p->snapshot_buffer_write_offset = code_offset;
+        return identical_offset;
+      }
+    }
+
     return start_offset;
   }
 #endif /* JERRY_BUILTIN_REGEXP */
@@ -239,6 +958,12 @@ snapshot_add_compiled_code (const ecma_compiled_code_t *compiled_code_p, /**< co
     return 0;
   }
 
+  if (globals_p->optimize_size)
+  {
+    globals_p->snapshot_buffer_write_offset = code_offset + snapshot_optimize_compiled_code (copied_code_p);
+    copied_code_p->refs = 0;
+  }
+
   /* Sub-functions and regular expressions are stored recursively. */
   uint8_t *buffer_p = (uint8_t *) copied_code_p;
   ecma_value_t *literal_start_p;
@@ -279,12 +1004,27 @@ snapshot_add_compiled_code (const ecma_compiled_code_t *compiled_code_p, /**< co
     {
       uint32_t offset = snapshot_add_compiled_code (bytecode_p, snapshot_buffer_p, snapshot_buffer_size, globals_p);
 
-      JERRY_ASSERT (!ecma_is_value_empty (globals_p->snapshot_error) || offset > start_offset);
+      /* Shared compiled code blocks are stored before the current one. */
+      JERRY_ASSERT (!ecma_is_value_empty (globals_p->snapshot_error) || offset > start_offset
+                    || (globals_p->optimize_size && offset < start_offset));
 
       literal_start_p[i] = offset - start_offset;
     }
   }
 
+  if (globals_p->optimize_size && ecma_is_value_empty (globals_p->snapshot_error))
+  {
+    copied_code_p->refs = 1;
+
+    uint32_t identical_offset = snapshot_find_identical_compiled_code (snapshot_buffer_p, code_offset);
+
+    if (identical_offset != 0)
+    {
+      globals_p->snapshot_buffer_write_offset = code_offset;
+      return identical_offset;
+    }
+  }
+
   return start_offset;
 } /* snapshot_add_compiled_code */
 
@@ -361,6 +1101,12 @@ static_snapshot_add_compiled_code (const ecma_compiled_code_t *compiled_code_p,
     return 0;
   }
 
+  if (globals_p->optimize_size)
+  {
+    size_t code_offset = (size_t) (copied_code_start_p - snapshot_buffer_p);
+    globals_p->snapshot_buffer_write_offset = code_offset + snapshot_optimize_compiled_code (copied_code_p);
+  }
+
   /* Sub-functions and regular expressions are stored recursively. */
   uint8_t *buffer_p = (uint8_t *) copied_code_p;
   ecma_value_t *literal_start_p;
@@ -474,10 +1220,11 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
       {
         if (ecma_is_value_string (literal_start_p[i])
 #if JERRY_BUILTIN_BIGINT
-            || ecma_is_value_bigint (literal_start_p[i])
+            || (ecma_is_value_bigint (literal_start_p[i]) && literal_start_p[i] != ECMA_BIGINT_ZERO)
 #endif /* JERRY_BUILTIN_BIGINT */
             || ecma_is_value_float_number (literal_start_p[i]))
         {
+          /* The literal map only contains the values stored by ecma_save_literals_append_value. */
           lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
 
           while (current_p->literal_id != literal_start_p[i])
@@ -532,6 +1279,61 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
  */
 #define BYTECODE_NO_COPY_THRESHOLD 8
 
+/**
+ * Number of entries of the literal cache used by snapshot loading (must be a power of 2).
+ */
+#define SNAPSHOT_LITERAL_CACHE_SIZE 256
+
+/**
+ * Literal cache entry.
+ */
+typedef struct
+{
+  ecma_value_t literal_offset; /**< literal offset in the snapshot */
+  ecma_value_t literal_value; /**< resolved literal */
+} snapshot_literal_cache_entry_t;
+
+/**
+ * Literal table of the snapshot being loaded.
+ */
+typedef struct
+{
+  const uint8_t *literal_base_p; /**< literal start */
+  snapshot_literal_cache_entry_t *cache_p; /**< recently resolved literals (NULL, if not available) */
+} snapshot_literal_table_t;
+
+/**
+ * Resolve a literal of the snapshot being loaded.
+ *
+ * Note:
+ *      the same literals are usually referenced by many functions, so
+ *      the recently resolved literals are cached to avoid searching
+ *      the literal storage again
+ *
+ * @return literal value
+ */
+static ecma_value_t
+snapshot_get_literal (snapshot_literal_table_t *literal_table_p, /**< literal table */
+                      ecma_value_t literal_offset) /**< literal offset */
+{
+  if (literal_table_p->cache_p == NULL)
+  {
+    return ecma_snapshot_get_literal (literal_table_p->literal_base_p, literal_offset);
+  }
+
+  snapshot_literal_cache_entry_t *entry_p;
+  entry_p = literal_table_p->cache_p + ((literal_offset >> ECMA_VALUE_SHIFT) & (SNAPSHOT_LITERAL_CACHE_SIZE - 1));
+
+  if (entry_p->literal_offset != literal_offset)
+  {
+    /* Literals are never freed before the engine is cleaned up, so no reference is kept. */
+    entry_p->literal_offset = literal_offset;
+    entry_p->literal_value = ecma_snapshot_get_literal (literal_table_p->literal_base_p, literal_offset);
+  }
+
+  return entry_p->literal_value;
+} /* snapshot_get_literal */
+
 /**
  * Load byte code from snapshot.
  *
@@ -540,7 +1342,7 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
 static ecma_compiled_code_t *
 snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of the
                                                           *   current primary function */
-                             const uint8_t *literal_base_p, /**< literal start */
+                             snapshot_literal_table_t *literal_table_p, /**< literal table */
                              cbc_script_t *script_p, /**< script */
                              bool copy_bytecode) /**< byte code should be copied to memory */
 {
@@ -555,8 +1357,18 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
     /* Real size is stored in refs. */
     ecma_string_t *pattern_str_p = ecma_new_ecma_string_from_utf8 (regex_start_p, bytecode_p->refs);
 
-    const re_compiled_code_t *re_bytecode_p = re_compile_bytecode (pattern_str_p, bytecode_p->status_flags);
-    ecma_deref_ecma_string (pattern_str_p);
+    /* The precompiled byte code follows the pattern. Its header is modified by reference
+     * counting, so it is always copied into the memory. */
+    const re_compiled_code_t *snapshot_re_bytecode_p =
+      (const re_compiled_code_t *) (base_addr_p
+                                    + JERRY_ALIGNUP (sizeof (ecma_compiled_code_t) + bytecode_p->refs, JMEM_ALIGNMENT));
+    size_t re_bytecode_size = ((size_t) snapshot_re_bytecode_p->header.size) << JMEM_ALIGNMENT_LOG;
+
+    re_compiled_code_t *re_bytecode_p = (re_compiled_code_t *) jmem_heap_alloc_block (re_bytecode_size);
+    memcpy (re_bytecode_p, snapshot_re_bytecode_p, re_bytecode_size);
+
+    JERRY_ASSERT (re_bytecode_p->header.refs == 1);
+    re_bytecode_p->source = ecma_make_string_value (pattern_str_p);
 
     return (ecma_compiled_code_t *) re_bytecode_p;
   }
@@ -682,13 +1494,14 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
   {
     if ((literal_start_p[i] & ECMA_VALUE_TYPE_MASK) == ECMA_TYPE_SNAPSHOT_OFFSET)
     {
-      literal_start_p[i] = ecma_snapshot_get_literal (literal_base_p, literal_start_p[i]);
+      literal_start_p[i] = snapshot_get_literal (literal_table_p, literal_start_p[i]);
     }
   }
 
   for (uint32_t i = const_literal_end; i < literal_end; i++)
   {
-    size_t literal_offset = (size_t) literal_start_p[i];
+    /* Shared compiled code blocks may precede the current one. */
+    int32_t literal_offset = (int32_t) literal_start_p[i];
 
     if (literal_offset == 0)
     {
@@ -699,7 +1512,7 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
     {
       ecma_compiled_code_t *literal_bytecode_p;
       literal_bytecode_p =
-        snapshot_load_compiled_code (base_addr_p + literal_offset, literal_base_p, script_p, copy_bytecode);
+        snapshot_load_compiled_code (base_addr_p + literal_offset, literal_table_p, script_p, copy_bytecode);
 
       ECMA_SET_INTERNAL_VALUE_POINTER (literal_start_p[i], literal_bytecode_p);
     }
@@ -712,7 +1525,7 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
   {
     if ((*literal_start_p & ECMA_VALUE_TYPE_MASK) == ECMA_TYPE_SNAPSHOT_OFFSET)
     {
-      *literal_start_p = ecma_snapshot_get_literal (literal_base_p, *literal_start_p);
+      *literal_start_p = snapshot_get_literal (literal_table_p, *literal_start_p);
     }
 
     literal_start_p++;
@@ -738,7 +1551,7 @@ jerry_generate_snapshot (jerry_value_t compiled_code, /**< parsed script or func
                          size_t buffer_size) /**< the buffer's size */
 {
 #if JERRY_SNAPSHOT_SAVE
-  uint32_t allowed_options = JERRY_SNAPSHOT_SAVE_STATIC;
+  uint32_t allowed_options = JERRY_SNAPSHOT_SAVE_STATIC | JERRY_SNAPSHOT_SAVE_OPTIMIZE_SIZE;
 
   if ((generate_snapshot_opts & ~allowed_options) != 0)
   {
@@ -784,6 +1597,7 @@ jerry_generate_snapshot (jerry_value_t compiled_code, /**< parsed script or func
   globals.snapshot_error = ECMA_VALUE_EMPTY;
   globals.regex_found = false;
   globals.class_found = false;
+  globals.optimize_size = (generate_snapshot_opts & JERRY_SNAPSHOT_SAVE_OPTIMIZE_SIZE) != 0;
 
   if (generate_snapshot_opts & JERRY_SNAPSHOT_SAVE_STATIC)
   {
@@ -966,13 +1780,30 @@ jerry_exec_snapshot (const uint32_t *snapshot_p, /**< snapshot */
     script_p->source_code = ecma_make_magic_string_value (LIT_MAGIC_STRING__EMPTY);
 #endif /* JERRY_FUNCTION_TO_STRING */
 
-    const uint8_t *literal_base_p = snapshot_data_p + header_p->lit_table_offset;
+    snapshot_literal_table_t literal_table;
+    literal_table.literal_base_p = snapshot_data_p + header_p->lit_table_offset;
+
+    const size_t cache_size = SNAPSHOT_LITERAL_CACHE_SIZE * sizeof (snapshot_literal_cache_entry_t);
+    literal_table.cache_p = (snapshot_literal_cache_entry_t *) jmem_heap_alloc_block_null_on_error (cache_size);
+
+    if (literal_table.cache_p != NULL)
+    {
+      for (uint32_t i = 0; i < SNAPSHOT_LITERAL_CACHE_SIZE; i++)
+      {
+        literal_table.cache_p[i].literal_offset = ECMA_VALUE_EMPTY;
+      }
+    }
 
     bytecode_p = snapshot_load_compiled_code ((const uint8_t *) bytecode_p,
-                                              literal_base_p,
+                                              &literal_table,
                                               script_p,
                                               (exec_snapshot_opts & JERRY_SNAPSHOT_EXEC_COPY_DATA) != 0);
 
+    if (literal_table.cache_p != NULL)
+    {
+      jmem_heap_free_block (literal_table.cache_p, cache_size);
+    }
+
     if (bytecode_p == NULL)
     {
       JERRY_ASSERT (script_p->refs_and_type >= CBC_SCRIPT_REF_ONE);
@@ -222,6 +222,9 @@ jerry_cleanup (void)
 
   ecma_free_all_enqueued_jobs ();
   ecma_finalize ();
+#if JERRY_PARSER
+  parser_arena_free_cache ();
+#endif /* JERRY_PARSER */
   jerry_api_disable ();
 
   for (jerry_context_data_header_t *this_p = JERRY_CONTEXT (context_data_p), *next_p = NULL; this_p != NULL;
@@ -513,6 +516,409 @@ jerry_parse_value (const jerry_value_t source, /**< script source */
 #endif /* JERRY_PARSER */
 } /* jerry_parse_value */
 
+/**
+ * Sets the callbacks which load and store the pre-scanning data of the parsed source codes.
+ *
+ * Note:
+ *      the data of a source code only depends on its content and parsing options, so
+ *      it can be reused after the engine is reinitialized (e.g. when a script is reloaded)
+ */
+void
+jerry_parse_cache (jerry_parse_cache_load_cb_t load_callback, /**< callback which provides the stored data
+                                                               *   (can be NULL) */
+                   jerry_parse_cache_store_cb_t store_callback, /**< callback which stores the data
+                                                                 *   (can be NULL) */
+                   void *user_p) /**< user pointer passed to the callbacks */
+{
+  jerry_assert_api_enabled ();
+
+#if JERRY_PARSER
+  JERRY_CONTEXT (parse_cache_load_callback_p) = load_callback;
+  JERRY_CONTEXT (parse_cache_store_callback_p) = store_callback;
+  JERRY_CONTEXT (parse_cache_user_p) = user_p;
+#else /* !JERRY_PARSER */
+  JERRY_UNUSED (load_callback);
+  JERRY_UNUSED (store_callback);
+  JERRY_UNUSED (user_p);
+#endif /* JERRY_PARSER */
+} /* jerry_parse_cache */
+
+/**
+ * Get the parser statistics collected since the engine was initialized.
+ *
+ * Note:
+ *      the parser statistics are only available if the engine is built with
+ *      the JERRY_PARSER_STATS option
+ *
+ * @return true - if stats were written into the provided structure,
+ *         false - otherwise. Usually it is because the PARSER_STATS feature is not enabled.
+ */
+bool
+jerry_parse_stats (jerry_parse_stats_t *out_stats_p) /**< [out] parser stats */
+{
+  jerry_assert_api_enabled ();
+
+#if JERRY_PARSER && JERRY_PARSER_STATS
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  *out_stats_p = JERRY_CONTEXT (parse_stats);
+  out_stats_p->version = 1;
+  return true;
+#else /* !(JERRY_PARSER && JERRY_PARSER_STATS) */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* JERRY_PARSER && JERRY_PARSER_STATS */
+} /* jerry_parse_stats */
+
+#if JERRY_PARSER_STATS
+
+/**
+ * Number of the tracked opcodes: the extended opcodes follow the normal opcodes.
+ */
+#define JERRY_BYTE_CODE_STATS_OPCODE_COUNT (CBC_END + 1 + CBC_EXT_END + 1)
+
+/**
+ * Byte code statistics collector.
+ */
+typedef struct
+{
+  jerry_byte_code_stats_t *stats_p; /**< total statistics */
+  jerry_function_stats_cb_t function_callback; /**< callback which is called for each function (can be NULL) */
+  void *user_p; /**< user pointer passed to the callbacks */
+  uint32_t *opcode_counts_p; /**< number of occurrences of each opcode (NULL if it is not collected) */
+  uint32_t *opcode_sizes_p; /**< total size of the instructions of each opcode */
+} jerry_byte_code_stats_collector_t;
+
+/**
+ * Collect the statistics of a compiled function and its nested functions.
+ */
+static void
+jerry_byte_code_stats_collect (const ecma_compiled_code_t *bytecode_p, /**< compiled code */
+                               uint32_t depth, /**< nesting depth of the compiled code */
+                               jerry_byte_code_stats_collector_t *collector_p) /**< collector */
+{
+  JERRY_ASSERT (CBC_IS_FUNCTION (bytecode_p->status_flags));
+
+  jerry_function_stats_t function_stats;
+  uint8_t *byte_code_start_p = (uint8_t *) bytecode_p;
+  size_t size = ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+  uint32_t register_end;
+  uint32_t ident_end;
+  uint32_t const_literal_end;
+  uint32_t literal_end;
+
+  memset (&function_stats, 0, sizeof (jerry_function_stats_t));
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_p;
+
+    function_stats.argument_count = args_p->argument_end;
+    function_stats.stack_limit = args_p->stack_limit;
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+    byte_code_start_p += sizeof (cbc_uint16_arguments_t);
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_p;
+
+    function_stats.argument_count = args_p->argument_end;
+    function_stats.stack_limit = args_p->stack_limit;
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+    byte_code_start_p += sizeof (cbc_uint8_arguments_t);
+  }
+
+  ecma_value_t *literal_start_p = ((ecma_value_t *) byte_code_start_p) - register_end;
+  byte_code_start_p += (literal_end - register_end) * sizeof (ecma_value_t);
+
+  function_stats.depth = depth;
+  function_stats.byte_code_size = (uint32_t) size;
+  function_stats.register_count = register_end;
+  function_stats.identifier_count = ident_end - register_end;
+  function_stats.literal_count = const_literal_end - ident_end;
+  function_stats.function_count = literal_end - const_literal_end;
+
+  /* The data stored after the instructions is excluded. */
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_MAPPED_ARGUMENTS_NEEDED)
+  {
+    size -= function_stats.argument_count * sizeof (ecma_value_t);
+  }
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_EXTENDED_INFO)
+  {
+    uint8_t *extended_info_p = ecma_compiled_code_resolve_extended_info (bytecode_p);
+    uint8_t *extended_info_start_p = extended_info_p + sizeof (uint8_t);
+    uint8_t extended_info = *extended_info_p;
+
+    if (extended_info & CBC_EXTENDED_CODE_FLAGS_HAS_ARGUMENT_LENGTH)
+    {
+      ecma_extended_info_decode_vlq (&extended_info_p);
+    }
+
+    if (extended_info & CBC_EXTENDED_CODE_FLAGS_HAS_SOURCE_CODE_RANGE)
+    {
+      ecma_extended_info_decode_vlq (&extended_info_p);
+      ecma_extended_info_decode_vlq (&extended_info_p);
+    }
+
+    size -= (size_t) (extended_info_start_p - extended_info_p);
+  }
+
+  if (CBC_FUNCTION_GET_TYPE (bytecode_p->status_flags) != CBC_FUNCTION_CONSTRUCTOR)
+  {
+    size -= sizeof (ecma_value_t);
+  }
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_TAGGED_LITERALS)
+  {
+    size -= sizeof (ecma_value_t);
+  }
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_LINE_INFO)
+  {
+    size -= sizeof (ecma_value_t);
+
+#if JERRY_LINE_INFO
+    jerry_frame_location_t location;
+    ecma_line_info_get (ecma_compiled_code_get_line_info (bytecode_p), 0, &location);
+
+    function_stats.line = location.line;
+    function_stats.column = location.column;
+#endif /* JERRY_LINE_INFO */
+  }
+
+  uint8_t *byte_code_p = byte_code_start_p;
+  uint8_t *byte_code_end_p = ((uint8_t *) bytecode_p) + size;
+  uint32_t encoding_limit = CBC_SMALL_LITERAL_ENCODING_LIMIT;
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING)
+  {
+    encoding_limit = CBC_FULL_LITERAL_ENCODING_LIMIT;
+  }
+
+  while (byte_code_p < byte_code_end_p)
+  {
+    uint8_t *instruction_start_p = byte_code_p;
+    uint32_t opcode = *byte_code_p;
+    uint32_t opcode_index = opcode;
+    uint8_t flags;
+
+    if (opcode != CBC_EXT_OPCODE)
+    {
+      flags = cbc_flags[opcode];
+      byte_code_p++;
+    }
+    else
+    {
+      if (byte_code_p + 1 >= byte_code_end_p)
+      {
+        break;
+      }
+
+      opcode = byte_code_p[1];
+
+      /* The compiled code is padded with zero bytes. */
+      if (opcode == CBC_EXT_NOP)
+      {
+        break;
+      }
+
+      flags = cbc_ext_flags[opcode];
+      opcode_index = CBC_END + 1 + opcode;
+      byte_code_p += 2;
+    }
+
+    if (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
+    {
+      byte_code_p += (*byte_code_p >= encoding_limit) ? 2 : 1;
+    }
+
+    if (flags & CBC_HAS_LITERAL_ARG2)
+    {
+      byte_code_p += (*byte_code_p >= encoding_limit) ? 2 : 1;
+
+      if (!(flags & CBC_HAS_LITERAL_ARG))
+      {
+        byte_code_p += (*byte_code_p >= encoding_limit) ? 2 : 1;
+      }
+    }
+
+    if (flags & CBC_HAS_BYTE_ARG)
+    {
+      byte_code_p++;
+    }
+
+    if (flags & CBC_HAS_BRANCH_ARG)
+    {
+      byte_code_p += CBC_BRANCH_OFFSET_LENGTH (opcode);
+    }
+
+    function_stats.instruction_count++;
+
+    if (collector_p->opcode_counts_p != NULL)
+    {
+      collector_p->opcode_counts_p[opcode_index]++;
+      collector_p->opcode_sizes_p[opcode_index] += (uint32_t) (byte_code_p - instruction_start_p);
+    }
+  }
+
+  function_stats.instruction_size = (uint32_t) (JERRY_MIN (byte_code_p, byte_code_end_p) - byte_code_start_p);
+
+  jerry_byte_code_stats_t *stats_p = collector_p->stats_p;
+
+  stats_p->function_count++;
+  stats_p->byte_code_size += function_stats.byte_code_size;
+  stats_p->instruction_size += function_stats.instruction_size;
+  stats_p->instruction_count += function_stats.instruction_count;
+  stats_p->identifier_count += function_stats.identifier_count;
+  stats_p->literal_count += function_stats.literal_count;
+  stats_p->max_register_count = JERRY_MAX (stats_p->max_register_count, function_stats.register_count);
+  stats_p->max_stack_limit = JERRY_MAX (stats_p->max_stack_limit, function_stats.stack_limit);
+
+  if (collector_p->function_callback != NULL)
+  {
+    collector_p->function_callback (&function_stats, collector_p->user_p);
+  }
+
+  for (uint32_t i = const_literal_end; i < literal_end; i++)
+  {
+    ecma_compiled_code_t *literal_bytecode_p =
+      ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t, literal_start_p[i]);
+
+    /* Regular expressions are not processed. */
+    if (literal_bytecode_p != bytecode_p && CBC_IS_FUNCTION (literal_bytecode_p->status_flags))
+    {
+      jerry_byte_code_stats_collect (literal_bytecode_p, depth + 1, collector_p);
+    }
+  }
+} /* jerry_byte_code_stats_collect */
+
+#endif /* JERRY_PARSER_STATS */
+
+/**
+ * Get the byte code statistics of a script, module or function created by jerry_parse,
+ * including all functions nested in it.
+ *
+ * Note:
+ *      - the function callback is called for each compiled function in depth-first order
+ *      - the opcode callback is called for each opcode which occurs at least once
+ *      - the byte code statistics are only available if the engine is built with
+ *        the JERRY_PARSER_STATS option
+ *
+ * @return true - if stats were written into the provided structure,
+ *         false - otherwise. Usually it is because the PARSER_STATS feature is not enabled,
+ *                 or the value has no byte code.
+ */
+bool
+jerry_byte_code_stats (const jerry_value_t value, /**< script, module or function */
+                       jerry_byte_code_stats_t *out_stats_p, /**< [out] byte code stats */
+                       jerry_function_stats_cb_t function_callback, /**< callback which is called for each
+                                                                     *   function (can be NULL) */
+                       jerry_opcode_stats_cb_t opcode_callback, /**< callback which is called for each
+                                                                 *   opcode (can be NULL) */
+                       void *user_p) /**< user pointer passed to the callbacks */
+{
+  jerry_assert_api_enabled ();
+
+#if JERRY_PARSER_STATS
+  if (out_stats_p == NULL || !ecma_is_value_object (value))
+  {
+    return false;
+  }
+
+  ecma_object_t *object_p = ecma_get_object_from_value (value);
+  const ecma_compiled_code_t *bytecode_p = NULL;
+
+  if (ecma_object_class_is (object_p, ECMA_OBJECT_CLASS_SCRIPT))
+  {
+    ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+    bytecode_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t, ext_object_p->u.cls.u3.value);
+  }
+#if JERRY_MODULE_SYSTEM
+  else if (ecma_object_class_is (object_p, ECMA_OBJECT_CLASS_MODULE))
+  {
+    ecma_module_t *module_p = (ecma_module_t *) object_p;
+
+    if (!(module_p->header.u.cls.u2.module_flags & ECMA_MODULE_IS_NATIVE))
+    {
+      bytecode_p = module_p->u.compiled_code_p;
+    }
+  }
+#endif /* JERRY_MODULE_SYSTEM */
+  else if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_FUNCTION)
+  {
+    bytecode_p = ecma_op_function_get_compiled_code ((ecma_extended_object_t *) object_p);
+  }
+
+  if (bytecode_p == NULL)
+  {
+    return false;
+  }
+
+  jerry_byte_code_stats_collector_t collector;
+  uint32_t *opcode_counts_p = NULL;
+  const size_t opcode_counts_size = 2 * JERRY_BYTE_CODE_STATS_OPCODE_COUNT * sizeof (uint32_t);
+
+  if (opcode_callback != NULL)
+  {
+    opcode_counts_p = (uint32_t *) jmem_heap_alloc_block_null_on_error (opcode_counts_size);
+
+    if (opcode_counts_p == NULL)
+    {
+      return false;
+    }
+
+    memset (opcode_counts_p, 0, opcode_counts_size);
+  }
+
+  memset (out_stats_p, 0, sizeof (jerry_byte_code_stats_t));
+  out_stats_p->version = 1;
+
+  collector.stats_p = out_stats_p;
+  collector.function_callback = function_callback;
+  collector.user_p = user_p;
+  collector.opcode_counts_p = opcode_counts_p;
+  collector.opcode_sizes_p = opcode_counts_p + JERRY_BYTE_CODE_STATS_OPCODE_COUNT;
+
+  jerry_byte_code_stats_collect (bytecode_p, 0, &collector);
+
+  if (opcode_counts_p != NULL)
+  {
+    for (uint32_t i = 0; i < JERRY_BYTE_CODE_STATS_OPCODE_COUNT; i++)
+    {
+      if (opcode_counts_p[i] == 0)
+      {
+        continue;
+      }
+
+      const char *name_p = (i <= CBC_END) ? cbc_names[i] : cbc_ext_names[i - (CBC_END + 1)];
+      opcode_callback (name_p, opcode_counts_p[i], collector.opcode_sizes_p[i], user_p);
+    }
+
+    jmem_heap_free_block (opcode_counts_p, opcode_counts_size);
+  }
+
+  return true;
+#else /* !JERRY_PARSER_STATS */
+  JERRY_UNUSED (value);
+  JERRY_UNUSED (out_stats_p);
+  JERRY_UNUSED (function_callback);
+  JERRY_UNUSED (opcode_callback);
+  JERRY_UNUSED (user_p);
+  return false;
+#endif /* JERRY_PARSER_STATS */
+} /* jerry_byte_code_stats */
+
 /**
  * Run a Script or Module created by jerry_parse.
  *
@@ -1703,6 +2109,9 @@ jerry_feature_enabled (const jerry_feature_t feature) /**< feature to check */
 #if JERRY_PARSER_DUMP_BYTE_CODE
           || feature == JERRY_FEATURE_PARSER_DUMP
 #endif /* JERRY_PARSER_DUMP_BYTE_CODE */
+#if JERRY_PARSER_STATS
+          || feature == JERRY_FEATURE_PARSER_STATS
+#endif /* JERRY_PARSER_STATS */
 #if JERRY_REGEXP_DUMP_BYTE_CODE
           || feature == JERRY_FEATURE_REGEXP_DUMP
 #endif /* JERRY_REGEXP_DUMP_BYTE_CODE */
@@ -6927,6 +7336,140 @@ jerry_json_stringify (const jerry_value_t input_value) /**< a value to stringify
 #endif /* JERRY_BUILTIN_JSON */
 } /* jerry_json_stringify */
 
+/**
+ * Write the JSON text of a JavaScript value into a buffer in UTF-8 encoding.
+ *
+ * The JSON text is equivalent with the result of the "JSON.stringify(input_value)" JS call, but no
+ * string value is created for it. The text is only copied when it fits into the buffer completely,
+ * so the buffer size can be queried by passing a zero sized buffer.
+ *
+ * Note:
+ *      The returned value must be freed with jerry_value_free,
+ *
+ * @return - number value containing the size of the JSON text in bytes.
+ *         - Error value if there was a problem during the stringification.
+ */
+jerry_value_t
+jerry_json_stringify_to_buffer (const jerry_value_t input_value, /**< a value to stringify */
+                                jerry_char_t *buffer_p, /**< [out] output buffer */
+                                jerry_size_t buffer_size) /**< size of the output buffer */
+{
+  jerry_assert_api_enabled ();
+#if JERRY_BUILTIN_JSON
+  if (ecma_is_value_exception (input_value) || (buffer_p == NULL && buffer_size != 0))
+  {
+    return jerry_throw_sz (JERRY_ERROR_TYPE, ecma_get_error_msg (ECMA_ERR_VALUE_MSG));
+  }
+
+  ecma_value_t ret_value = ecma_builtin_json_stringify_to_buffer (input_value, (lit_utf8_byte_t *) buffer_p, buffer_size);
+
+  if (ecma_is_value_undefined (ret_value))
+  {
+    ret_value = jerry_throw_sz (JERRY_ERROR_SYNTAX, ecma_get_error_msg (ECMA_ERR_JSON_STRINGIFY_ERROR));
+  }
+
+  return jerry_return (ret_value);
+#else /* JERRY_BUILTIN_JSON */
+  JERRY_UNUSED (input_value);
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return jerry_throw_sz (JERRY_ERROR_SYNTAX, ecma_get_error_msg (ECMA_ERR_JSON_NOT_SUPPORTED));
+#endif /* JERRY_BUILTIN_JSON */
+} /* jerry_json_stringify_to_buffer */
+
+/**
+ * Create an incremental JSON parser. The source text is passed to the parser in chunks
+ * by jerry_json_parser_feed, and the parsing is completed by jerry_json_parser_finish.
+ *
+ * Note:
+ *      when JERRY_JSON_PARSER_ARRAY_ELEMENTS or JERRY_JSON_PARSER_VALUE_SEQUENCE option is set,
+ *      the completed values are passed to the callback as soon as their source text is available,
+ *      and only the source text of the value being parsed is kept in the memory
+ *
+ * @return pointer to the parser, which must be released by jerry_json_parser_finish
+ *         NULL - if JSON support is disabled or there is not enough memory
+ */
+jerry_json_parser_t *
+jerry_json_parser_new (uint32_t options, /**< combination of jerry_json_parser_option_t values */
+                       jerry_json_parser_cb_t callback, /**< callback for the completed values (can be NULL) */
+                       void *user_p) /**< user pointer passed to the callback */
+{
+  jerry_assert_api_enabled ();
+
+#if JERRY_BUILTIN_JSON
+  return ecma_builtin_json_stream_create (options, callback, user_p);
+#else /* !JERRY_BUILTIN_JSON */
+  JERRY_UNUSED (options);
+  JERRY_UNUSED (callback);
+  JERRY_UNUSED (user_p);
+
+  return NULL;
+#endif /* JERRY_BUILTIN_JSON */
+} /* jerry_json_parser_new */
+
+/**
+ * Pass the next chunk of the source text to an incremental JSON parser. The chunk can be
+ * encoded as either cesu-8 or utf-8, and it can end anywhere, even inside a token.
+ *
+ * Note:
+ *      returned value must be freed with jerry_value_free, when it is no longer needed.
+ *
+ * @return undefined - if no error is found
+ *         exception - otherwise
+ */
+jerry_value_t
+jerry_json_parser_feed (jerry_json_parser_t *parser_p, /**< incremental JSON parser */
+                        const jerry_char_t *chunk_p, /**< source text chunk */
+                        jerry_size_t chunk_size) /**< size of the chunk */
+{
+  jerry_assert_api_enabled ();
+
+#if JERRY_BUILTIN_JSON
+  if (parser_p == NULL)
+  {
+    return jerry_throw_sz (JERRY_ERROR_TYPE, ecma_get_error_msg (ECMA_ERR_WRONG_ARGS_MSG));
+  }
+
+  return jerry_return (ecma_builtin_json_stream_feed (parser_p, chunk_p, chunk_size));
+#else /* !JERRY_BUILTIN_JSON */
+  JERRY_UNUSED (parser_p);
+  JERRY_UNUSED (chunk_p);
+  JERRY_UNUSED (chunk_size);
+
+  return jerry_throw_sz (JERRY_ERROR_SYNTAX, ecma_get_error_msg (ECMA_ERR_JSON_NOT_SUPPORTED));
+#endif /* JERRY_BUILTIN_JSON */
+} /* jerry_json_parser_feed */
+
+/**
+ * Complete the parsing of an incremental JSON parser and release the parser.
+ *
+ * Note:
+ *      returned value must be freed with jerry_value_free, when it is no longer needed.
+ *
+ * @return parsed value - if no options were passed to jerry_json_parser_new
+ *         undefined - if the values were passed to the callback
+ *         exception - if the source text is invalid or incomplete
+ */
+jerry_value_t
+jerry_json_parser_finish (jerry_json_parser_t *parser_p) /**< incremental JSON parser */
+{
+  jerry_assert_api_enabled ();
+
+#if JERRY_BUILTIN_JSON
+  if (parser_p == NULL)
+  {
+    return jerry_throw_sz (JERRY_ERROR_TYPE, ecma_get_error_msg (ECMA_ERR_WRONG_ARGS_MSG));
+  }
+
+  return jerry_return (ecma_builtin_json_stream_finish (parser_p));
+#else /* !JERRY_BUILTIN_JSON */
+  JERRY_UNUSED (parser_p);
+
+  return jerry_throw_sz (JERRY_ERROR_SYNTAX, ecma_get_error_msg (ECMA_ERR_JSON_NOT_SUPPORTED));
+#endif /* JERRY_BUILTIN_JSON */
+} /* jerry_json_parser_finish */
+
 /**
  * Create a container type specified in jerry_container_type_t.
  * The container can be created with a list of arguments, which will be passed to the container constructor to be
@@ -337,6 +337,21 @@
 #define JERRY_PARSER_DUMP_BYTE_CODE 0
 #endif /* defined (JERRY_PARSER_DUMP_BYTE_CODE) */
 
+/**
+ * Enable/Disable the collection of parser and byte code statistics.
+ *
+ * Note: the parser timing statistics use the jerry_port_current_time port function.
+ *
+ * Allowed values:
+ *  0: Disable parser and byte code statistics.
+ *  1: Enable parser and byte code statistics.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_PARSER_STATS
+#define JERRY_PARSER_STATS 0
+#endif /* !defined (JERRY_PARSER_STATS) */
+
 /**
  * Enable/Disable ECMA property hashmap.
  *
@@ -628,6 +643,9 @@
 #if (JERRY_PARSER_DUMP_BYTE_CODE != 0) && (JERRY_PARSER_DUMP_BYTE_CODE != 1)
 #error "Invalid value for 'JERRY_PARSER_DUMP_BYTE_CODE' macro."
 #endif /* (JERRY_PARSER_DUMP_BYTE_CODE != 0) && (JERRY_PARSER_DUMP_BYTE_CODE != 1) */
+#if (JERRY_PARSER_STATS != 0) && (JERRY_PARSER_STATS != 1)
+#error "Invalid value for 'JERRY_PARSER_STATS' macro."
+#endif /* (JERRY_PARSER_STATS != 0) && (JERRY_PARSER_STATS != 1) */
 #if (JERRY_PROPERTY_HASHMAP != 0) && (JERRY_PROPERTY_HASHMAP != 1)
 #error "Invalid value for 'JERRY_PROPERTY_HASHMAP' macro."
 #endif /* (JERRY_PROPERTY_HASHMAP != 0) && (JERRY_PROPERTY_HASHMAP != 1) */
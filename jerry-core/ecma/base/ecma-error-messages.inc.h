@@ -591,6 +591,9 @@ ECMA_ERROR_DEF (ECMA_ERR_TOO_MANY_ARGUMENTS_DECLARED_FOR_FUNCTION_APPLY,
 #if JERRY_ERROR_MESSAGES
 ECMA_ERROR_DEF (ECMA_ERR_ACCESSOR_FUNCTIONS_INVOKE_WITH_NEW, "Accessor functions cannot be invoked with 'new'")
 #endif /* JERRY_ERROR_MESSAGES */
+#if JERRY_BUILTIN_JSON
+ECMA_ERROR_DEF (ECMA_ERR_ALLOCATE_JSON_SOURCE_TEXT, "Cannot allocate memory for the JSON source text")
+#endif /* JERRY_BUILTIN_JSON */
 #if JERRY_MODULE_SYSTEM
 ECMA_ERROR_DEF (ECMA_ERR_LINK_TO_MODULE_IN_ERROR_STATE, "Cannot link to a module which is in error state")
 #endif /* JERRY_MODULE_SYSTEM */
@@ -24,10 +24,12 @@
 #include "ecma-arraybuffer-object.h"
 #include "ecma-builtin-handlers.h"
 #include "ecma-container-object.h"
+#include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "ecma-literal-storage.h"
 #include "ecma-objects.h"
 #include "ecma-property-hashmap.h"
 #include "ecma-proxy-object.h"
@@ -36,6 +38,7 @@
 #include "jrt-bit-fields.h"
 #include "jrt-libc-includes.h"
 #include "jrt.h"
+#include "js-parser.h"
 #include "re-compiler.h"
 #include "vm-defines.h"
 #include "vm-stack.h"
@@ -1736,6 +1739,9 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
     {
       if (((ecma_extended_object_t *) object_p)->u.built_in.id == ECMA_BUILTIN_ID_GLOBAL)
       {
+#if JERRY_PARSER && JERRY_BUILTIN_REALMS
+        ecma_eval_cache_remove_realm (object_p);
+#endif /* JERRY_PARSER && JERRY_BUILTIN_REALMS */
         ext_object_size = sizeof (ecma_global_object_t);
         break;
       }
@@ -2327,6 +2333,16 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
     }
 #endif /* JERRY_PROPERTY_HASHMAP */
 
+    /* The hash index of the literal strings is rebuilt when more literals are created. */
+    ecma_lit_storage_free_string_index ();
+
+#if JERRY_PARSER
+    ecma_eval_cache_free ();
+
+    /* Only the cached pages are freed, the pages of a running parser are still in use. */
+    parser_arena_free_cache ();
+#endif /* JERRY_PARSER */
+
     jmem_pools_collect_empty ();
     return;
   }
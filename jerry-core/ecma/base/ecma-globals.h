@@ -124,6 +124,7 @@ typedef enum
 #if JERRY_FUNCTION_TO_STRING
   ECMA_PARSE_INTERNAL_HAS_4_BYTE_MARKER = (1u << 19), /**< source has 4 byte marker */
 #endif /* JERRY_FUNCTION_TO_STRING */
+  ECMA_PARSE_INTERNAL_CACHEABLE = (1u << 20), /**< the compiled code can be stored in the eval cache */
 #ifndef JERRY_NDEBUG
   /**
    * This flag represents an error in for in/of statements, which cannot be set
@@ -1198,6 +1199,31 @@ typedef struct
                           *   If regexp, the other flags must be RE_FLAG... */
 } ecma_compiled_code_t;
 
+#if JERRY_PARSER
+
+/**
+ * Number of compiled codes kept by the eval cache
+ */
+#define ECMA_EVAL_CACHE_SIZE 16
+
+/**
+ * Compiled codes are removed from the eval cache when their reference counter reaches this limit
+ */
+#define ECMA_EVAL_CACHE_MAX_REFS (UINT16_MAX / 2)
+
+/**
+ * Compiled code of an eval call or a dynamic function kept for reuse
+ */
+typedef struct
+{
+  ecma_compiled_code_t *bytecode_p; /**< compiled code (NULL if the entry is unused) */
+  ecma_value_t source; /**< source code string */
+  ecma_value_t argument_list; /**< argument list string of dynamic functions, ECMA_VALUE_EMPTY otherwise */
+  uint32_t parse_opts; /**< ecma_parse_opts_t option bits of the parsing */
+} ecma_eval_cache_entry_t;
+
+#endif /* JERRY_PARSER */
+
 /**
  * Description of bound function objects.
  */
@@ -1675,8 +1701,14 @@ typedef struct
 typedef struct
 {
   lit_utf8_size_t current_size; /**< size of the data in the buffer */
+  lit_utf8_size_t allocated_size; /**< size of the allocated buffer */
 } ecma_stringbuilder_header_t;
 
+/**
+ * Maximum number of extra bytes reserved by the string builder when its buffer is grown
+ */
+#define ECMA_STRINGBUILDER_MAX_RESERVE 1024
+
 /**
  * Get pointer to the beginning of the stored string in the string builder
  */
@@ -2226,6 +2258,17 @@ typedef struct
   ecma_number_t date_value; /**< [[DateValue]] internal property */
 } ecma_date_object_t;
 
+/**
+ * Recently computed calendar date shared by all date objects
+ */
+typedef struct
+{
+  int32_t day; /**< day of the cached calendar date (elapsed days since Unix Epoch) */
+  int32_t year; /**< year of the cached day */
+  uint8_t month; /**< month of the cached day */
+  uint8_t date; /**< day of the month of the cached day */
+} ecma_date_cache_t;
+
 /**
  * Implicit class constructor flags
  */
@@ -280,6 +280,363 @@ ecma_uint64_normalize_shift (uint64_t n) /**< integer to count leading zeros in
  */
 #define EPSILON 0.0000001
 
+#if JERRY_NUMBER_TYPE_FLOAT64
+
+/**
+ * Smallest decimal exponent handled by the Eisel-Lemire conversion
+ */
+#define ECMA_EISEL_LEMIRE_MIN_EXPONENT (-27)
+
+/**
+ * Largest decimal exponent handled by the Eisel-Lemire conversion
+ */
+#define ECMA_EISEL_LEMIRE_MAX_EXPONENT 55
+
+/**
+ * Powers of five normalized to 128 bits. Positive powers are truncated,
+ * negative powers are the rounded up reciprocals. In this exponent range
+ * the 128-bit approximation is always precise enough to decide the rounding.
+ */
+static const uint64_t ecma_eisel_lemire_powers_of_5[][2] = {
+  { 0x9e74d1b791e07e48ull, 0x775ea264cf55347eull }, /* 5^-27 */
+  { 0xc612062576589ddaull, 0x95364afe032a819eull }, /* 5^-26 */
+  { 0xf79687aed3eec551ull, 0x3a83ddbd83f52205ull }, /* 5^-25 */
+  { 0x9abe14cd44753b52ull, 0xc4926a9672793543ull }, /* 5^-24 */
+  { 0xc16d9a0095928a27ull, 0x75b7053c0f178294ull }, /* 5^-23 */
+  { 0xf1c90080baf72cb1ull, 0x5324c68b12dd6339ull }, /* 5^-22 */
+  { 0x971da05074da7beeull, 0xd3f6fc16ebca5e04ull }, /* 5^-21 */
+  { 0xbce5086492111aeaull, 0x88f4bb1ca6bcf585ull }, /* 5^-20 */
+  { 0xec1e4a7db69561a5ull, 0x2b31e9e3d06c32e6ull }, /* 5^-19 */
+  { 0x9392ee8e921d5d07ull, 0x3aff322e62439fd0ull }, /* 5^-18 */
+  { 0xb877aa3236a4b449ull, 0x09befeb9fad487c3ull }, /* 5^-17 */
+  { 0xe69594bec44de15bull, 0x4c2ebe687989a9b4ull }, /* 5^-16 */
+  { 0x901d7cf73ab0acd9ull, 0x0f9d37014bf60a11ull }, /* 5^-15 */
+  { 0xb424dc35095cd80full, 0x538484c19ef38c95ull }, /* 5^-14 */
+  { 0xe12e13424bb40e13ull, 0x2865a5f206b06fbaull }, /* 5^-13 */
+  { 0x8cbccc096f5088cbull, 0xf93f87b7442e45d4ull }, /* 5^-12 */
+  { 0xafebff0bcb24aafeull, 0xf78f69a51539d749ull }, /* 5^-11 */
+  { 0xdbe6fecebdedd5beull, 0xb573440e5a884d1cull }, /* 5^-10 */
+  { 0x89705f4136b4a597ull, 0x31680a88f8953031ull }, /* 5^-9 */
+  { 0xabcc77118461cefcull, 0xfdc20d2b36ba7c3eull }, /* 5^-8 */
+  { 0xd6bf94d5e57a42bcull, 0x3d32907604691b4dull }, /* 5^-7 */
+  { 0x8637bd05af6c69b5ull, 0xa63f9a49c2c1b110ull }, /* 5^-6 */
+  { 0xa7c5ac471b478423ull, 0x0fcf80dc33721d54ull }, /* 5^-5 */
+  { 0xd1b71758e219652bull, 0xd3c36113404ea4a9ull }, /* 5^-4 */
+  { 0x83126e978d4fdf3bull, 0x645a1cac083126eaull }, /* 5^-3 */
+  { 0xa3d70a3d70a3d70aull, 0x3d70a3d70a3d70a4ull }, /* 5^-2 */
+  { 0xccccccccccccccccull, 0xcccccccccccccccdull }, /* 5^-1 */
+  { 0x8000000000000000ull, 0x0000000000000000ull }, /* 5^0 */
+  { 0xa000000000000000ull, 0x0000000000000000ull }, /* 5^1 */
+  { 0xc800000000000000ull, 0x0000000000000000ull }, /* 5^2 */
+  { 0xfa00000000000000ull, 0x0000000000000000ull }, /* 5^3 */
+  { 0x9c40000000000000ull, 0x0000000000000000ull }, /* 5^4 */
+  { 0xc350000000000000ull, 0x0000000000000000ull }, /* 5^5 */
+  { 0xf424000000000000ull, 0x0000000000000000ull }, /* 5^6 */
+  { 0x9896800000000000ull, 0x0000000000000000ull }, /* 5^7 */
+  { 0xbebc200000000000ull, 0x0000000000000000ull }, /* 5^8 */
+  { 0xee6b280000000000ull, 0x0000000000000000ull }, /* 5^9 */
+  { 0x9502f90000000000ull, 0x0000000000000000ull }, /* 5^10 */
+  { 0xba43b74000000000ull, 0x0000000000000000ull }, /* 5^11 */
+  { 0xe8d4a51000000000ull, 0x0000000000000000ull }, /* 5^12 */
+  { 0x9184e72a00000000ull, 0x0000000000000000ull }, /* 5^13 */
+  { 0xb5e620f480000000ull, 0x0000000000000000ull }, /* 5^14 */
+  { 0xe35fa931a0000000ull, 0x0000000000000000ull }, /* 5^15 */
+  { 0x8e1bc9bf04000000ull, 0x0000000000000000ull }, /* 5^16 */
+  { 0xb1a2bc2ec5000000ull, 0x0000000000000000ull }, /* 5^17 */
+  { 0xde0b6b3a76400000ull, 0x0000000000000000ull }, /* 5^18 */
+  { 0x8ac7230489e80000ull, 0x0000000000000000ull }, /* 5^19 */
+  { 0xad78ebc5ac620000ull, 0x0000000000000000ull }, /* 5^20 */
+  { 0xd8d726b7177a8000ull, 0x0000000000000000ull }, /* 5^21 */
+  { 0x878678326eac9000ull, 0x0000000000000000ull }, /* 5^22 */
+  { 0xa968163f0a57b400ull, 0x0000000000000000ull }, /* 5^23 */
+  { 0xd3c21bcecceda100ull, 0x0000000000000000ull }, /* 5^24 */
+  { 0x84595161401484a0ull, 0x0000000000000000ull }, /* 5^25 */
+  { 0xa56fa5b99019a5c8ull, 0x0000000000000000ull }, /* 5^26 */
+  { 0xcecb8f27f4200f3aull, 0x0000000000000000ull }, /* 5^27 */
+  { 0x813f3978f8940984ull, 0x4000000000000000ull }, /* 5^28 */
+  { 0xa18f07d736b90be5ull, 0x5000000000000000ull }, /* 5^29 */
+  { 0xc9f2c9cd04674edeull, 0xa400000000000000ull }, /* 5^30 */
+  { 0xfc6f7c4045812296ull, 0x4d00000000000000ull }, /* 5^31 */
+  { 0x9dc5ada82b70b59dull, 0xf020000000000000ull }, /* 5^32 */
+  { 0xc5371912364ce305ull, 0x6c28000000000000ull }, /* 5^33 */
+  { 0xf684df56c3e01bc6ull, 0xc732000000000000ull }, /* 5^34 */
+  { 0x9a130b963a6c115cull, 0x3c7f400000000000ull }, /* 5^35 */
+  { 0xc097ce7bc90715b3ull, 0x4b9f100000000000ull }, /* 5^36 */
+  { 0xf0bdc21abb48db20ull, 0x1e86d40000000000ull }, /* 5^37 */
+  { 0x96769950b50d88f4ull, 0x1314448000000000ull }, /* 5^38 */
+  { 0xbc143fa4e250eb31ull, 0x17d955a000000000ull }, /* 5^39 */
+  { 0xeb194f8e1ae525fdull, 0x5dcfab0800000000ull }, /* 5^40 */
+  { 0x92efd1b8d0cf37beull, 0x5aa1cae500000000ull }, /* 5^41 */
+  { 0xb7abc627050305adull, 0xf14a3d9e40000000ull }, /* 5^42 */
+  { 0xe596b7b0c643c719ull, 0x6d9ccd05d0000000ull }, /* 5^43 */
+  { 0x8f7e32ce7bea5c6full, 0xe4820023a2000000ull }, /* 5^44 */
+  { 0xb35dbf821ae4f38bull, 0xdda2802c8a800000ull }, /* 5^45 */
+  { 0xe0352f62a19e306eull, 0xd50b2037ad200000ull }, /* 5^46 */
+  { 0x8c213d9da502de45ull, 0x4526f422cc340000ull }, /* 5^47 */
+  { 0xaf298d050e4395d6ull, 0x9670b12b7f410000ull }, /* 5^48 */
+  { 0xdaf3f04651d47b4cull, 0x3c0cdd765f114000ull }, /* 5^49 */
+  { 0x88d8762bf324cd0full, 0xa5880a69fb6ac800ull }, /* 5^50 */
+  { 0xab0e93b6efee0053ull, 0x8eea0d047a457a00ull }, /* 5^51 */
+  { 0xd5d238a4abe98068ull, 0x72a4904598d6d880ull }, /* 5^52 */
+  { 0x85a36366eb71f041ull, 0x47a6da2b7f864750ull }, /* 5^53 */
+  { 0xa70c3c40a64e6c51ull, 0x999090b65f67d924ull }, /* 5^54 */
+  { 0xd0cf4b50cfe20765ull, 0xfff4b4e3f741cf6dull }, /* 5^55 */
+};
+
+/**
+ * Multiply two 64-bit integers into a 128-bit integer.
+ */
+static void
+ecma_uint64_multiply (uint64_t left, /**< left operand */
+                      uint64_t right, /**< right operand */
+                      ecma_uint128_t *result_p) /**< [out] product */
+{
+  uint64_t left_lo = (uint32_t) left;
+  uint64_t left_hi = left >> 32u;
+  uint64_t right_lo = (uint32_t) right;
+  uint64_t right_hi = right >> 32u;
+
+  uint64_t lo_lo = left_lo * right_lo;
+  uint64_t hi_lo = left_hi * right_lo;
+  uint64_t lo_hi = left_lo * right_hi;
+  uint64_t hi_hi = left_hi * right_hi;
+
+  uint64_t middle = (lo_lo >> 32u) + (uint32_t) hi_lo + (uint32_t) lo_hi;
+
+  result_p->lo = (middle << 32u) | (uint32_t) lo_lo;
+  result_p->hi = hi_hi + (hi_lo >> 32u) + (lo_hi >> 32u) + (middle >> 32u);
+} /* ecma_uint64_multiply */
+
+/**
+ * Eisel-Lemire conversion of significand * 10^decimal_exponent to the nearest double.
+ *
+ * See also:
+ *          Daniel Lemire, Number Parsing at a Gigabyte per Second
+ *
+ * @return converted number
+ */
+static ecma_number_t
+ecma_eisel_lemire_to_number (uint64_t significand, /**< non-zero decimal significand */
+                             int32_t decimal_exponent, /**< decimal exponent */
+                             bool sign) /**< sign of the number */
+{
+  JERRY_ASSERT (significand != 0);
+  JERRY_ASSERT (decimal_exponent >= ECMA_EISEL_LEMIRE_MIN_EXPONENT
+                && decimal_exponent <= ECMA_EISEL_LEMIRE_MAX_EXPONENT);
+
+  /* The result has ECMA_NUMBER_FRACTION_WIDTH + 3 significant bits before rounding. */
+  const uint64_t precision_mask = UINT64_MAX >> (ECMA_NUMBER_FRACTION_WIDTH + 3);
+  const uint64_t *power_p = ecma_eisel_lemire_powers_of_5[decimal_exponent - ECMA_EISEL_LEMIRE_MIN_EXPONENT];
+
+  int leading_zeros = ecma_uint64_clz (significand);
+  significand <<= leading_zeros;
+
+  ecma_uint128_t product;
+  ecma_uint64_multiply (significand, power_p[0], &product);
+
+  if ((product.hi & precision_mask) == precision_mask)
+  {
+    /* The lower half of the power may carry into the significant bits. */
+    ecma_uint128_t low_product;
+    ecma_uint64_multiply (significand, power_p[1], &low_product);
+
+    product.lo += low_product.hi;
+
+    if (product.lo < low_product.hi)
+    {
+      product.hi++;
+    }
+  }
+
+  int upper_bit = (int) (product.hi >> 63u);
+  int mantissa_shift = upper_bit + 64 - ECMA_NUMBER_FRACTION_WIDTH - 3;
+  uint64_t mantissa = product.hi >> mantissa_shift;
+
+  /* floor (decimal_exponent * log2 (10)) */
+  int32_t scaled_exponent = decimal_exponent * (152170 + 65536);
+  int32_t binary_exponent = (scaled_exponent >= 0 ? scaled_exponent / 65536 : -((65535 - scaled_exponent) / 65536));
+  binary_exponent += 63 + upper_bit - leading_zeros + ECMA_NUMBER_EXPONENT_BIAS;
+
+  /* Neither denormals nor infinity can be produced in this exponent range. */
+  JERRY_ASSERT (binary_exponent > 0 && binary_exponent < (1 << ECMA_NUMBER_BIASED_EXP_WIDTH) - 1);
+
+  /* Exact halfway cases must be rounded to even. */
+  if (product.lo <= 1 && decimal_exponent >= -4 && decimal_exponent <= 23 && (mantissa & 3) == 1
+      && (mantissa << mantissa_shift) == product.hi)
+  {
+    mantissa &= ~(uint64_t) 1;
+  }
+
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+
+  if (mantissa >= (2ull << ECMA_NUMBER_FRACTION_WIDTH))
+  {
+    mantissa = 1ull << ECMA_NUMBER_FRACTION_WIDTH;
+    binary_exponent++;
+  }
+
+  mantissa &= ~(1ull << ECMA_NUMBER_FRACTION_WIDTH);
+
+  return ecma_number_create (sign, (uint32_t) binary_exponent, mantissa);
+} /* ecma_eisel_lemire_to_number */
+
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+
+/**
+ * Convert a decimal significand and exponent to the nearest ecma-number.
+ *
+ * @return converted number
+ */
+ecma_number_t
+ecma_number_from_decimal (uint64_t significand, /**< decimal significand */
+                          int32_t decimal_exponent, /**< decimal exponent */
+                          bool sign) /**< sign of the number */
+{
+  if (significand == 0)
+  {
+    return sign ? -ECMA_NUMBER_ZERO : ECMA_NUMBER_ZERO;
+  }
+
+#if JERRY_NUMBER_TYPE_FLOAT64
+  if (decimal_exponent >= ECMA_EISEL_LEMIRE_MIN_EXPONENT && decimal_exponent <= ECMA_EISEL_LEMIRE_MAX_EXPONENT)
+  {
+    return ecma_eisel_lemire_to_number (significand, decimal_exponent, sign);
+  }
+
+  /* The value is in the [10^(d - 1), 10^d) range, where d is the sum of
+   * the decimal exponent and the number of digits of the significand. */
+  int32_t magnitude = decimal_exponent;
+
+  for (uint64_t value = significand; value != 0; value /= 10)
+  {
+    magnitude++;
+  }
+
+  if (magnitude > NUMBER_MAX_DECIMAL_EXPONENT + 1)
+  {
+    return ecma_number_make_infinity (sign);
+  }
+
+  if (magnitude < NUMBER_MIN_DECIMAL_EXPONENT)
+  {
+    return sign ? -ECMA_NUMBER_ZERO : ECMA_NUMBER_ZERO;
+  }
+
+  /*
+   * 128-bit mantissa storage
+   *
+   * Normalized: |4 bits zero|124-bit mantissa with highest bit set to 1|
+   */
+  ecma_uint128_t significand_uint128 = { .hi = significand, .lo = 0 };
+
+  /* Normalizing mantissa */
+  int shift = 4 - ecma_uint64_clz (significand_uint128.hi);
+
+  if (shift < 0)
+  {
+    ecma_uint128_shift_left (&significand_uint128, -shift);
+  }
+  else
+  {
+    ecma_uint128_shift_right (&significand_uint128, shift);
+  }
+
+  int32_t binary_exponent = ECMA_NUMBER_FRACTION_WIDTH + shift;
+
+  while (decimal_exponent > 0)
+  {
+    JERRY_ASSERT (ecma_uint64_clz (significand_uint128.hi) == 4);
+
+    ecma_uint128_mul10 (&significand_uint128);
+    decimal_exponent--;
+
+    /* Re-normalizing mantissa */
+    shift = ecma_uint64_normalize_shift (significand_uint128.hi);
+    JERRY_ASSERT (shift >= 0 && shift <= 4);
+
+    ecma_uint128_shift_right (&significand_uint128, shift);
+    binary_exponent += shift;
+  }
+
+  while (decimal_exponent < 0)
+  {
+    /* Denormalizing mantissa, moving highest 1 to bit 127 */
+    JERRY_ASSERT (ecma_uint64_clz (significand_uint128.hi) <= 4);
+    shift = ecma_uint64_clz_top4 (significand_uint128.hi);
+    JERRY_ASSERT (shift >= 0 && shift <= 4);
+
+    ecma_uint128_shift_left (&significand_uint128, shift);
+    binary_exponent -= shift;
+
+    ecma_uint128_div10 (&significand_uint128);
+    decimal_exponent++;
+  }
+
+  /*
+   * Preparing mantissa for conversion to 52-bit representation, converting it to:
+   *
+   * |11 zero bits|1|116 mantissa bits|
+   */
+  JERRY_ASSERT (ecma_uint64_clz (significand_uint128.hi) <= 4);
+  shift = 11 - ecma_uint64_clz_top4 (significand_uint128.hi);
+  ecma_uint128_shift_right (&significand_uint128, shift);
+  binary_exponent += shift;
+
+  JERRY_ASSERT (ecma_uint64_clz (significand_uint128.hi) == 11);
+
+  binary_exponent += ECMA_NUMBER_EXPONENT_BIAS;
+
+  /* Handle denormal numbers */
+  if (binary_exponent < 1)
+  {
+    ecma_uint128_shift_right (&significand_uint128, -binary_exponent + 1);
+    binary_exponent = 0;
+  }
+
+  significand = ecma_round_high_to_uint64 (&significand_uint128);
+
+  if (significand >= 1ull << (ECMA_NUMBER_FRACTION_WIDTH + 1))
+  {
+    /* Rounding carried over to the most significant bit, re-normalize.
+     * No need to shift mantissa right, as the low 52 bits will be 0 regardless. */
+    binary_exponent++;
+  }
+
+  if (binary_exponent >= ((1 << ECMA_NUMBER_BIASED_EXP_WIDTH) - 1))
+  {
+    return ecma_number_make_infinity (sign);
+  }
+
+  /* Mask low 52 bits. */
+  significand &= ((1ull << ECMA_NUMBER_FRACTION_WIDTH) - 1);
+
+  JERRY_ASSERT (binary_exponent < (1 << ECMA_NUMBER_BIASED_EXP_WIDTH) - 1);
+  JERRY_ASSERT (significand < (1ull << ECMA_NUMBER_FRACTION_WIDTH));
+
+  return ecma_number_create (sign, (uint32_t) binary_exponent, significand);
+#elif !JERRY_NUMBER_TYPE_FLOAT64
+  /* Less precise conversion */
+  ecma_number_t num = (ecma_number_t) significand;
+
+  ecma_number_t m = decimal_exponent < 0 ? (ecma_number_t) 0.1 : (ecma_number_t) 10.0;
+  uint32_t e = (uint32_t) (decimal_exponent < 0 ? -decimal_exponent : decimal_exponent);
+
+  while (e)
+  {
+    if (e % 2)
+    {
+      num *= m;
+    }
+
+    m *= m;
+    e /= 2;
+  }
+
+  return sign ? -num : num;
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+} /* ecma_number_from_decimal */
+
 /**
  * ECMA-defined conversion from string to number for different radixes (2, 8, 16).
  *
@@ -509,16 +866,12 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
       }
 
       int32_t digit_value = (*str_p++ - LIT_CHAR_0);
-      exponent = exponent * 10 + digit_value;
 
-      if (exponent_sign * exponent > NUMBER_MAX_DECIMAL_EXPONENT)
+      /* Larger exponents produce zero or infinity regardless of the digits. The
+       * result also depends on the significand, so it is computed at the end. */
+      if (exponent < 100000)
       {
-        return ecma_number_make_infinity (sign);
-      }
-
-      if (exponent_sign * exponent < NUMBER_MIN_DECIMAL_EXPONENT)
-      {
-        return sign ? -ECMA_NUMBER_ZERO : ECMA_NUMBER_ZERO;
+        exponent = exponent * 10 + digit_value;
       }
     }
 
@@ -530,124 +883,33 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
     return ecma_number_make_nan ();
   }
 
-  if (significand == 0)
-  {
-    return sign ? -ECMA_NUMBER_ZERO : ECMA_NUMBER_ZERO;
-  }
-
-#if JERRY_NUMBER_TYPE_FLOAT64
-  /*
-   * 128-bit mantissa storage
-   *
-   * Normalized: |4 bits zero|124-bit mantissa with highest bit set to 1|
-   */
-  ecma_uint128_t significand_uint128 = { .hi = significand, .lo = 0 };
-
-  /* Normalizing mantissa */
-  int shift = 4 - ecma_uint64_clz (significand_uint128.hi);
-
-  if (shift < 0)
-  {
-    ecma_uint128_shift_left (&significand_uint128, -shift);
-  }
-  else
-  {
-    ecma_uint128_shift_right (&significand_uint128, shift);
-  }
-
-  int32_t binary_exponent = ECMA_NUMBER_FRACTION_WIDTH + shift;
-
-  while (decimal_exponent > 0)
-  {
-    JERRY_ASSERT (ecma_uint64_clz (significand_uint128.hi) == 4);
-
-    ecma_uint128_mul10 (&significand_uint128);
-    decimal_exponent--;
-
-    /* Re-normalizing mantissa */
-    shift = ecma_uint64_normalize_shift (significand_uint128.hi);
-    JERRY_ASSERT (shift >= 0 && shift <= 4);
-
-    ecma_uint128_shift_right (&significand_uint128, shift);
-    binary_exponent += shift;
-  }
-
-  while (decimal_exponent < 0)
-  {
-    /* Denormalizing mantissa, moving highest 1 to bit 127 */
-    JERRY_ASSERT (ecma_uint64_clz (significand_uint128.hi) <= 4);
-    shift = ecma_uint64_clz_top4 (significand_uint128.hi);
-    JERRY_ASSERT (shift >= 0 && shift <= 4);
-
-    ecma_uint128_shift_left (&significand_uint128, shift);
-    binary_exponent -= shift;
-
-    ecma_uint128_div10 (&significand_uint128);
-    decimal_exponent++;
-  }
-
-  /*
-   * Preparing mantissa for conversion to 52-bit representation, converting it to:
-   *
-   * |11 zero bits|1|116 mantissa bits|
-   */
-  JERRY_ASSERT (ecma_uint64_clz (significand_uint128.hi) <= 4);
-  shift = 11 - ecma_uint64_clz_top4 (significand_uint128.hi);
-  ecma_uint128_shift_right (&significand_uint128, shift);
-  binary_exponent += shift;
-
-  JERRY_ASSERT (ecma_uint64_clz (significand_uint128.hi) == 11);
-
-  binary_exponent += ECMA_NUMBER_EXPONENT_BIAS;
-
-  /* Handle denormal numbers */
-  if (binary_exponent < 1)
-  {
-    ecma_uint128_shift_right (&significand_uint128, -binary_exponent + 1);
-    binary_exponent = 0;
-  }
-
-  significand = ecma_round_high_to_uint64 (&significand_uint128);
-
-  if (significand >= 1ull << (ECMA_NUMBER_FRACTION_WIDTH + 1))
-  {
-    /* Rounding carried over to the most significant bit, re-normalize.
-     * No need to shift mantissa right, as the low 52 bits will be 0 regardless. */
-    binary_exponent++;
-  }
-
-  if (binary_exponent >= ((1 << ECMA_NUMBER_BIASED_EXP_WIDTH) - 1))
-  {
-    return ecma_number_make_infinity (sign);
-  }
-
-  /* Mask low 52 bits. */
-  significand &= ((1ull << ECMA_NUMBER_FRACTION_WIDTH) - 1);
-
-  JERRY_ASSERT (binary_exponent < (1 << ECMA_NUMBER_BIASED_EXP_WIDTH) - 1);
-  JERRY_ASSERT (significand < (1ull << ECMA_NUMBER_FRACTION_WIDTH));
-
-  return ecma_number_create (sign, (uint32_t) binary_exponent, significand);
-#elif !JERRY_NUMBER_TYPE_FLOAT64
-  /* Less precise conversion */
-  ecma_number_t num = (ecma_number_t) (uint32_t) fraction_uint64;
-
-  ecma_number_t m = e_sign ? (ecma_number_t) 0.1 : (ecma_number_t) 10.0;
+  return ecma_number_from_decimal (significand, decimal_exponent, sign);
+} /* ecma_utf8_string_to_number */
 
-  while (e)
-  {
-    if (e % 2)
-    {
-      num *= m;
-    }
+/**
+ * Two digit decimal representations of the numbers from 0 to 99
+ */
+static const char ecma_decimal_digit_pairs[] = "00010203040506070809101112131415161718192021222324"
+                                               "25262728293031323334353637383940414243444546474849"
+                                               "50515253545556575859606162636465666768697071727374"
+                                               "75767778798081828384858687888990919293949596979899";
 
-    m *= m;
-    e /= 2;
-  }
+/**
+ * Write the last two decimal digits of a number in front of the buffer pointer.
+ *
+ * @return pointer to the first written digit
+ */
+static inline lit_utf8_byte_t *JERRY_ATTR_ALWAYS_INLINE
+ecma_write_digit_pair (lit_utf8_byte_t *buf_p, /**< end of the digits */
+                       uint32_t value) /**< value whose last two digits are written */
+{
+  const char *pair_p = ecma_decimal_digit_pairs + (value % 100) * 2;
 
-  return num;
-#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
-} /* ecma_utf8_string_to_number */
+  buf_p -= 2;
+  buf_p[0] = (lit_utf8_byte_t) pair_p[0];
+  buf_p[1] = (lit_utf8_byte_t) pair_p[1];
+  return buf_p;
+} /* ecma_write_digit_pair */
 
 /**
  * ECMA-defined conversion of UInt32 to String (zero-terminated).
@@ -664,16 +926,26 @@ ecma_uint32_to_utf8_string (uint32_t value, /**< value to convert */
 {
   lit_utf8_byte_t *buf_p = out_buffer_p + buffer_size;
 
-  do
+  while (value >= 100)
   {
-    JERRY_ASSERT (buf_p >= out_buffer_p);
+    JERRY_ASSERT (buf_p >= out_buffer_p + 2);
 
-    buf_p--;
-    *buf_p = (lit_utf8_byte_t) ((value % 10) + LIT_CHAR_0);
-    value /= 10;
-  } while (value != 0);
+    buf_p = ecma_write_digit_pair (buf_p, value);
+    value /= 100;
+  }
+
+  if (value >= 10)
+  {
+    JERRY_ASSERT (buf_p >= out_buffer_p + 2);
+    buf_p = ecma_write_digit_pair (buf_p, value);
+  }
+  else
+  {
+    JERRY_ASSERT (buf_p > out_buffer_p);
 
-  JERRY_ASSERT (buf_p >= out_buffer_p);
+    buf_p--;
+    *buf_p = (lit_utf8_byte_t) (value + LIT_CHAR_0);
+  }
 
   lit_utf8_size_t bytes_copied = (lit_utf8_size_t) (out_buffer_p + buffer_size - buf_p);
 
@@ -809,6 +1081,15 @@ ecma_number_to_decimal (ecma_number_t num, /**< ecma-number */
   JERRY_ASSERT (!ecma_number_is_infinity (num));
   JERRY_ASSERT (!ecma_number_is_negative (num));
 
+#if JERRY_NUMBER_TYPE_FLOAT64
+  lit_utf8_size_t length = ecma_grisu3_dtoa (num, out_digits_p, out_decimal_exp_p);
+
+  if (JERRY_LIKELY (length != 0))
+  {
+    return length;
+  }
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+
   return ecma_errol0_dtoa ((double) num, out_digits_p, out_decimal_exp_p);
 } /* ecma_number_to_decimal */
 
@@ -872,6 +1153,32 @@ ecma_number_to_utf8_string (ecma_number_t num, /**< ecma-number */
     return (lit_utf8_size_t) (dst_p - buffer_p);
   }
 
+#if JERRY_NUMBER_TYPE_FLOAT64
+  /* Integers up to 2^53 are printed as an upper part and nine zero padded lower digits. */
+  if (num < (ecma_number_t) (1ull << 53) && num == (ecma_number_t) (uint64_t) num)
+  {
+    uint64_t num_uint64 = (uint64_t) num;
+    uint32_t low_digits = (uint32_t) (num_uint64 % 1000000000u);
+
+    dst_p += ecma_uint32_to_utf8_string ((uint32_t) (num_uint64 / 1000000000u),
+                                         dst_p,
+                                         (lit_utf8_size_t) (buffer_p + buffer_size - dst_p));
+    dst_p += 9;
+    JERRY_ASSERT (dst_p <= buffer_p + buffer_size);
+
+    lit_utf8_byte_t *digits_p = dst_p;
+
+    for (int i = 0; i < 4; i++)
+    {
+      digits_p = ecma_write_digit_pair (digits_p, low_digits);
+      low_digits /= 100;
+    }
+
+    digits_p[-1] = (lit_utf8_byte_t) (low_digits + LIT_CHAR_0);
+    return (lit_utf8_size_t) (dst_p - buffer_p);
+  }
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+
   /* decimal exponent */
   int32_t n;
   /* number of digits in mantissa */
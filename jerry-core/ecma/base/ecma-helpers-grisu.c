@@ -0,0 +1,478 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers-number.h"
+#include "ecma-helpers.h"
+
+#include "lit-char-helpers.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmahelpers Helpers for operations with ECMA data types
+ * @{
+ */
+
+#if JERRY_NUMBER_TYPE_FLOAT64
+
+/**
+ * Printing Floating-Point Numbers Quickly and Accurately with Integers
+ *
+ * available at https://www.cs.tufts.edu/~nr/cs257/archive/florian-loitsch/printf.pdf
+ */
+
+/**
+ * Smallest binary exponent of the scaled numbers used by the digit generation
+ */
+#define GRISU_MIN_TARGET_EXPONENT (-60)
+
+/**
+ * Largest binary exponent of the scaled numbers used by the digit generation
+ */
+#define GRISU_MAX_TARGET_EXPONENT (-32)
+
+/**
+ * Hidden bit of a normalized double
+ */
+#define GRISU_HIDDEN_BIT (1ull << ECMA_NUMBER_FRACTION_WIDTH)
+
+/**
+ * Binary exponent of the denormal doubles
+ */
+#define GRISU_DENORMAL_EXPONENT (1 - ECMA_NUMBER_EXPONENT_BIAS - ECMA_NUMBER_FRACTION_WIDTH)
+
+/**
+ * Floating point number without implicit normalization: f * 2^e
+ */
+typedef struct
+{
+  uint64_t f; /**< significand */
+  int32_t e; /**< binary exponent */
+} ecma_diy_fp_t;
+
+/**
+ * Cached power of ten: f * 2^e ~= 10^k
+ */
+typedef struct
+{
+  uint64_t f; /**< normalized significand */
+  int16_t e; /**< binary exponent */
+  int16_t k; /**< decimal exponent */
+} ecma_grisu_cached_power_t;
+
+/**
+ * Normalized powers of ten from 10^-348 to 10^340 with a decimal step of 8
+ */
+static const ecma_grisu_cached_power_t ecma_grisu_cached_powers[] = {
+  { 0xfa8fd5a0081c0288ull, -1220, -348 },
+  { 0xbaaee17fa23ebf76ull, -1193, -340 },
+  { 0x8b16fb203055ac76ull, -1166, -332 },
+  { 0xcf42894a5dce35eaull, -1140, -324 },
+  { 0x9a6bb0aa55653b2dull, -1113, -316 },
+  { 0xe61acf033d1a45dfull, -1087, -308 },
+  { 0xab70fe17c79ac6caull, -1060, -300 },
+  { 0xff77b1fcbebcdc4full, -1034, -292 },
+  { 0xbe5691ef416bd60cull, -1007, -284 },
+  { 0x8dd01fad907ffc3cull, -980, -276 },
+  { 0xd3515c2831559a83ull, -954, -268 },
+  { 0x9d71ac8fada6c9b5ull, -927, -260 },
+  { 0xea9c227723ee8bcbull, -901, -252 },
+  { 0xaecc49914078536dull, -874, -244 },
+  { 0x823c12795db6ce57ull, -847, -236 },
+  { 0xc21094364dfb5637ull, -821, -228 },
+  { 0x9096ea6f3848984full, -794, -220 },
+  { 0xd77485cb25823ac7ull, -768, -212 },
+  { 0xa086cfcd97bf97f4ull, -741, -204 },
+  { 0xef340a98172aace5ull, -715, -196 },
+  { 0xb23867fb2a35b28eull, -688, -188 },
+  { 0x84c8d4dfd2c63f3bull, -661, -180 },
+  { 0xc5dd44271ad3cdbaull, -635, -172 },
+  { 0x936b9fcebb25c996ull, -608, -164 },
+  { 0xdbac6c247d62a584ull, -582, -156 },
+  { 0xa3ab66580d5fdaf6ull, -555, -148 },
+  { 0xf3e2f893dec3f126ull, -529, -140 },
+  { 0xb5b5ada8aaff80b8ull, -502, -132 },
+  { 0x87625f056c7c4a8bull, -475, -124 },
+  { 0xc9bcff6034c13053ull, -449, -116 },
+  { 0x964e858c91ba2655ull, -422, -108 },
+  { 0xdff9772470297ebdull, -396, -100 },
+  { 0xa6dfbd9fb8e5b88full, -369, -92 },
+  { 0xf8a95fcf88747d94ull, -343, -84 },
+  { 0xb94470938fa89bcfull, -316, -76 },
+  { 0x8a08f0f8bf0f156bull, -289, -68 },
+  { 0xcdb02555653131b6ull, -263, -60 },
+  { 0x993fe2c6d07b7facull, -236, -52 },
+  { 0xe45c10c42a2b3b06ull, -210, -44 },
+  { 0xaa242499697392d3ull, -183, -36 },
+  { 0xfd87b5f28300ca0eull, -157, -28 },
+  { 0xbce5086492111aebull, -130, -20 },
+  { 0x8cbccc096f5088ccull, -103, -12 },
+  { 0xd1b71758e219652cull, -77, -4 },
+  { 0x9c40000000000000ull, -50, 4 },
+  { 0xe8d4a51000000000ull, -24, 12 },
+  { 0xad78ebc5ac620000ull, 3, 20 },
+  { 0x813f3978f8940984ull, 30, 28 },
+  { 0xc097ce7bc90715b3ull, 56, 36 },
+  { 0x8f7e32ce7bea5c70ull, 83, 44 },
+  { 0xd5d238a4abe98068ull, 109, 52 },
+  { 0x9f4f2726179a2245ull, 136, 60 },
+  { 0xed63a231d4c4fb27ull, 162, 68 },
+  { 0xb0de65388cc8ada8ull, 189, 76 },
+  { 0x83c7088e1aab65dbull, 216, 84 },
+  { 0xc45d1df942711d9aull, 242, 92 },
+  { 0x924d692ca61be758ull, 269, 100 },
+  { 0xda01ee641a708deaull, 295, 108 },
+  { 0xa26da3999aef774aull, 322, 116 },
+  { 0xf209787bb47d6b85ull, 348, 124 },
+  { 0xb454e4a179dd1877ull, 375, 132 },
+  { 0x865b86925b9bc5c2ull, 402, 140 },
+  { 0xc83553c5c8965d3dull, 428, 148 },
+  { 0x952ab45cfa97a0b3ull, 455, 156 },
+  { 0xde469fbd99a05fe3ull, 481, 164 },
+  { 0xa59bc234db398c25ull, 508, 172 },
+  { 0xf6c69a72a3989f5cull, 534, 180 },
+  { 0xb7dcbf5354e9beceull, 561, 188 },
+  { 0x88fcf317f22241e2ull, 588, 196 },
+  { 0xcc20ce9bd35c78a5ull, 614, 204 },
+  { 0x98165af37b2153dfull, 641, 212 },
+  { 0xe2a0b5dc971f303aull, 667, 220 },
+  { 0xa8d9d1535ce3b396ull, 694, 228 },
+  { 0xfb9b7cd9a4a7443cull, 720, 236 },
+  { 0xbb764c4ca7a44410ull, 747, 244 },
+  { 0x8bab8eefb6409c1aull, 774, 252 },
+  { 0xd01fef10a657842cull, 800, 260 },
+  { 0x9b10a4e5e9913129ull, 827, 268 },
+  { 0xe7109bfba19c0c9dull, 853, 276 },
+  { 0xac2820d9623bf429ull, 880, 284 },
+  { 0x80444b5e7aa7cf85ull, 907, 292 },
+  { 0xbf21e44003acdd2dull, 933, 300 },
+  { 0x8e679c2f5e44ff8full, 960, 308 },
+  { 0xd433179d9c8cb841ull, 986, 316 },
+  { 0x9e19db92b4e31ba9ull, 1013, 324 },
+  { 0xeb96bf6ebadf77d9ull, 1039, 332 },
+  { 0xaf87023b9bf0ee6bull, 1066, 340 },
+};
+
+/**
+ * Powers of ten which fit into 32 bits
+ */
+static const uint32_t ecma_grisu_small_powers_of_10[] = { 1,      10,      100,      1000,      10000,
+                                                          100000, 1000000, 10000000, 100000000, 1000000000 };
+
+/**
+ * Shift the significand of a floating point number until its highest bit is set.
+ *
+ * @return normalized number
+ */
+static ecma_diy_fp_t
+ecma_grisu_normalize (ecma_diy_fp_t value) /**< number */
+{
+  JERRY_ASSERT (value.f != 0);
+
+  while ((value.f & (1ull << 63)) == 0)
+  {
+    value.f <<= 1;
+    value.e--;
+  }
+
+  return value;
+} /* ecma_grisu_normalize */
+
+/**
+ * Multiply two floating point numbers and round the result to 64 bits.
+ *
+ * @return product
+ */
+static ecma_diy_fp_t
+ecma_grisu_multiply (ecma_diy_fp_t x, /**< first operand */
+                     ecma_diy_fp_t y) /**< second operand */
+{
+  const uint64_t mask_32 = 0xffffffffull;
+
+  uint64_t a = x.f >> 32;
+  uint64_t b = x.f & mask_32;
+  uint64_t c = y.f >> 32;
+  uint64_t d = y.f & mask_32;
+
+  uint64_t ac = a * c;
+  uint64_t bc = b * c;
+  uint64_t ad = a * d;
+  uint64_t bd = b * d;
+
+  /* Round the dropped lower half. */
+  uint64_t middle = (bd >> 32) + (ad & mask_32) + (bc & mask_32) + (1ull << 31);
+
+  ecma_diy_fp_t result;
+  result.f = ac + (ad >> 32) + (bc >> 32) + (middle >> 32);
+  result.e = x.e + y.e + 64;
+  return result;
+} /* ecma_grisu_multiply */
+
+/**
+ * Select the cached power of ten which moves the binary exponent of a number
+ * into the [GRISU_MIN_TARGET_EXPONENT, GRISU_MAX_TARGET_EXPONENT] range.
+ *
+ * @return cached power
+ */
+static const ecma_grisu_cached_power_t *
+ecma_grisu_get_cached_power (int32_t exponent) /**< binary exponent of the normalized number */
+{
+  int32_t min_exponent = GRISU_MIN_TARGET_EXPONENT - exponent - 64;
+  int32_t max_exponent = GRISU_MAX_TARGET_EXPONENT - exponent - 64;
+  const int32_t last_index = (int32_t) (sizeof (ecma_grisu_cached_powers) / sizeof (ecma_grisu_cached_power_t)) - 1;
+
+  /* The binary exponents of the table grow by ~26.575 per entry. */
+  int32_t index = ((min_exponent - ecma_grisu_cached_powers[0].e) * 1000 + 26574) / 26575;
+
+  if (index < 0)
+  {
+    index = 0;
+  }
+  else if (index > last_index)
+  {
+    index = last_index;
+  }
+
+  while (index < last_index && ecma_grisu_cached_powers[index].e < min_exponent)
+  {
+    index++;
+  }
+
+  while (index > 0 && ecma_grisu_cached_powers[index].e > max_exponent)
+  {
+    index--;
+  }
+
+  JERRY_ASSERT (ecma_grisu_cached_powers[index].e >= min_exponent);
+  JERRY_ASSERT (ecma_grisu_cached_powers[index].e <= max_exponent);
+
+  return ecma_grisu_cached_powers + index;
+} /* ecma_grisu_get_cached_power */
+
+/**
+ * Move the last generated digit towards the scaled value as long as
+ * the result stays inside the safe interval, then check that the
+ * result is provably the closest shortest representation.
+ *
+ * @return true - if the digits are correct
+ *         false - otherwise
+ */
+static bool
+ecma_grisu_round_weed (lit_utf8_byte_t *last_digit_p, /**< last generated digit */
+                       uint64_t distance_too_high_w, /**< distance between the upper bound and the value */
+                       uint64_t unsafe_interval, /**< size of the unsafe interval */
+                       uint64_t rest, /**< distance between the upper bound and the digits */
+                       uint64_t ten_kappa, /**< value of one unit of the last digit */
+                       uint64_t unit) /**< maximum error of the computation */
+{
+  uint64_t small_distance = distance_too_high_w - unit;
+  uint64_t big_distance = distance_too_high_w + unit;
+
+  while (rest < small_distance && unsafe_interval - rest >= ten_kappa
+         && (rest + ten_kappa < small_distance || small_distance - rest >= rest + ten_kappa - small_distance))
+  {
+    (*last_digit_p)--;
+    rest += ten_kappa;
+  }
+
+  if (rest < big_distance && unsafe_interval - rest >= ten_kappa
+      && (rest + ten_kappa < big_distance || big_distance - rest > rest + ten_kappa - big_distance))
+  {
+    return false;
+  }
+
+  return (2 * unit <= rest) && (rest <= unsafe_interval - 4 * unit);
+} /* ecma_grisu_round_weed */
+
+/**
+ * Generate the shortest digit sequence between the scaled boundaries.
+ *
+ * @return number of generated digits - if the digits are correct
+ *         0 - otherwise
+ */
+static lit_utf8_size_t
+ecma_grisu_digit_gen (ecma_diy_fp_t low, /**< scaled lower boundary */
+                      ecma_diy_fp_t w, /**< scaled value */
+                      ecma_diy_fp_t high, /**< scaled upper boundary */
+                      lit_utf8_byte_t *buffer_p, /**< [out] digits */
+                      int32_t *kappa_p) /**< [out] decimal exponent of the last digit */
+{
+  JERRY_ASSERT (low.e == w.e && w.e == high.e);
+  JERRY_ASSERT (w.e >= GRISU_MIN_TARGET_EXPONENT && w.e <= GRISU_MAX_TARGET_EXPONENT);
+
+  uint64_t unit = 1;
+  uint64_t too_low = low.f - unit;
+  uint64_t too_high = high.f + unit;
+  uint64_t unsafe_interval = too_high - too_low;
+
+  uint32_t one_shift = (uint32_t) -w.e;
+  uint64_t one_mask = (1ull << one_shift) - 1;
+
+  uint32_t integrals = (uint32_t) (too_high >> one_shift);
+  uint64_t fractionals = too_high & one_mask;
+
+  int32_t kappa = 10;
+
+  while (kappa > 1 && integrals < ecma_grisu_small_powers_of_10[kappa - 1])
+  {
+    kappa--;
+  }
+
+  lit_utf8_byte_t *dst_p = buffer_p;
+
+  while (kappa > 0)
+  {
+    uint32_t divisor = ecma_grisu_small_powers_of_10[kappa - 1];
+
+    *dst_p++ = (lit_utf8_byte_t) (LIT_CHAR_0 + integrals / divisor);
+    integrals %= divisor;
+    kappa--;
+
+    uint64_t rest = ((uint64_t) integrals << one_shift) + fractionals;
+
+    if (rest < unsafe_interval)
+    {
+      *kappa_p = kappa;
+
+      if (!ecma_grisu_round_weed (dst_p - 1,
+                                  too_high - w.f,
+                                  unsafe_interval,
+                                  rest,
+                                  (uint64_t) divisor << one_shift,
+                                  unit))
+      {
+        return 0;
+      }
+
+      return (lit_utf8_size_t) (dst_p - buffer_p);
+    }
+  }
+
+  while (true)
+  {
+    fractionals *= 10;
+    unit *= 10;
+    unsafe_interval *= 10;
+
+    *dst_p++ = (lit_utf8_byte_t) (LIT_CHAR_0 + (fractionals >> one_shift));
+    fractionals &= one_mask;
+    kappa--;
+
+    if (fractionals < unsafe_interval)
+    {
+      *kappa_p = kappa;
+
+      if (!ecma_grisu_round_weed (dst_p - 1,
+                                  (too_high - w.f) * unit,
+                                  unsafe_interval,
+                                  fractionals,
+                                  1ull << one_shift,
+                                  unit))
+      {
+        return 0;
+      }
+
+      return (lit_utf8_size_t) (dst_p - buffer_p);
+    }
+  }
+} /* ecma_grisu_digit_gen */
+
+/**
+ * Grisu3 double to ASCII conversion.
+ *
+ * The generated digits are the shortest sequence which reads back as the same
+ * double and among those the closest to the exact value. The algorithm rejects
+ * about 0.5% of the inputs, these must be converted by a slower method.
+ *
+ * @return number of generated digits - if the conversion succeeded
+ *         0 - otherwise
+ */
+lit_utf8_size_t
+ecma_grisu3_dtoa (double val, /**< ecma number */
+                  lit_utf8_byte_t *buffer_p, /**< buffer to generate digits into */
+                  int32_t *exp_p) /**< [out] exponent */
+{
+  JERRY_ASSERT (val > 0 && !ecma_number_is_infinity ((ecma_number_t) val));
+
+  ecma_binary_num_t binary = ecma_number_to_binary ((ecma_number_t) val);
+  uint32_t biased_exp = ecma_number_biased_exp (binary);
+
+  ecma_diy_fp_t v;
+  v.f = ecma_number_fraction (binary);
+
+  if (biased_exp == 0)
+  {
+    v.e = GRISU_DENORMAL_EXPONENT;
+  }
+  else
+  {
+    v.f += GRISU_HIDDEN_BIT;
+    v.e = (int32_t) biased_exp - ECMA_NUMBER_EXPONENT_BIAS - ECMA_NUMBER_FRACTION_WIDTH;
+  }
+
+  /* The boundaries are halfway between the value and its neighbours. The lower
+   * neighbour is closer when the significand is a power of two. */
+  ecma_diy_fp_t high;
+  high.f = (v.f << 1) + 1;
+  high.e = v.e - 1;
+  high = ecma_grisu_normalize (high);
+
+  ecma_diy_fp_t low;
+
+  if (v.f == GRISU_HIDDEN_BIT && biased_exp > 1)
+  {
+    low.f = (v.f << 2) - 1;
+    low.e = v.e - 2;
+  }
+  else
+  {
+    low.f = (v.f << 1) - 1;
+    low.e = v.e - 1;
+  }
+
+  low.f <<= low.e - high.e;
+  low.e = high.e;
+
+  ecma_diy_fp_t w = ecma_grisu_normalize (v);
+  JERRY_ASSERT (w.e == high.e);
+
+  const ecma_grisu_cached_power_t *cached_power_p = ecma_grisu_get_cached_power (w.e);
+
+  ecma_diy_fp_t c_mk;
+  c_mk.f = cached_power_p->f;
+  c_mk.e = cached_power_p->e;
+
+  int32_t kappa;
+  lit_utf8_size_t length = ecma_grisu_digit_gen (ecma_grisu_multiply (low, c_mk),
+                                                 ecma_grisu_multiply (w, c_mk),
+                                                 ecma_grisu_multiply (high, c_mk),
+                                                 buffer_p,
+                                                 &kappa);
+
+  if (length == 0)
+  {
+    return 0;
+  }
+
+  *exp_p = (int32_t) length + kappa - cached_power_p->k;
+  return length;
+} /* ecma_grisu3_dtoa */
+
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+
+/**
+ * @}
+ * @}
+ */
@@ -45,6 +45,9 @@ JERRY_STATIC_ASSERT (ECMA_STRING_NOT_ARRAY_INDEX == UINT32_MAX,
 
 JERRY_STATIC_ASSERT ((ECMA_TYPE_DIRECT_STRING & 0x1) != 0, ecma_type_direct_string_must_be_odd_number);
 
+JERRY_STATIC_ASSERT (sizeof (ecma_stringbuilder_header_t) <= ECMA_ASCII_STRING_HEADER_SIZE,
+                     ecma_stringbuilder_header_must_fit_into_the_ascii_string_header);
+
 JERRY_STATIC_ASSERT (LIT_MAGIC_STRING__COUNT <= ECMA_DIRECT_STRING_MAX_IMM,
                      all_magic_strings_must_be_encoded_as_direct_string);
 
@@ -292,7 +295,7 @@ ecma_new_ecma_string_from_utf8_buffer (lit_utf8_size_t length, /**< length of th
  * @return pointer to ecma string with the special representation
  *         NULL, if there is no special representation for the string
  */
-static ecma_string_t *
+ecma_string_t *
 ecma_find_special_string (const lit_utf8_byte_t *string_p, /**< utf8 string */
                           lit_utf8_size_t string_size) /**< string size */
 {
@@ -2443,6 +2446,7 @@ ecma_stringbuilder_create (void)
   const lit_utf8_size_t initial_size = ECMA_ASCII_STRING_HEADER_SIZE;
   ecma_stringbuilder_header_t *header_p = (ecma_stringbuilder_header_t *) jmem_heap_alloc_block (initial_size);
   header_p->current_size = initial_size;
+  header_p->allocated_size = initial_size;
 #if JERRY_MEM_STATS
   jmem_stats_allocate_string_bytes (initial_size);
 #endif /* JERRY_MEM_STATS */
@@ -2464,6 +2468,7 @@ ecma_stringbuilder_create_from (ecma_string_t *string_p) /**< ecma string */
 
   ecma_stringbuilder_header_t *header_p = (ecma_stringbuilder_header_t *) jmem_heap_alloc_block (initial_size);
   header_p->current_size = initial_size;
+  header_p->allocated_size = initial_size;
 #if JERRY_MEM_STATS
   jmem_stats_allocate_string_bytes (initial_size);
 #endif /* JERRY_MEM_STATS */
@@ -2487,6 +2492,7 @@ ecma_stringbuilder_create_raw (const lit_utf8_byte_t *data_p, /**< pointer to da
 
   ecma_stringbuilder_header_t *header_p = (ecma_stringbuilder_header_t *) jmem_heap_alloc_block (initial_size);
   header_p->current_size = initial_size;
+  header_p->allocated_size = initial_size;
 #if JERRY_MEM_STATS
   jmem_stats_allocate_string_bytes (initial_size);
 #endif /* JERRY_MEM_STATS */
@@ -2500,6 +2506,10 @@ ecma_stringbuilder_create_raw (const lit_utf8_byte_t *data_p, /**< pointer to da
 /**
  * Grow the underlying buffer of a string builder
  *
+ * Note:
+ *      the buffer is enlarged with some extra space, so consecutive appends
+ *      do not need to reallocate the buffer every time
+ *
  * @return pointer to the end of the data in the underlying buffer
  */
 static lit_utf8_byte_t *
@@ -2510,15 +2520,24 @@ ecma_stringbuilder_grow (ecma_stringbuilder_t *builder_p, /**< string builder */
   JERRY_ASSERT (header_p != NULL);
 
   const lit_utf8_size_t new_size = header_p->current_size + required_size;
-  header_p = jmem_heap_realloc_block (header_p, header_p->current_size, new_size);
-  header_p->current_size = new_size;
-  builder_p->header_p = header_p;
+
+  if (JERRY_UNLIKELY (new_size > header_p->allocated_size))
+  {
+    const lit_utf8_size_t old_allocated_size = header_p->allocated_size;
+    lit_utf8_size_t new_allocated_size = new_size + JERRY_MIN (new_size >> 1, ECMA_STRINGBUILDER_MAX_RESERVE);
+    new_allocated_size = JERRY_ALIGNUP (new_allocated_size, JMEM_ALIGNMENT);
+
+    header_p = jmem_heap_realloc_block (header_p, old_allocated_size, new_allocated_size);
+    header_p->allocated_size = new_allocated_size;
+    builder_p->header_p = header_p;
 
 #if JERRY_MEM_STATS
-  jmem_stats_allocate_string_bytes (required_size);
+    jmem_stats_allocate_string_bytes (new_allocated_size - old_allocated_size);
 #endif /* JERRY_MEM_STATS */
+  }
 
-  return ((lit_utf8_byte_t *) header_p) + header_p->current_size - required_size;
+  header_p->current_size = new_size;
+  return ((lit_utf8_byte_t *) header_p) + new_size - required_size;
 } /* ecma_stringbuilder_grow */
 
 /**
@@ -2562,13 +2581,8 @@ ecma_stringbuilder_revert (ecma_stringbuilder_t *builder_p, /**< string builder
   const lit_utf8_size_t new_size = size + ECMA_ASCII_STRING_HEADER_SIZE;
   JERRY_ASSERT (new_size <= header_p->current_size);
 
-#if JERRY_MEM_STATS
-  jmem_stats_free_string_bytes (header_p->current_size - new_size);
-#endif /* JERRY_MEM_STATS */
-
-  header_p = jmem_heap_realloc_block (header_p, header_p->current_size, new_size);
+  /* The released space is kept for the subsequent appends. */
   header_p->current_size = new_size;
-  builder_p->header_p = header_p;
 } /* ecma_stringbuilder_revert */
 
 /**
@@ -2658,6 +2672,17 @@ ecma_stringbuilder_finalize (ecma_stringbuilder_t *builder_p) /**< string builde
   ecma_stringbuilder_header_t *header_p = builder_p->header_p;
   JERRY_ASSERT (header_p != NULL);
 
+  if (header_p->allocated_size > header_p->current_size)
+  {
+#if JERRY_MEM_STATS
+    jmem_stats_free_string_bytes (header_p->allocated_size - header_p->current_size);
+#endif /* JERRY_MEM_STATS */
+
+    header_p = jmem_heap_realloc_block (header_p, header_p->allocated_size, header_p->current_size);
+    header_p->allocated_size = header_p->current_size;
+    builder_p->header_p = header_p;
+  }
+
   const lit_utf8_size_t string_size = ECMA_STRINGBUILDER_STRING_SIZE (header_p);
   lit_utf8_byte_t *string_begin_p = ECMA_STRINGBUILDER_STRING_PTR (header_p);
 
@@ -2732,7 +2757,7 @@ void
 ecma_stringbuilder_destroy (ecma_stringbuilder_t *builder_p) /**< string builder */
 {
   JERRY_ASSERT (builder_p->header_p != NULL);
-  const lit_utf8_size_t size = builder_p->header_p->current_size;
+  const lit_utf8_size_t size = builder_p->header_p->allocated_size;
   jmem_heap_free_block (builder_p->header_p, size);
 
 #ifndef JERRY_NDEBUG
@@ -978,7 +978,7 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
     return;
   }
 
-  if (ecma_get_value_type_field (ecma_value || *value_p) == ECMA_TYPE_DIRECT)
+  if (ecma_get_value_type_field (ecma_value | *value_p) == ECMA_TYPE_DIRECT)
   {
     *value_p = ecma_value;
   }
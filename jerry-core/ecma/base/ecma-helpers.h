@@ -281,6 +281,7 @@ ecma_string_t *ecma_new_map_key_string (ecma_value_t value);
 bool ecma_prop_name_is_map_key (ecma_string_t *string_p);
 #endif /* JERRY_BUILTIN_CONTAINER */
 ecma_string_t *ecma_new_ecma_string_from_ascii (const lit_utf8_byte_t *string_p, lit_utf8_size_t string_size);
+ecma_string_t *ecma_find_special_string (const lit_utf8_byte_t *string_p, lit_utf8_size_t string_size);
 ecma_string_t *ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, lit_utf8_size_t string_size);
 ecma_string_t *ecma_new_ecma_string_from_utf8_converted_to_cesu8 (const lit_utf8_byte_t *string_p,
                                                                   lit_utf8_size_t string_size);
@@ -503,6 +504,7 @@ ecma_native_pointer_t *ecma_get_native_pointer_value (ecma_object_t *obj_p,
 bool ecma_delete_native_pointer_property (ecma_object_t *obj_p, const jerry_object_native_info_t *native_info_p);
 
 /* ecma-helpers-conversion.c */
+ecma_number_t ecma_number_from_decimal (uint64_t significand, int32_t decimal_exponent, bool sign);
 ecma_number_t ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, lit_utf8_size_t str_size, uint32_t option);
 ecma_number_t ecma_utf8_string_to_number_by_radix (const lit_utf8_byte_t *str_p,
                                                    lit_utf8_size_t str_size,
@@ -516,6 +518,11 @@ lit_utf8_size_t ecma_number_to_utf8_string (ecma_number_t num, lit_utf8_byte_t *
 /* ecma-helpers-errol.c */
 lit_utf8_size_t ecma_errol0_dtoa (double val, lit_utf8_byte_t *buffer_p, int32_t *exp_p);
 
+/* ecma-helpers-grisu.c */
+#if JERRY_NUMBER_TYPE_FLOAT64
+lit_utf8_size_t ecma_grisu3_dtoa (double val, lit_utf8_byte_t *buffer_p, int32_t *exp_p);
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+
 /**
  * @}
  * @}
@@ -16,6 +16,7 @@
 #include "ecma-init-finalize.h"
 
 #include "ecma-builtins.h"
+#include "ecma-eval.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
@@ -65,6 +66,10 @@ ecma_init (void)
 #if JERRY_BUILTIN_TYPEDARRAY
   JERRY_CONTEXT (arraybuffer_compact_allocation_limit) = 256;
 #endif /* JERRY_BUILTIN_TYPEDARRAY */
+
+#if JERRY_BUILTIN_DATE
+  JERRY_CONTEXT (date_cache).day = INT32_MIN;
+#endif /* JERRY_BUILTIN_DATE */
 } /* ecma_init */
 
 /**
@@ -75,6 +80,10 @@ ecma_finalize (void)
 {
   JERRY_ASSERT (JERRY_CONTEXT (current_new_target_p) == NULL);
 
+#if JERRY_PARSER
+  ecma_eval_cache_free ();
+#endif /* JERRY_PARSER */
+
   ecma_finalize_global_environment ();
   uint8_t runs = 0;
 
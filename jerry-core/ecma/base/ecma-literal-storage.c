@@ -29,6 +29,11 @@
  * @{
  */
 
+/**
+ * Number of literal strings from which the literal string list is searched with a hash index
+ */
+#define ECMA_LIT_STORAGE_STRING_INDEX_MIN_COUNT 128
+
 /**
  * Free symbol list
  */
@@ -144,6 +149,7 @@ ecma_free_bigint_list (jmem_cpointer_t bigint_list_cp) /**< bigint list */
 void
 ecma_finalize_lit_storage (void)
 {
+  ecma_lit_storage_free_string_index ();
   ecma_free_symbol_list (JERRY_CONTEXT (symbol_list_first_cp));
   ecma_free_string_list (JERRY_CONTEXT (string_list_first_cp));
   ecma_free_number_list (JERRY_CONTEXT (number_list_first_cp));
@@ -152,6 +158,174 @@ ecma_finalize_lit_storage (void)
 #endif /* JERRY_BUILTIN_BIGINT */
 } /* ecma_finalize_lit_storage */
 
+/**
+ * Free the hash index of the literal string list
+ *
+ * Note:
+ *      the list is searched linearly until the index is rebuilt
+ */
+void
+ecma_lit_storage_free_string_index (void)
+{
+  if (JERRY_CONTEXT (string_index_p) != NULL)
+  {
+    jmem_heap_free_block (JERRY_CONTEXT (string_index_p), JERRY_CONTEXT (string_index_size) * sizeof (jmem_cpointer_t));
+    JERRY_CONTEXT (string_index_p) = NULL;
+    JERRY_CONTEXT (string_index_size) = 0;
+  }
+} /* ecma_lit_storage_free_string_index */
+
+/**
+ * Add a literal string to a hash index
+ */
+static void
+ecma_lit_storage_index_string (jmem_cpointer_t *index_p, /**< hash index */
+                               uint32_t index_size, /**< number of slots of the index */
+                               jmem_cpointer_t string_cp) /**< compressed pointer of the string */
+{
+  ecma_string_t *string_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, string_cp);
+  uint32_t slot = ecma_string_hash (string_p) % index_size;
+
+  while (index_p[slot] != JMEM_CP_NULL)
+  {
+    if (++slot == index_size)
+    {
+      slot = 0;
+    }
+  }
+
+  index_p[slot] = string_cp;
+} /* ecma_lit_storage_index_string */
+
+/**
+ * Build the hash index of the literal string list
+ *
+ * Note:
+ *      the index is dropped if there is not enough memory
+ */
+static void
+ecma_lit_storage_build_string_index (void)
+{
+  /* The index is two thirds full after it is built. */
+  uint32_t index_size = JERRY_CONTEXT (string_list_count) + (JERRY_CONTEXT (string_list_count) >> 1);
+
+  size_t index_byte_size = index_size * sizeof (jmem_cpointer_t);
+  jmem_cpointer_t *index_p = (jmem_cpointer_t *) jmem_heap_alloc_block_null_on_error (index_byte_size);
+
+  /* The current index might have been freed by the allocation above. */
+  ecma_lit_storage_free_string_index ();
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  memset (index_p, 0, index_byte_size);
+
+  jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
+
+  while (string_list_cp != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
+
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (string_list_p->values[i] != JMEM_CP_NULL)
+      {
+        ecma_lit_storage_index_string (index_p, index_size, string_list_p->values[i]);
+      }
+    }
+
+    string_list_cp = string_list_p->next_cp;
+  }
+
+  JERRY_CONTEXT (string_index_p) = index_p;
+  JERRY_CONTEXT (string_index_size) = index_size;
+} /* ecma_lit_storage_build_string_index */
+
+/**
+ * Get the first empty slot of the literal string list when the list is searched with the hash index
+ *
+ * @return pointer to the empty slot, NULL if there is no such slot
+ */
+static jmem_cpointer_t *
+ecma_lit_storage_get_empty_string_slot (void)
+{
+  jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
+
+  /* Literal strings are never removed, so only the first item can have empty slots. */
+  if (string_list_cp != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
+
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (string_list_p->values[i] == JMEM_CP_NULL)
+      {
+        return string_list_p->values + i;
+      }
+    }
+  }
+
+  return NULL;
+} /* ecma_lit_storage_get_empty_string_slot */
+
+/**
+ * Insert a string into the literal string list.
+ *
+ * @return ecma value of the string
+ */
+static ecma_value_t
+ecma_lit_storage_insert_string (ecma_string_t *string_p, /**< string to be inserted */
+                                jmem_cpointer_t *empty_cpointer_p) /**< first empty slot of the list
+                                                                    *   or NULL if there is no such slot */
+{
+  ECMA_SET_STRING_AS_STATIC (string_p);
+  jmem_cpointer_t result;
+  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
+
+  if (empty_cpointer_p != NULL)
+  {
+    *empty_cpointer_p = result;
+  }
+  else
+  {
+    ecma_lit_storage_item_t *new_item_p;
+    new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+
+    new_item_p->values[0] = result;
+    for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      new_item_p->values[i] = JMEM_CP_NULL;
+    }
+
+    new_item_p->next_cp = JERRY_CONTEXT (string_list_first_cp);
+    JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (string_list_first_cp), new_item_p);
+  }
+
+  uint32_t string_count = ++JERRY_CONTEXT (string_list_count);
+  uint32_t index_size = JERRY_CONTEXT (string_index_size);
+
+  if (JERRY_CONTEXT (string_index_p) != NULL)
+  {
+    /* The load factor of the index is kept below 7/8. */
+    if (string_count > index_size - (index_size >> 3))
+    {
+      ecma_lit_storage_build_string_index ();
+    }
+    else
+    {
+      ecma_lit_storage_index_string (JERRY_CONTEXT (string_index_p), index_size, result);
+    }
+  }
+  else if (string_count >= ECMA_LIT_STORAGE_STRING_INDEX_MIN_COUNT && (string_count & (string_count - 1)) == 0)
+  {
+    ecma_lit_storage_build_string_index ();
+  }
+
+  return ecma_make_string_value (string_p);
+} /* ecma_lit_storage_insert_string */
+
 /**
  * Find or create a literal string.
  *
@@ -170,6 +344,32 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
     return ecma_make_string_value (string_p);
   }
 
+  jmem_cpointer_t *index_p = JERRY_CONTEXT (string_index_p);
+
+  if (index_p != NULL)
+  {
+    uint32_t index_size = JERRY_CONTEXT (string_index_size);
+    uint32_t slot = ecma_string_hash (string_p) % index_size;
+
+    while (index_p[slot] != JMEM_CP_NULL)
+    {
+      ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, index_p[slot]);
+
+      if (ecma_compare_ecma_strings (string_p, value_p))
+      {
+        ecma_deref_ecma_string (string_p);
+        return ecma_make_string_value (value_p);
+      }
+
+      if (++slot == index_size)
+      {
+        slot = 0;
+      }
+    }
+
+    return ecma_lit_storage_insert_string (string_p, ecma_lit_storage_get_empty_string_slot ());
+  }
+
   jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
   jmem_cpointer_t *empty_cpointer_p = NULL;
 
@@ -202,29 +402,7 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
     string_list_cp = string_list_p->next_cp;
   }
 
-  ECMA_SET_STRING_AS_STATIC (string_p);
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
-
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return ecma_make_string_value (string_p);
-  }
-
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = JERRY_CONTEXT (string_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (string_list_first_cp), new_item_p);
-
-  return ecma_make_string_value (string_p);
+  return ecma_lit_storage_insert_string (string_p, empty_cpointer_p);
 } /* ecma_find_or_create_literal_string */
 
 /**
@@ -402,6 +580,11 @@ ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searc
 #define JERRY_SNAPSHOT_LITERAL_IS_BIGINT (2u << ECMA_VALUE_SHIFT)
 #endif /* JERRY_BUILTIN_BIGINT */
 
+/**
+ * Size of the header of string literals: the size and the hash of the string.
+ */
+#define JERRY_SNAPSHOT_LITERAL_STRING_HEADER_SIZE (sizeof (uint16_t) + sizeof (lit_string_hash_t))
+
 #if JERRY_SNAPSHOT_SAVE
 
 /**
@@ -562,7 +745,8 @@ ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, /**< list of kno
     {
       ecma_string_t *string_p = ecma_get_string_from_value (lit_buffer_p[i]);
 
-      lit_table_size += (uint32_t) JERRY_ALIGNUP (sizeof (uint16_t) + ecma_string_get_size (string_p),
+      lit_table_size += (uint32_t) JERRY_ALIGNUP (JERRY_SNAPSHOT_LITERAL_STRING_HEADER_SIZE
+                                                    + ecma_string_get_size (string_p),
                                                   JERRY_SNAPSHOT_LITERAL_ALIGNMENT);
     }
 
@@ -629,9 +813,14 @@ ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, /**< list of kno
 
       *(uint16_t *) destination_p = (uint16_t) length;
 
-      ecma_string_to_cesu8_bytes (string_p, destination_p + sizeof (uint16_t), length);
+      lit_utf8_byte_t *chars_p = destination_p + JERRY_SNAPSHOT_LITERAL_STRING_HEADER_SIZE;
+      ecma_string_to_cesu8_bytes (string_p, chars_p, length);
+
+      /* The hash is stored as well, so the string can be searched without creating it first. */
+      lit_string_hash_t hash = lit_utf8_string_calc_hash (chars_p, length);
+      memcpy (destination_p + sizeof (uint16_t), &hash, sizeof (lit_string_hash_t));
 
-      length = JERRY_ALIGNUP (sizeof (uint16_t) + length, JERRY_SNAPSHOT_LITERAL_ALIGNMENT);
+      length = JERRY_ALIGNUP (JERRY_SNAPSHOT_LITERAL_STRING_HEADER_SIZE + length, JERRY_SNAPSHOT_LITERAL_ALIGNMENT);
     }
 
     JERRY_ASSERT ((length % sizeof (uint16_t)) == 0);
@@ -649,6 +838,123 @@ ecma_save_literals_for_snapshot (ecma_collection_t *lit_pool_p, /**< list of kno
 
 #if JERRY_SNAPSHOT_EXEC || JERRY_SNAPSHOT_SAVE
 
+/**
+ * Compare a literal string with a string stored in a snapshot.
+ *
+ * @return true - if the strings are equal
+ *         false - otherwise
+ */
+static bool
+ecma_snapshot_compare_literal_string (ecma_string_t *value_p, /**< literal string */
+                                      const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                                      lit_utf8_size_t size, /**< size of the string */
+                                      lit_string_hash_t hash) /**< hash of the string */
+{
+  ecma_string_container_t container = ECMA_STRING_GET_CONTAINER (value_p);
+
+  /* Only these containers store the hash of the string. */
+  if (value_p->u.hash != hash
+      || (container != ECMA_STRING_CONTAINER_HEAP_UTF8_STRING
+          && container != ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+          && container != ECMA_STRING_CONTAINER_HEAP_ASCII_STRING))
+  {
+    return false;
+  }
+
+  bool is_equal;
+
+  ECMA_STRING_TO_UTF8_STRING (value_p, value_chars_p, value_size);
+  is_equal = (value_size == size && memcmp (value_chars_p, chars_p, size) == 0);
+  ECMA_FINALIZE_UTF8_STRING (value_chars_p, value_size);
+
+  return is_equal;
+} /* ecma_snapshot_compare_literal_string */
+
+/**
+ * Find or create a literal string stored in a snapshot.
+ *
+ * Note:
+ *      unlike ecma_find_or_create_literal_string, no string is created
+ *      when the string is already present in the literal storage
+ *
+ * @return ecma value of the string
+ */
+static ecma_value_t
+ecma_snapshot_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                                             lit_utf8_size_t size, /**< size of the string */
+                                             lit_string_hash_t hash) /**< hash of the string */
+{
+  ecma_string_t *string_p = ecma_find_special_string (chars_p, size);
+
+  if (string_p != NULL)
+  {
+    if (ECMA_IS_DIRECT_STRING (string_p))
+    {
+      return ecma_make_string_value (string_p);
+    }
+
+    ecma_deref_ecma_string (string_p);
+    return ecma_find_or_create_literal_string (chars_p, size, false);
+  }
+
+  jmem_cpointer_t *index_p = JERRY_CONTEXT (string_index_p);
+
+  if (index_p != NULL)
+  {
+    uint32_t index_size = JERRY_CONTEXT (string_index_size);
+    uint32_t slot = hash % index_size;
+
+    while (index_p[slot] != JMEM_CP_NULL)
+    {
+      ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, index_p[slot]);
+
+      if (ecma_snapshot_compare_literal_string (value_p, chars_p, size, hash))
+      {
+        return ecma_make_string_value (value_p);
+      }
+
+      if (++slot == index_size)
+      {
+        slot = 0;
+      }
+    }
+
+    return ecma_lit_storage_insert_string (ecma_new_ecma_string_from_utf8 (chars_p, size),
+                                           ecma_lit_storage_get_empty_string_slot ());
+  }
+
+  jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
+  jmem_cpointer_t *empty_cpointer_p = NULL;
+
+  while (string_list_cp != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
+
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (string_list_p->values[i] == JMEM_CP_NULL)
+      {
+        if (empty_cpointer_p == NULL)
+        {
+          empty_cpointer_p = string_list_p->values + i;
+        }
+        continue;
+      }
+
+      ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, string_list_p->values[i]);
+
+      if (ecma_snapshot_compare_literal_string (value_p, chars_p, size, hash))
+      {
+        return ecma_make_string_value (value_p);
+      }
+    }
+
+    string_list_cp = string_list_p->next_cp;
+  }
+
+  return ecma_lit_storage_insert_string (ecma_new_ecma_string_from_utf8 (chars_p, size), empty_cpointer_p);
+} /* ecma_snapshot_find_or_create_literal_string */
+
 /**
  * Get the compressed pointer of a given literal.
  *
@@ -692,8 +998,12 @@ ecma_snapshot_get_literal (const uint8_t *literal_base_p, /**< literal start */
 #endif /* JERRY_BUILTIN_BIGINT */
 
   uint16_t length = *(const uint16_t *) literal_p;
+  lit_string_hash_t hash;
+  memcpy (&hash, literal_p + sizeof (uint16_t), sizeof (lit_string_hash_t));
 
-  return ecma_find_or_create_literal_string (literal_p + sizeof (uint16_t), length, false);
+  return ecma_snapshot_find_or_create_literal_string (literal_p + JERRY_SNAPSHOT_LITERAL_STRING_HEADER_SIZE,
+                                                      length,
+                                                      hash);
 } /* ecma_snapshot_get_literal */
 
 /**
@@ -40,6 +40,7 @@ typedef struct
 #endif /* JERRY_SNAPSHOT_SAVE */
 
 void ecma_finalize_lit_storage (void);
+void ecma_lit_storage_free_string_index (void);
 
 ecma_value_t ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, lit_utf8_size_t size, bool is_ascii);
 ecma_value_t ecma_find_or_create_literal_number (ecma_number_t number_arg);
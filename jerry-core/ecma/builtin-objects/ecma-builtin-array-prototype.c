@@ -1008,6 +1008,99 @@ ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t lhs, /**<
   return ecma_make_number_value (result);
 } /* ecma_builtin_array_prototype_object_sort_compare_helper */
 
+/**
+ * Default SortCompare for arrays of strings.
+ *
+ * @return ecma value
+ */
+static ecma_value_t
+ecma_builtin_array_prototype_object_sort_compare_strings (ecma_value_t lhs, /**< left string */
+                                                          ecma_value_t rhs, /**< right string */
+                                                          ecma_value_t compare_func, /**< compare function */
+                                                          ecma_object_t *array_buffer_p) /**< arrayBuffer */
+{
+  JERRY_UNUSED (compare_func);
+  JERRY_UNUSED (array_buffer_p);
+
+  ecma_string_t *lhs_str_p = ecma_get_string_from_value (lhs);
+  ecma_string_t *rhs_str_p = ecma_get_string_from_value (rhs);
+
+  if (ecma_compare_ecma_strings_relational (lhs_str_p, rhs_str_p))
+  {
+    return ecma_make_integer_value (-1);
+  }
+
+  return ecma_make_integer_value (ecma_compare_ecma_strings (lhs_str_p, rhs_str_p) ? 0 : 1);
+} /* ecma_builtin_array_prototype_object_sort_compare_strings */
+
+/**
+ * Default SortCompare for arrays of numbers.
+ *
+ * Note:
+ *      the string forms of the numbers are compared without creating string values
+ *
+ * @return ecma value
+ */
+static ecma_value_t
+ecma_builtin_array_prototype_object_sort_compare_numbers (ecma_value_t lhs, /**< left number */
+                                                          ecma_value_t rhs, /**< right number */
+                                                          ecma_value_t compare_func, /**< compare function */
+                                                          ecma_object_t *array_buffer_p) /**< arrayBuffer */
+{
+  JERRY_UNUSED (compare_func);
+  JERRY_UNUSED (array_buffer_p);
+
+  lit_utf8_byte_t lhs_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+  lit_utf8_byte_t rhs_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+
+  lit_utf8_size_t lhs_size =
+    ecma_number_to_utf8_string (ecma_get_number_from_value (lhs), lhs_buffer, sizeof (lhs_buffer));
+  lit_utf8_size_t rhs_size =
+    ecma_number_to_utf8_string (ecma_get_number_from_value (rhs), rhs_buffer, sizeof (rhs_buffer));
+
+  /* Stringified numbers are ASCII, so their bytes are compared as code units. */
+  int result = memcmp (lhs_buffer, rhs_buffer, JERRY_MIN (lhs_size, rhs_size));
+
+  if (result == 0)
+  {
+    result = (lhs_size < rhs_size) ? -1 : (lhs_size > rhs_size);
+  }
+
+  return ecma_make_integer_value ((result < 0) ? -1 : (result > 0));
+} /* ecma_builtin_array_prototype_object_sort_compare_numbers */
+
+/**
+ * Select the SortCompare function used when no comparefn is passed.
+ *
+ * @return specialized compare function for arrays of strings or numbers,
+ *         general compare function otherwise
+ */
+static ecma_builtin_helper_sort_compare_fn_t
+ecma_builtin_array_prototype_object_sort_get_default_compare_fn (const ecma_value_t *values_p, /**< values */
+                                                                 uint32_t values_count) /**< number of values */
+{
+  bool is_all_strings = true;
+  bool is_all_numbers = true;
+
+  for (uint32_t i = 0; i < values_count && (is_all_strings || is_all_numbers); i++)
+  {
+    is_all_strings = is_all_strings && ecma_is_value_string (values_p[i]);
+    is_all_numbers = is_all_numbers && ecma_is_value_number (values_p[i]);
+  }
+
+  if (is_all_strings)
+  {
+    return &ecma_builtin_array_prototype_object_sort_compare_strings;
+  }
+
+  if (is_all_numbers)
+  {
+    return &ecma_builtin_array_prototype_object_sort_compare_numbers;
+  }
+
+  return &ecma_builtin_array_prototype_object_sort_compare_helper;
+} /* ecma_builtin_array_prototype_object_sort_get_default_compare_fn */
+
 /**
  * The Array.prototype object's 'sort' routine
  *
@@ -1035,60 +1128,82 @@ ecma_builtin_array_prototype_object_sort (ecma_value_t this_arg, /**< this argum
   {
     return len_value;
   }
-  ecma_collection_t *array_index_props_p = ecma_new_collection ();
 
-  for (uint32_t i = 0; i < len; i++)
-  {
-    ecma_string_t *prop_name_p = ecma_new_ecma_string_from_uint32 (i);
+  ecma_collection_t *array_index_props_p = NULL;
+  uint32_t defined_prop_count = (uint32_t) len;
 
-    ecma_property_descriptor_t prop_desc;
-    ecma_value_t get_desc = ecma_op_object_get_own_property_descriptor (obj_p, prop_name_p, &prop_desc);
+  /* Fast access mode arrays without holes have no accessors and every index is defined,
+   * so their elements are copied directly and no properties need to be deleted. */
+  if (!ecma_op_object_is_fast_array (obj_p) || ecma_fast_array_get_hole_count (obj_p) != 0)
+  {
+    array_index_props_p = ecma_new_collection ();
 
-    if (ECMA_IS_VALUE_ERROR (get_desc))
+    for (uint32_t i = 0; i < len; i++)
     {
-      ecma_collection_free (array_index_props_p);
-      ecma_deref_ecma_string (prop_name_p);
-      return get_desc;
-    }
+      ecma_string_t *prop_name_p = ecma_new_ecma_string_from_uint32 (i);
 
-    if (ecma_is_value_true (get_desc))
-    {
-      ecma_ref_ecma_string (prop_name_p);
-      ecma_collection_push_back (array_index_props_p, ecma_make_string_value (prop_name_p));
-      ecma_free_property_descriptor (&prop_desc);
-      continue;
+      ecma_property_descriptor_t prop_desc;
+      ecma_value_t get_desc = ecma_op_object_get_own_property_descriptor (obj_p, prop_name_p, &prop_desc);
+
+      if (ECMA_IS_VALUE_ERROR (get_desc))
+      {
+        ecma_collection_free (array_index_props_p);
+        ecma_deref_ecma_string (prop_name_p);
+        return get_desc;
+      }
+
+      if (ecma_is_value_true (get_desc))
+      {
+        ecma_ref_ecma_string (prop_name_p);
+        ecma_collection_push_back (array_index_props_p, ecma_make_string_value (prop_name_p));
+        ecma_free_property_descriptor (&prop_desc);
+        continue;
+      }
     }
-  }
 
-  uint32_t defined_prop_count = array_index_props_p->item_count;
+    defined_prop_count = array_index_props_p->item_count;
+  }
 
   ecma_value_t ret_value = ECMA_VALUE_ERROR;
   uint32_t copied_num = 0;
   JMEM_DEFINE_LOCAL_ARRAY (values_buffer, defined_prop_count, ecma_value_t);
 
-  ecma_value_t *buffer_p = array_index_props_p->buffer_p;
-
-  /* Copy unsorted array into a native c array. */
-  for (uint32_t i = 0; i < array_index_props_p->item_count; i++)
+  if (array_index_props_p == NULL)
   {
-    ecma_string_t *property_name_p = ecma_get_string_from_value (buffer_p[i]);
+    ecma_value_t *values_p = ECMA_GET_POINTER (ecma_value_t, obj_p->u1.property_list_cp);
 
-    uint32_t index = ecma_string_get_array_index (property_name_p);
-    JERRY_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
-
-    if (index >= len)
+    while (copied_num < defined_prop_count)
     {
-      break;
+      values_buffer[copied_num] = ecma_copy_value (values_p[copied_num]);
+      copied_num++;
     }
+  }
+  else
+  {
+    ecma_value_t *buffer_p = array_index_props_p->buffer_p;
 
-    ecma_value_t index_value = ecma_op_object_get (obj_p, property_name_p);
-
-    if (ECMA_IS_VALUE_ERROR (index_value))
+    /* Copy unsorted array into a native c array. */
+    for (uint32_t i = 0; i < array_index_props_p->item_count; i++)
     {
-      goto clean_up;
-    }
+      ecma_string_t *property_name_p = ecma_get_string_from_value (buffer_p[i]);
+
+      uint32_t index = ecma_string_get_array_index (property_name_p);
+      JERRY_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
+
+      if (index >= len)
+      {
+        break;
+      }
+
+      ecma_value_t index_value = ecma_op_object_get (obj_p, property_name_p);
+
+      if (ECMA_IS_VALUE_ERROR (index_value))
+      {
+        goto clean_up;
+      }
 
-    values_buffer[copied_num++] = index_value;
+      values_buffer[copied_num++] = index_value;
+    }
   }
 
   JERRY_ASSERT (copied_num == defined_prop_count);
@@ -1096,7 +1211,13 @@ ecma_builtin_array_prototype_object_sort (ecma_value_t this_arg, /**< this argum
   /* Sorting. */
   if (copied_num > 1)
   {
-    const ecma_builtin_helper_sort_compare_fn_t sort_cb = &ecma_builtin_array_prototype_object_sort_compare_helper;
+    ecma_builtin_helper_sort_compare_fn_t sort_cb = &ecma_builtin_array_prototype_object_sort_compare_helper;
+
+    if (ecma_is_value_undefined (arg1))
+    {
+      sort_cb = ecma_builtin_array_prototype_object_sort_get_default_compare_fn (values_buffer, copied_num);
+    }
+
     ecma_value_t sort_value =
       ecma_builtin_helper_array_merge_sort_helper (values_buffer, (uint32_t) (copied_num), arg1, sort_cb, NULL);
     if (ECMA_IS_VALUE_ERROR (sort_value))
@@ -1129,6 +1250,11 @@ clean_up:
 
   JMEM_FINALIZE_LOCAL_ARRAY (values_buffer);
 
+  if (array_index_props_p == NULL)
+  {
+    return ECMA_IS_VALUE_ERROR (ret_value) ? ret_value : ecma_copy_value (this_arg);
+  }
+
   if (ECMA_IS_VALUE_ERROR (ret_value))
   {
     ecma_collection_free (array_index_props_p);
@@ -291,6 +291,73 @@ ecma_date_construct_helper (const ecma_value_t *args, /**< arguments passed to t
   return true;
 } /* ecma_date_construct_helper */
 
+/**
+ * Helper function used by ecma_builtin_date_parse
+ *
+ * Parses the YYYY-MM-DDTHH:mm:ss.sssZ format produced by Date.prototype.toISOString,
+ * without the optional parts handled by ecma_builtin_date_parse_basic
+ *
+ * See also:
+ *          ECMA-262 v5, 15.9.1.15 Date Time String Format
+ *
+ * @return the parsed date as ecma_number_t or NaN otherwise
+ */
+static ecma_number_t
+ecma_builtin_date_parse_iso_string (const lit_utf8_byte_t *date_str_p) /**< date string with
+                                                                         *   ECMA_DATE_ISO_STRING_LENGTH bytes */
+{
+  const char *layout_p = "0000-00-00T00:00:00.000Z";
+  uint32_t fields[7];
+  uint32_t field_index = 0;
+  uint32_t value = 0;
+
+  for (uint32_t i = 0; i < ECMA_DATE_ISO_STRING_LENGTH; i++)
+  {
+    lit_utf8_byte_t c = date_str_p[i];
+
+    if (layout_p[i] == LIT_CHAR_0)
+    {
+      if (!lit_char_is_decimal_digit (c))
+      {
+        return ecma_number_make_nan ();
+      }
+
+      value = value * 10 + (uint32_t) (c - LIT_CHAR_0);
+      continue;
+    }
+
+    if (c != (lit_utf8_byte_t) layout_p[i])
+    {
+      return ecma_number_make_nan ();
+    }
+
+    fields[field_index++] = value;
+    value = 0;
+  }
+
+  JERRY_ASSERT (field_index == 7);
+
+  uint32_t month = fields[1];
+  uint32_t date = fields[2];
+  uint32_t hours = fields[3];
+  uint32_t minutes = fields[4];
+  uint32_t seconds = fields[5];
+  uint32_t milliseconds = fields[6];
+
+  if (month < 1 || month > 12 || date < 1 || date > 31 || hours > 24 || minutes > 59 || seconds > 59
+      || (hours == 24 && (minutes != 0 || seconds != 0 || milliseconds != 0)))
+  {
+    return ecma_number_make_nan ();
+  }
+
+  int32_t day = ecma_date_day_from_date ((int32_t) fields[0], (int32_t) month - 1, (int32_t) date);
+  uint32_t time = ((hours * ECMA_DATE_MINUTES_PER_HOUR + minutes) * ECMA_DATE_SECONDS_PER_MINUTE + seconds)
+                    * ECMA_DATE_MS_PER_SECOND
+                  + milliseconds;
+
+  return (ecma_number_t) day * ECMA_DATE_MS_PER_DAY + (ecma_number_t) time;
+} /* ecma_builtin_date_parse_iso_string */
+
 /**
  * Helper function used by ecma_builtin_date_parse
  *
@@ -642,8 +709,19 @@ ecma_builtin_date_parse (ecma_string_t *string_p) /**< string */
   const lit_utf8_byte_t *date_str_curr_p = str_p;
   const lit_utf8_byte_t *date_str_end_p = str_p + str_size;
 
-  /* try to parse date string as ISO string - ECMA-262 v5, 15.9.1.15 */
-  ecma_number_t tv = ecma_builtin_date_parse_basic (date_str_curr_p, date_str_end_p);
+  ecma_number_t tv = ecma_number_make_nan ();
+
+  if (str_size == ECMA_DATE_ISO_STRING_LENGTH)
+  {
+    /* try to parse date string in Date.prototype.toISOString() format */
+    tv = ecma_builtin_date_parse_iso_string (date_str_curr_p);
+  }
+
+  if (ecma_number_is_nan (tv))
+  {
+    /* try to parse date string as ISO string - ECMA-262 v5, 15.9.1.15 */
+    tv = ecma_builtin_date_parse_basic (date_str_curr_p, date_str_end_p);
+  }
 
   if (ecma_number_is_nan (tv))
   {
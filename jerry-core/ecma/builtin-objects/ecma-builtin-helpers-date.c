@@ -22,6 +22,7 @@
 #include "ecma-helpers.h"
 #include "ecma-objects.h"
 
+#include "jcontext.h"
 #include "lit-char-helpers.h"
 
 #if JERRY_BUILTIN_DATE
@@ -153,32 +154,74 @@ static const uint16_t first_day_in_month[2][12] = { {
                                                     } };
 
 /**
- * Abstract operation: YearFromTime
+ * Compute the year, month and day of the month of the given time
  *
- *  See also:
- *          ECMA-262 v11, 20.4.1.3
+ * Note:
+ *      the result of the last computation is cached in the context
  *
- * @return year corresponds to the given time
+ * @return date cache which contains the calendar date of the given time
  */
-int32_t
-ecma_date_year_from_time (ecma_number_t time) /**< time value */
+static const ecma_date_cache_t *
+ecma_date_get_calendar_date (ecma_number_t time) /**< time value */
 {
   JERRY_ASSERT (!ecma_number_is_nan (time));
 
-  int32_t approx = (int32_t) (floor (time / ECMA_DATE_MS_PER_DAY / 365.2425) + 1970);
-  int64_t year_ms = ecma_date_day_from_year (approx) * ((int64_t) ECMA_DATE_MS_PER_DAY);
+  ecma_date_cache_t *cache_p = &JERRY_CONTEXT (date_cache);
+  int32_t day = ecma_date_day_from_time (time);
+
+  if (cache_p->day == day)
+  {
+    return cache_p;
+  }
+
+  int32_t year = (int32_t) (floor (time / ECMA_DATE_MS_PER_DAY / 365.2425) + 1970);
+  int64_t year_ms = ecma_date_day_from_year (year) * ((int64_t) ECMA_DATE_MS_PER_DAY);
 
   if ((ecma_number_t) year_ms > time)
   {
-    approx--;
+    year--;
   }
 
-  if ((ecma_number_t) (year_ms + ecma_date_days_in_year (approx) * ((int64_t) ECMA_DATE_MS_PER_DAY)) <= time)
+  if ((ecma_number_t) (year_ms + ecma_date_days_in_year (year) * ((int64_t) ECMA_DATE_MS_PER_DAY)) <= time)
   {
-    approx++;
+    year++;
+  }
+
+  int32_t day_within_year = day - ecma_date_day_from_year (year);
+
+  JERRY_ASSERT (day_within_year >= 0 && day_within_year < ECMA_DATE_DAYS_IN_LEAP_YEAR);
+
+  int32_t in_leap_year = ecma_date_in_leap_year (year);
+  int32_t month = 11;
+
+  for (int i = 1; i < 12; i++)
+  {
+    if (day_within_year < first_day_in_month[in_leap_year][i])
+    {
+      month = i - 1;
+      break;
+    }
   }
 
-  return approx;
+  cache_p->day = day;
+  cache_p->year = year;
+  cache_p->month = (uint8_t) month;
+  cache_p->date = (uint8_t) (day_within_year + 1 - first_day_in_month[in_leap_year][month]);
+  return cache_p;
+} /* ecma_date_get_calendar_date */
+
+/**
+ * Abstract operation: YearFromTime
+ *
+ *  See also:
+ *          ECMA-262 v11, 20.4.1.3
+ *
+ * @return year corresponds to the given time
+ */
+int32_t
+ecma_date_year_from_time (ecma_number_t time) /**< time value */
+{
+  return ecma_date_get_calendar_date (time)->year;
 } /* ecma_date_year_from_time */
 
 /**
@@ -192,24 +235,7 @@ ecma_date_year_from_time (ecma_number_t time) /**< time value */
 int32_t
 ecma_date_month_from_time (ecma_number_t time) /**< time value */
 {
-  JERRY_ASSERT (!ecma_number_is_nan (time));
-
-  int32_t year = ecma_date_year_from_time (time);
-  int32_t day_within_year = ecma_date_day_from_time (time) - ecma_date_day_from_year (year);
-
-  JERRY_ASSERT (day_within_year >= 0 && day_within_year < ECMA_DATE_DAYS_IN_LEAP_YEAR);
-
-  int32_t in_leap_year = ecma_date_in_leap_year (year);
-
-  for (int i = 1; i < 12; i++)
-  {
-    if (day_within_year < first_day_in_month[in_leap_year][i])
-    {
-      return i - 1;
-    }
-  }
-
-  return 11;
+  return ecma_date_get_calendar_date (time)->month;
 } /* ecma_date_month_from_time */
 
 /**
@@ -223,27 +249,7 @@ ecma_date_month_from_time (ecma_number_t time) /**< time value */
 int32_t
 ecma_date_date_from_time (ecma_number_t time) /**< time value */
 {
-  JERRY_ASSERT (!ecma_number_is_nan (time));
-
-  int32_t year = ecma_date_year_from_time (time);
-  int32_t day_within_year = ecma_date_day_from_time (time) - ecma_date_day_from_year (year);
-
-  JERRY_ASSERT (day_within_year >= 0 && day_within_year < ECMA_DATE_DAYS_IN_LEAP_YEAR);
-
-  int32_t in_leap_year = ecma_date_in_leap_year (year);
-
-  int32_t month = 11;
-
-  for (int i = 1; i < 12; i++)
-  {
-    if (day_within_year < first_day_in_month[in_leap_year][i])
-    {
-      month = i - 1;
-      break;
-    }
-  }
-
-  return day_within_year + 1 - first_day_in_month[in_leap_year][month];
+  return ecma_date_get_calendar_date (time)->date;
 } /* ecma_date_date_from_time */
 
 /**
@@ -381,6 +387,21 @@ ecma_date_ms_from_time (ecma_number_t time) /**< time value */
   return (int32_t) (time_in_day % ECMA_DATE_MS_PER_SECOND);
 } /* ecma_date_ms_from_time */
 
+/**
+ * Calculate the elapsed days since Unix Epoch of a calendar date
+ *
+ * @return elapsed days since Unix Epoch
+ */
+int32_t
+ecma_date_day_from_date (int32_t year, /**< year value */
+                         int32_t month, /**< month value (0 - 11) */
+                         int32_t date) /**< day of the month */
+{
+  JERRY_ASSERT (month >= 0 && month <= 11);
+
+  return ecma_date_day_from_year (year) + first_day_in_month[ecma_date_in_leap_year (year)][month] + (date - 1);
+} /* ecma_date_day_from_date */
+
 /**
  * Abstract operation: MakeTime
  *
@@ -450,8 +471,7 @@ ecma_date_make_day (ecma_number_t year, /**< year value */
   }
 
   /* 7. */
-  ecma_number_t days =
-    (ecma_date_day_from_year (int_year) + first_day_in_month[ecma_date_in_leap_year (int_year)][mn] + (dt - 1));
+  ecma_number_t days = ecma_date_day_from_date (int_year, mn, 1) + (dt - 1);
   return days * ECMA_DATE_MS_PER_DAY;
 } /* ecma_date_make_day */
 
@@ -689,6 +709,27 @@ ecma_date_to_string_format (ecma_number_t datetime_number, /**< datetime */
     ecma_new_ecma_string_from_ascii (date_buffer, (lit_utf8_size_t) (dest_p - date_buffer)));
 } /* ecma_date_to_string_format */
 
+/**
+ * Print a zero padded decimal number with a fixed number of digits
+ *
+ * @return pointer to the character after the printed number
+ */
+static lit_utf8_byte_t *
+ecma_date_print_fixed_number (lit_utf8_byte_t *dest_p, /**< destination buffer */
+                              uint32_t number, /**< number to print */
+                              uint32_t number_length) /**< number of digits */
+{
+  lit_utf8_byte_t *end_p = dest_p + number_length;
+
+  do
+  {
+    *(--end_p) = (lit_utf8_byte_t) ((number % 10) + LIT_CHAR_0);
+    number /= 10;
+  } while (end_p > dest_p);
+
+  return dest_p + number_length;
+} /* ecma_date_print_fixed_number */
+
 /**
  * Common function to create a time zone specific string from a numeric value.
  *
@@ -733,7 +774,38 @@ ecma_date_value_to_utc_string (ecma_number_t datetime_number) /**< datetime */
 ecma_value_t
 ecma_date_value_to_iso_string (ecma_number_t datetime_number) /**<datetime */
 {
-  return ecma_date_to_string_format (datetime_number, "$y-$O-$DT$h:$m:$s.$iZ");
+  int32_t year = ecma_date_year_from_time (datetime_number);
+
+  if (JERRY_UNLIKELY (year < 0 || year > 9999))
+  {
+    return ecma_date_to_string_format (datetime_number, "$y-$O-$DT$h:$m:$s.$iZ");
+  }
+
+  /* Fast path for the YYYY-MM-DDTHH:mm:ss.sssZ format. */
+  lit_utf8_byte_t date_buffer[ECMA_DATE_ISO_STRING_LENGTH];
+  lit_utf8_byte_t *dest_p = date_buffer;
+  uint32_t time_in_day = (uint32_t) ecma_date_time_in_day_from_time (datetime_number);
+  uint32_t minutes = (time_in_day / ECMA_DATE_MS_PER_MINUTE) % ECMA_DATE_MINUTES_PER_HOUR;
+  uint32_t seconds = (time_in_day / ECMA_DATE_MS_PER_SECOND) % ECMA_DATE_SECONDS_PER_MINUTE;
+
+  dest_p = ecma_date_print_fixed_number (dest_p, (uint32_t) year, 4);
+  *dest_p++ = LIT_CHAR_MINUS;
+  dest_p = ecma_date_print_fixed_number (dest_p, (uint32_t) ecma_date_month_from_time (datetime_number) + 1, 2);
+  *dest_p++ = LIT_CHAR_MINUS;
+  dest_p = ecma_date_print_fixed_number (dest_p, (uint32_t) ecma_date_date_from_time (datetime_number), 2);
+  *dest_p++ = LIT_CHAR_UPPERCASE_T;
+  dest_p = ecma_date_print_fixed_number (dest_p, time_in_day / ECMA_DATE_MS_PER_HOUR, 2);
+  *dest_p++ = LIT_CHAR_COLON;
+  dest_p = ecma_date_print_fixed_number (dest_p, minutes, 2);
+  *dest_p++ = LIT_CHAR_COLON;
+  dest_p = ecma_date_print_fixed_number (dest_p, seconds, 2);
+  *dest_p++ = LIT_CHAR_DOT;
+  dest_p = ecma_date_print_fixed_number (dest_p, time_in_day % ECMA_DATE_MS_PER_SECOND, 3);
+  *dest_p++ = LIT_CHAR_UPPERCASE_Z;
+
+  JERRY_ASSERT (dest_p == date_buffer + ECMA_DATE_ISO_STRING_LENGTH);
+
+  return ecma_make_string_value (ecma_new_ecma_string_from_ascii (date_buffer, ECMA_DATE_ISO_STRING_LENGTH));
 } /* ecma_date_value_to_iso_string */
 
 /**
@@ -17,61 +17,455 @@
 #include "ecma-globals.h"
 #include "ecma-helpers-number.h"
 
+#include "jmem.h"
+
+/**
+ * Runs shorter than this are extended by binary insertion sort.
+ */
+#define ECMA_SORT_MIN_MERGE 32
+
+/**
+ * Maximum number of pending runs (enough for 2^32 elements).
+ */
+#define ECMA_SORT_MAX_PENDING_RUNS 40
+
 /**
- * Function used to merge two arrays for merge sort.
- * Arrays are stored as below:
- * First  -> source_array_p [left_idx : right_idx - 1]
- * Second -> source_array_p [right_idx : end_idx - 1]
- * Output -> output_array_p
+ * Sorting context.
+ */
+typedef struct
+{
+  ecma_value_t *array_p; /**< array to sort */
+  ecma_value_t *temp_p; /**< temporary buffer used by merging (allocated on demand) */
+  uint32_t temp_length; /**< length of the temporary buffer */
+  ecma_value_t compare_func; /**< compare function */
+  ecma_builtin_helper_sort_compare_fn_t sort_cb; /**< sorting cb */
+  ecma_object_t *array_buffer_p; /**< arrayBuffer */
+  uint32_t run_count; /**< number of pending runs */
+  uint32_t run_base[ECMA_SORT_MAX_PENDING_RUNS]; /**< start index of the pending runs */
+  uint32_t run_length[ECMA_SORT_MAX_PENDING_RUNS]; /**< length of the pending runs */
+} ecma_sort_context_t;
+
+/**
+ * Check whether the left value must be placed after the right value.
  *
- * @return ecma value
- *         Returned value must be freed with ecma_free_value.
+ * @return ECMA_VALUE_TRUE - if the left value is greater than the right value
+ *         ECMA_VALUE_FALSE - otherwise
+ *         ECMA_VALUE_ERROR - if the comparison throws an error
+ */
+static ecma_value_t
+ecma_builtin_helper_sort_is_greater (ecma_sort_context_t *context_p, /**< sorting context */
+                                     ecma_value_t lhs, /**< left value */
+                                     ecma_value_t rhs) /**< right value */
+{
+  ecma_value_t compare_value = context_p->sort_cb (lhs, rhs, context_p->compare_func, context_p->array_buffer_p);
+
+  if (ECMA_IS_VALUE_ERROR (compare_value))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+
+  bool is_greater = !(ecma_get_number_from_value (compare_value) <= ECMA_NUMBER_ZERO);
+  ecma_free_value (compare_value);
+
+  return ecma_make_boolean_value (is_greater);
+} /* ecma_builtin_helper_sort_is_greater */
+
+/**
+ * Find the first index in [start_idx, end_idx) whose value is greater than the key.
+ *
+ * @return ECMA_VALUE_EMPTY - if the search is successful
+ *         ECMA_VALUE_ERROR - if a comparison throws an error
+ */
+static ecma_value_t
+ecma_builtin_helper_sort_upper_bound (ecma_sort_context_t *context_p, /**< sorting context */
+                                      ecma_value_t key, /**< key */
+                                      uint32_t start_idx, /**< search begin */
+                                      uint32_t end_idx, /**< search end */
+                                      uint32_t *result_p) /**< [out] found index */
+{
+  while (start_idx < end_idx)
+  {
+    uint32_t middle_idx = start_idx + ((end_idx - start_idx) >> 1);
+    ecma_value_t is_greater = ecma_builtin_helper_sort_is_greater (context_p, context_p->array_p[middle_idx], key);
+
+    if (ECMA_IS_VALUE_ERROR (is_greater))
+    {
+      return ECMA_VALUE_ERROR;
+    }
+
+    if (ecma_is_value_true (is_greater))
+    {
+      end_idx = middle_idx;
+    }
+    else
+    {
+      start_idx = middle_idx + 1;
+    }
+  }
+
+  *result_p = start_idx;
+  return ECMA_VALUE_EMPTY;
+} /* ecma_builtin_helper_sort_upper_bound */
+
+/**
+ * Find the first index in [start_idx, end_idx) whose value is not less than the key.
+ *
+ * @return ECMA_VALUE_EMPTY - if the search is successful
+ *         ECMA_VALUE_ERROR - if a comparison throws an error
  */
 static ecma_value_t
-ecma_builtin_helper_array_merge_sort_bottom_up (ecma_value_t *source_array_p, /**< arrays to merge */
-                                                uint32_t left_idx, /**< first array begin */
-                                                uint32_t right_idx, /**< first array end */
-                                                uint32_t end_idx, /**< second array end */
-                                                ecma_value_t *output_array_p, /**< output array */
-                                                ecma_value_t compare_func, /**< compare function */
-                                                const ecma_builtin_helper_sort_compare_fn_t sort_cb, /**< sorting cb */
-                                                ecma_object_t *array_buffer_p) /* array_buffer_p */
+ecma_builtin_helper_sort_lower_bound (ecma_sort_context_t *context_p, /**< sorting context */
+                                      ecma_value_t key, /**< key */
+                                      uint32_t start_idx, /**< search begin */
+                                      uint32_t end_idx, /**< search end */
+                                      uint32_t *result_p) /**< [out] found index */
 {
+  while (start_idx < end_idx)
+  {
+    uint32_t middle_idx = start_idx + ((end_idx - start_idx) >> 1);
+    ecma_value_t is_greater = ecma_builtin_helper_sort_is_greater (context_p, key, context_p->array_p[middle_idx]);
+
+    if (ECMA_IS_VALUE_ERROR (is_greater))
+    {
+      return ECMA_VALUE_ERROR;
+    }
+
+    if (ecma_is_value_true (is_greater))
+    {
+      start_idx = middle_idx + 1;
+    }
+    else
+    {
+      end_idx = middle_idx;
+    }
+  }
+
+  *result_p = start_idx;
+  return ECMA_VALUE_EMPTY;
+} /* ecma_builtin_helper_sort_lower_bound */
+
+/**
+ * Sort [start_idx, end_idx) by binary insertion, where [start_idx, sorted_idx) is already sorted.
+ *
+ * @return ECMA_VALUE_EMPTY - if the sorting is successful
+ *         ECMA_VALUE_ERROR - if a comparison throws an error
+ */
+static ecma_value_t
+ecma_builtin_helper_sort_binary_insertion (ecma_sort_context_t *context_p, /**< sorting context */
+                                           uint32_t start_idx, /**< range begin */
+                                           uint32_t sorted_idx, /**< end of the sorted prefix */
+                                           uint32_t end_idx) /**< range end */
+{
+  ecma_value_t *array_p = context_p->array_p;
+
+  for (uint32_t i = sorted_idx; i < end_idx; i++)
+  {
+    ecma_value_t pivot = array_p[i];
+    uint32_t insert_idx;
+
+    /* Elements are moved only after the search, so the array is unchanged on error. */
+    if (ECMA_IS_VALUE_ERROR (ecma_builtin_helper_sort_upper_bound (context_p, pivot, start_idx, i, &insert_idx)))
+    {
+      return ECMA_VALUE_ERROR;
+    }
+
+    memmove (array_p + insert_idx + 1, array_p + insert_idx, (i - insert_idx) * sizeof (ecma_value_t));
+    array_p[insert_idx] = pivot;
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* ecma_builtin_helper_sort_binary_insertion */
+
+/**
+ * Find the length of the run starting at start_idx, and make it ascending.
+ *
+ * Note:
+ *      strictly descending runs are reversed, which keeps the sort stable
+ *
+ * @return ECMA_VALUE_EMPTY - if the run is found
+ *         ECMA_VALUE_ERROR - if a comparison throws an error
+ */
+static ecma_value_t
+ecma_builtin_helper_sort_count_run (ecma_sort_context_t *context_p, /**< sorting context */
+                                    uint32_t start_idx, /**< run begin */
+                                    uint32_t end_idx, /**< end of the array */
+                                    uint32_t *run_length_p) /**< [out] run length */
+{
+  ecma_value_t *array_p = context_p->array_p;
+  uint32_t run_end_idx = start_idx + 1;
+
+  if (run_end_idx == end_idx)
+  {
+    *run_length_p = 1;
+    return ECMA_VALUE_EMPTY;
+  }
+
+  ecma_value_t is_greater = ecma_builtin_helper_sort_is_greater (context_p, array_p[start_idx], array_p[run_end_idx]);
+
+  if (ECMA_IS_VALUE_ERROR (is_greater))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+
+  bool is_descending = ecma_is_value_true (is_greater);
+  run_end_idx++;
+
+  while (run_end_idx < end_idx)
+  {
+    is_greater = ecma_builtin_helper_sort_is_greater (context_p, array_p[run_end_idx - 1], array_p[run_end_idx]);
+
+    if (ECMA_IS_VALUE_ERROR (is_greater))
+    {
+      return ECMA_VALUE_ERROR;
+    }
+
+    if (ecma_is_value_true (is_greater) != is_descending)
+    {
+      break;
+    }
+
+    run_end_idx++;
+  }
+
+  if (is_descending)
+  {
+    uint32_t low_idx = start_idx;
+    uint32_t high_idx = run_end_idx - 1;
+
+    while (low_idx < high_idx)
+    {
+      ecma_value_t value = array_p[low_idx];
+      array_p[low_idx++] = array_p[high_idx];
+      array_p[high_idx--] = value;
+    }
+  }
+
+  *run_length_p = run_end_idx - start_idx;
+  return ECMA_VALUE_EMPTY;
+} /* ecma_builtin_helper_sort_count_run */
+
+/**
+ * Merge the pending runs at run_idx and run_idx + 1.
+ *
+ * Note:
+ *      the array always contains every value exactly once, even if a comparison throws an error
+ *
+ * @return ECMA_VALUE_EMPTY - if the merge is successful
+ *         ECMA_VALUE_ERROR - if a comparison throws an error
+ */
+static ecma_value_t
+ecma_builtin_helper_sort_merge_at (ecma_sort_context_t *context_p, /**< sorting context */
+                                   uint32_t run_idx) /**< index of the first run */
+{
+  ecma_value_t *array_p = context_p->array_p;
+  uint32_t base1 = context_p->run_base[run_idx];
+  uint32_t length1 = context_p->run_length[run_idx];
+  uint32_t base2 = context_p->run_base[run_idx + 1];
+  uint32_t length2 = context_p->run_length[run_idx + 1];
+
+  JERRY_ASSERT (base1 + length1 == base2);
+
+  context_p->run_length[run_idx] = length1 + length2;
+
+  if (run_idx + 3 == context_p->run_count)
+  {
+    context_p->run_base[run_idx + 1] = context_p->run_base[run_idx + 2];
+    context_p->run_length[run_idx + 1] = context_p->run_length[run_idx + 2];
+  }
+
+  context_p->run_count--;
+
+  /* Elements of the first run which are not greater than the first element
+   * of the second run are already in place. */
+  uint32_t start_idx;
+
+  if (ECMA_IS_VALUE_ERROR (
+        ecma_builtin_helper_sort_upper_bound (context_p, array_p[base2], base1, base2, &start_idx)))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+
+  length1 -= start_idx - base1;
+  base1 = start_idx;
+
+  if (length1 == 0)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  /* Elements of the second run which are not less than the last element
+   * of the first run are already in place. */
+  uint32_t end_idx;
+
+  if (ECMA_IS_VALUE_ERROR (
+        ecma_builtin_helper_sort_lower_bound (context_p, array_p[base2 - 1], base2, base2 + length2, &end_idx)))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+
+  length2 = end_idx - base2;
+
+  if (length2 == 0)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  uint32_t temp_length = JERRY_MIN (length1, length2);
+
+  if (temp_length > context_p->temp_length)
+  {
+    if (context_p->temp_p != NULL)
+    {
+      jmem_heap_free_block (context_p->temp_p, context_p->temp_length * sizeof (ecma_value_t));
+    }
+
+    context_p->temp_p = (ecma_value_t *) jmem_heap_alloc_block (temp_length * sizeof (ecma_value_t));
+    context_p->temp_length = temp_length;
+  }
+
+  ecma_value_t *temp_p = context_p->temp_p;
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
-  uint32_t i = left_idx, j = right_idx;
 
-  for (uint32_t k = left_idx; k < end_idx; k++)
+  if (length1 <= length2)
   {
-    ecma_value_t compare_value = ecma_make_number_value (ECMA_NUMBER_ZERO);
+    /* Merge from the left: the first run is moved to the temporary buffer. */
+    memcpy (temp_p, array_p + base1, length1 * sizeof (ecma_value_t));
 
-    if (i < right_idx && j < end_idx)
+    uint32_t temp_idx = 0;
+    uint32_t source_idx = base2;
+    uint32_t dest_idx = base1;
+    const uint32_t source_end_idx = base2 + length2;
+
+    while (temp_idx < length1 && source_idx < source_end_idx)
     {
-      compare_value = sort_cb (source_array_p[i], source_array_p[j], compare_func, array_buffer_p);
-      if (ECMA_IS_VALUE_ERROR (compare_value))
+      ecma_value_t is_greater = ecma_builtin_helper_sort_is_greater (context_p, temp_p[temp_idx], array_p[source_idx]);
+
+      if (ECMA_IS_VALUE_ERROR (is_greater))
       {
         ret_value = ECMA_VALUE_ERROR;
         break;
       }
+
+      if (ecma_is_value_true (is_greater))
+      {
+        array_p[dest_idx++] = array_p[source_idx++];
+      }
+      else
+      {
+        array_p[dest_idx++] = temp_p[temp_idx++];
+      }
+    }
+
+    memcpy (array_p + dest_idx, temp_p + temp_idx, (length1 - temp_idx) * sizeof (ecma_value_t));
+    return ret_value;
+  }
+
+  /* Merge from the right: the second run is moved to the temporary buffer. */
+  memcpy (temp_p, array_p + base2, length2 * sizeof (ecma_value_t));
+
+  uint32_t temp_count = length2;
+  uint32_t source_count = length1;
+  uint32_t dest_idx = base2 + length2;
+
+  while (temp_count > 0 && source_count > 0)
+  {
+    ecma_value_t is_greater =
+      ecma_builtin_helper_sort_is_greater (context_p, array_p[base1 + source_count - 1], temp_p[temp_count - 1]);
+
+    if (ECMA_IS_VALUE_ERROR (is_greater))
+    {
+      ret_value = ECMA_VALUE_ERROR;
+      break;
     }
 
-    if (i < right_idx && ecma_get_number_from_value (compare_value) <= ECMA_NUMBER_ZERO)
+    if (ecma_is_value_true (is_greater))
     {
-      output_array_p[k] = source_array_p[i];
-      i++;
+      array_p[--dest_idx] = array_p[base1 + --source_count];
     }
     else
     {
-      output_array_p[k] = source_array_p[j];
-      j++;
+      array_p[--dest_idx] = temp_p[--temp_count];
     }
-    ecma_free_value (compare_value);
   }
 
+  memcpy (array_p + dest_idx - temp_count, temp_p, temp_count * sizeof (ecma_value_t));
   return ret_value;
-} /* ecma_builtin_helper_array_merge_sort_bottom_up */
+} /* ecma_builtin_helper_sort_merge_at */
+
+/**
+ * Merge the pending runs until their lengths satisfy the invariants of the run stack.
+ *
+ * @return ECMA_VALUE_EMPTY - if the merges are successful
+ *         ECMA_VALUE_ERROR - if a comparison throws an error
+ */
+static ecma_value_t
+ecma_builtin_helper_sort_merge_collapse (ecma_sort_context_t *context_p, /**< sorting context */
+                                         bool force) /**< merge all pending runs */
+{
+  uint32_t *run_length_p = context_p->run_length;
+
+  while (context_p->run_count > 1)
+  {
+    uint32_t run_idx = context_p->run_count - 2;
+
+    if (force)
+    {
+      if (run_idx > 0 && run_length_p[run_idx - 1] < run_length_p[run_idx + 1])
+      {
+        run_idx--;
+      }
+    }
+    else if ((run_idx > 0 && run_length_p[run_idx - 1] <= run_length_p[run_idx] + run_length_p[run_idx + 1])
+             || (run_idx > 1 && run_length_p[run_idx - 2] <= run_length_p[run_idx - 1] + run_length_p[run_idx]))
+    {
+      if (run_length_p[run_idx - 1] < run_length_p[run_idx + 1])
+      {
+        run_idx--;
+      }
+    }
+    else if (run_length_p[run_idx] > run_length_p[run_idx + 1])
+    {
+      break;
+    }
+
+    if (ECMA_IS_VALUE_ERROR (ecma_builtin_helper_sort_merge_at (context_p, run_idx)))
+    {
+      return ECMA_VALUE_ERROR;
+    }
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* ecma_builtin_helper_sort_merge_collapse */
 
 /**
- * Mergesort function
+ * Compute the minimum run length for the given array length.
+ *
+ * @return minimum run length
+ */
+static uint32_t
+ecma_builtin_helper_sort_min_run_length (uint32_t length) /**< array length */
+{
+  uint32_t low_bits = 0;
+
+  while (length >= ECMA_SORT_MIN_MERGE)
+  {
+    low_bits |= length & 1;
+    length >>= 1;
+  }
+
+  return length + low_bits;
+} /* ecma_builtin_helper_sort_min_run_length */
+
+/**
+ * Stable sort of an array of values.
+ *
+ * The natural runs of the array are found (descending runs are reversed), short runs are
+ * extended by binary insertion sort, and the runs are merged as in TimSort. Sorted or
+ * nearly sorted arrays need O(n) comparisons, and the temporary buffer is never larger
+ * than half of the array.
+ *
+ * Note:
+ *      if the comparison throws an error, the array still contains every value exactly once
  *
  * @return ecma value
  *         Returned value must be freed with ecma_free_value.
@@ -83,74 +477,74 @@ ecma_builtin_helper_array_merge_sort_helper (ecma_value_t *array_p, /**< array t
                                              const ecma_builtin_helper_sort_compare_fn_t sort_cb, /**< sorting cb */
                                              ecma_object_t *array_buffer_p) /**< arrayBuffer */
 {
-  ecma_value_t ret_value = ECMA_VALUE_EMPTY;
-  JMEM_DEFINE_LOCAL_ARRAY (dest_array_p, length, ecma_value_t);
+  if (length < 2)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
 
-  ecma_value_t *temp_p;
-  ecma_value_t *base_array_p = array_p;
-  uint32_t r, e;
+  ecma_sort_context_t context;
+  context.array_p = array_p;
+  context.temp_p = NULL;
+  context.temp_length = 0;
+  context.compare_func = compare_func;
+  context.sort_cb = sort_cb;
+  context.array_buffer_p = array_buffer_p;
+  context.run_count = 0;
 
-  for (uint32_t w = 1; w < length; w = 2 * w)
+  ecma_value_t ret_value = ECMA_VALUE_EMPTY;
+  const uint32_t min_run_length = ecma_builtin_helper_sort_min_run_length (length);
+  uint32_t start_idx = 0;
+
+  while (start_idx < length)
   {
-    for (uint32_t i = 0; i < length; i = i + 2 * w)
+    uint32_t run_length;
+    ret_value = ecma_builtin_helper_sort_count_run (&context, start_idx, length, &run_length);
+
+    if (ECMA_IS_VALUE_ERROR (ret_value))
     {
-      // End of first array
-      r = i + w;
-      if (r > length)
-      {
-        r = length;
-      }
+      break;
+    }
 
-      // End of second array
-      e = i + 2 * w;
-      if (e > length)
-      {
-        e = length;
-      }
+    if (run_length < min_run_length)
+    {
+      uint32_t forced_length = JERRY_MIN (min_run_length, length - start_idx);
+      ret_value = ecma_builtin_helper_sort_binary_insertion (&context,
+                                                             start_idx,
+                                                             start_idx + run_length,
+                                                             start_idx + forced_length);
 
-      // Merge two arrays
-      ret_value = ecma_builtin_helper_array_merge_sort_bottom_up (array_p,
-                                                                  i,
-                                                                  r,
-                                                                  e,
-                                                                  dest_array_p,
-                                                                  compare_func,
-                                                                  sort_cb,
-                                                                  array_buffer_p);
       if (ECMA_IS_VALUE_ERROR (ret_value))
       {
         break;
       }
+
+      run_length = forced_length;
     }
 
+    JERRY_ASSERT (context.run_count < ECMA_SORT_MAX_PENDING_RUNS);
+    context.run_base[context.run_count] = start_idx;
+    context.run_length[context.run_count] = run_length;
+    context.run_count++;
+
+    ret_value = ecma_builtin_helper_sort_merge_collapse (&context, false);
+
     if (ECMA_IS_VALUE_ERROR (ret_value))
     {
       break;
     }
 
-    // Swap arrays
-    temp_p = dest_array_p;
-    dest_array_p = array_p;
-    array_p = temp_p;
+    start_idx += run_length;
   }
 
-  // Sorted array is in dest_array_p - there was uneven number of arrays swaps
-  if (dest_array_p == base_array_p)
+  if (!ECMA_IS_VALUE_ERROR (ret_value))
   {
-    uint32_t index = 0;
-    temp_p = dest_array_p;
-    dest_array_p = array_p;
-    array_p = temp_p;
-
-    while (index < length)
-    {
-      array_p[index] = dest_array_p[index];
-      index++;
-    }
-    JERRY_ASSERT (index == length);
+    ret_value = ecma_builtin_helper_sort_merge_collapse (&context, true);
   }
 
-  JMEM_FINALIZE_LOCAL_ARRAY (dest_array_p);
+  if (context.temp_p != NULL)
+  {
+    jmem_heap_free_block (context.temp_p, context.temp_length * sizeof (ecma_value_t));
+  }
 
   return ret_value;
 } /* ecma_builtin_helper_array_merge_sort_helper */
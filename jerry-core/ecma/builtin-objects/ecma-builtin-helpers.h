@@ -165,6 +165,11 @@ bool ecma_builtin_is_regexp_exec (ecma_extended_object_t *obj_p);
  */
 #define ECMA_DATE_MAX_VALUE 8.64e15
 
+/**
+ * Length of the YYYY-MM-DDTHH:mm:ss.sssZ date time string format
+ */
+#define ECMA_DATE_ISO_STRING_LENGTH 24
+
 /**
  * Timezone type.
  */
@@ -189,6 +194,8 @@ int32_t ecma_date_sec_from_time (ecma_number_t time);
 int32_t ecma_date_ms_from_time (ecma_number_t time);
 int32_t ecma_date_time_in_day_from_time (ecma_number_t time);
 
+int32_t ecma_date_day_from_date (int32_t year, int32_t month, int32_t date);
+
 int32_t ecma_date_local_time_zone_adjustment (ecma_number_t time);
 ecma_number_t ecma_date_utc (ecma_number_t time);
 ecma_number_t ecma_date_make_time (ecma_number_t hour, ecma_number_t min, ecma_number_t sec, ecma_number_t ms);
@@ -240,8 +247,37 @@ typedef struct
   ecma_stringbuilder_t result_builder;
 } ecma_json_stringify_context_t;
 
+/**
+ * State of the incremental JSON parser.
+ */
+struct jerry_json_parser_internal_t
+{
+  jerry_json_parser_cb_t callback; /**< callback for the completed values */
+  void *user_p; /**< user pointer passed to the callback */
+  lit_utf8_byte_t *buffer_p; /**< source text which is not processed yet */
+  lit_utf8_size_t buffer_size; /**< allocated size of the buffer */
+  lit_utf8_size_t text_size; /**< size of the source text in the buffer */
+  lit_utf8_size_t scan_size; /**< size of the already scanned part of the source text */
+  uint32_t depth; /**< nesting level at the end of the scanned text */
+  uint16_t options; /**< jerry_json_parser_option_t option bits */
+  uint8_t state; /**< ecma_json_stream_state_t */
+  uint8_t flags; /**< ecma_json_stream_flags_t */
+};
+
+/**
+ * Incremental JSON parser.
+ */
+typedef struct jerry_json_parser_internal_t ecma_json_stream_t;
+
 ecma_value_t ecma_builtin_json_parse_buffer (const lit_utf8_byte_t *str_start_p, lit_utf8_size_t string_size);
+ecma_json_stream_t *ecma_builtin_json_stream_create (uint32_t options, jerry_json_parser_cb_t callback, void *user_p);
+ecma_value_t
+ecma_builtin_json_stream_feed (ecma_json_stream_t *stream_p, const lit_utf8_byte_t *chunk_p, lit_utf8_size_t chunk_size);
+ecma_value_t ecma_builtin_json_stream_finish (ecma_json_stream_t *stream_p);
 ecma_value_t ecma_builtin_json_stringify_no_opts (const ecma_value_t value);
+ecma_value_t ecma_builtin_json_stringify_to_buffer (const ecma_value_t value,
+                                                    lit_utf8_byte_t *buffer_p,
+                                                    lit_utf8_size_t buffer_size);
 bool ecma_json_has_object_in_stack (ecma_json_occurrence_stack_item_t *stack_p, ecma_object_t *object_p);
 
 ecma_value_t ecma_builtin_helper_json_create_non_formatted_json (lit_utf8_byte_t left_bracket,
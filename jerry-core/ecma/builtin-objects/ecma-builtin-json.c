@@ -22,6 +22,7 @@
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
+#include "ecma-helpers-number.h"
 #include "ecma-helpers.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
@@ -91,6 +92,58 @@ typedef enum
   TOKEN_COLON /**< JSON colon */
 } ecma_json_token_type_t;
 
+/**
+ * Modes of parsing string tokens
+ */
+typedef enum
+{
+  ECMA_JSON_STRING_NONE, /**< string tokens are not allowed */
+  ECMA_JSON_STRING_VALUE, /**< string tokens are values */
+  ECMA_JSON_STRING_KEY, /**< string tokens are property names */
+} ecma_json_string_mode_t;
+
+/**
+ * Number of entries in the property name cache of the JSON parser (must be a power of 2)
+ */
+#define ECMA_JSON_KEY_CACHE_SIZE 32
+
+/**
+ * Number of remembered object shapes of the JSON parser (must be a power of 2)
+ */
+#define ECMA_JSON_SHAPE_CACHE_SIZE 4
+
+/**
+ * Maximum number of property names stored in an object shape
+ */
+#define ECMA_JSON_SHAPE_MAX_KEYS 16
+
+/**
+ * Property name list of a recently parsed object
+ *
+ * Note:
+ *      the names are distinct, so an object whose property names match
+ *      a prefix of a shape in the same order cannot have duplicated names
+ */
+typedef struct
+{
+  ecma_string_t *keys[ECMA_JSON_SHAPE_MAX_KEYS]; /**< property names in definition order */
+  uint32_t count; /**< number of property names */
+} ecma_json_shape_t;
+
+/**
+ * Property name cache of the JSON parser
+ *
+ * Arrays of records usually repeat the same property names, so the names are
+ * interned during a parse: the same name is represented by the same string,
+ * and the objects can be constructed without searching for duplicated names.
+ */
+typedef struct
+{
+  ecma_string_t *keys[ECMA_JSON_KEY_CACHE_SIZE]; /**< recently seen property names */
+  ecma_json_shape_t shapes[ECMA_JSON_SHAPE_CACHE_SIZE]; /**< shapes of recently parsed objects */
+  uint32_t generation; /**< incremented whenever a shape is changed */
+} ecma_json_parse_cache_t;
+
 /**
  * JSON token
  */
@@ -99,6 +152,7 @@ typedef struct
   ecma_json_token_type_t type; /**< type of the current token */
   const lit_utf8_byte_t *current_p; /**< current position of the string processed by the parser */
   const lit_utf8_byte_t *end_p; /**< end of the string processed by the parser */
+  ecma_json_parse_cache_t *cache_p; /**< property name cache (can be NULL) */
 
   /**
    * Fields depending on type.
@@ -110,17 +164,136 @@ typedef struct
   } u;
 } ecma_json_token_t;
 
+/**
+ * Allocate the property name cache of the JSON parser.
+ *
+ * @return pointer to the cache - if the allocation is successful
+ *         NULL - otherwise
+ */
+static ecma_json_parse_cache_t *
+ecma_builtin_json_create_cache (void)
+{
+  ecma_json_parse_cache_t *cache_p;
+  cache_p = (ecma_json_parse_cache_t *) jmem_heap_alloc_block_null_on_error (sizeof (ecma_json_parse_cache_t));
+
+  if (cache_p != NULL)
+  {
+    memset (cache_p, 0, sizeof (ecma_json_parse_cache_t));
+  }
+
+  return cache_p;
+} /* ecma_builtin_json_create_cache */
+
+/**
+ * Release the property name cache of the JSON parser.
+ */
+static void
+ecma_builtin_json_free_cache (ecma_json_parse_cache_t *cache_p) /**< property name cache */
+{
+  for (uint32_t i = 0; i < ECMA_JSON_KEY_CACHE_SIZE; i++)
+  {
+    if (cache_p->keys[i] != NULL)
+    {
+      ecma_deref_ecma_string (cache_p->keys[i]);
+    }
+  }
+
+  for (uint32_t i = 0; i < ECMA_JSON_SHAPE_CACHE_SIZE; i++)
+  {
+    ecma_json_shape_t *shape_p = cache_p->shapes + i;
+
+    for (uint32_t j = 0; j < shape_p->count; j++)
+    {
+      ecma_deref_ecma_string (shape_p->keys[j]);
+    }
+  }
+
+  jmem_heap_free_block (cache_p, sizeof (ecma_json_parse_cache_t));
+} /* ecma_builtin_json_free_cache */
+
+/**
+ * Create a property name string, or reuse an identical one from the property name cache.
+ *
+ * @return ecma string
+ */
+static ecma_string_t *
+ecma_builtin_json_get_key (ecma_json_parse_cache_t *cache_p, /**< property name cache */
+                           const lit_utf8_byte_t *string_p, /**< cesu-8 encoded property name */
+                           lit_utf8_size_t string_size) /**< size of the property name */
+{
+  lit_string_hash_t hash = lit_utf8_string_calc_hash (string_p, string_size);
+  ecma_string_t **entry_p = cache_p->keys + (hash & (ECMA_JSON_KEY_CACHE_SIZE - 1));
+  ecma_string_t *key_p = *entry_p;
+
+  if (key_p != NULL && key_p->u.hash == hash)
+  {
+    ECMA_STRING_TO_UTF8_STRING (key_p, key_start_p, key_size);
+    bool is_equal = (key_size == string_size && memcmp (key_start_p, string_p, string_size) == 0);
+    ECMA_FINALIZE_UTF8_STRING (key_start_p, key_size);
+
+    if (is_equal)
+    {
+      ecma_ref_ecma_string (key_p);
+      return key_p;
+    }
+  }
+
+  key_p = ecma_new_ecma_string_from_utf8 (string_p, string_size);
+
+  /* Direct strings are not allocated, so caching them has no benefit. */
+  if (!ECMA_IS_DIRECT_STRING (key_p))
+  {
+    if (*entry_p != NULL)
+    {
+      ecma_deref_ecma_string (*entry_p);
+    }
+
+    ecma_ref_ecma_string (key_p);
+    *entry_p = key_p;
+  }
+
+  return key_p;
+} /* ecma_builtin_json_get_key */
+
 /**
  * Parse and extract string token.
  */
 static void
-ecma_builtin_json_parse_string (ecma_json_token_t *token_p) /**< token argument */
+ecma_builtin_json_parse_string (ecma_json_token_t *token_p, /**< token argument */
+                                bool is_key) /**< string is a property name */
 {
   const lit_utf8_byte_t *current_p = token_p->current_p;
   const lit_utf8_byte_t *end_p = token_p->end_p;
 
+  /* Fast path: strings without escape sequences and four byte long
+   * utf-8 sequences can be created directly from the source buffer. */
+  while (current_p < end_p && *current_p >= LIT_CHAR_SP && *current_p < LIT_UTF8_4_BYTE_MARKER
+         && *current_p != LIT_CHAR_DOUBLE_QUOTE && *current_p != LIT_CHAR_BACKSLASH)
+  {
+    current_p++;
+  }
+
+  if (current_p < end_p && *current_p == LIT_CHAR_DOUBLE_QUOTE)
+  {
+    const lit_utf8_byte_t *start_p = token_p->current_p;
+    lit_utf8_size_t size = (lit_utf8_size_t) (current_p - start_p);
+
+    if (is_key && token_p->cache_p != NULL)
+    {
+      token_p->u.string_p = ecma_builtin_json_get_key (token_p->cache_p, start_p, size);
+    }
+    else
+    {
+      token_p->u.string_p = ecma_new_ecma_string_from_utf8 (start_p, size);
+    }
+
+    token_p->current_p = current_p + 1;
+    token_p->type = TOKEN_STRING;
+    return;
+  }
+
   ecma_stringbuilder_t result_builder = ecma_stringbuilder_create ();
-  const lit_utf8_byte_t *unappended_p = current_p;
+  const lit_utf8_byte_t *unappended_p = token_p->current_p;
 
   while (true)
   {
@@ -246,12 +419,16 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
 {
   const lit_utf8_byte_t *current_p = token_p->current_p;
   const lit_utf8_byte_t *end_p = token_p->end_p;
-  const lit_utf8_byte_t *start_p = current_p;
+  bool sign = false;
+  uint64_t significand = 0;
+  uint32_t digit_count = 0;
+  int32_t decimal_exponent = 0;
 
   JERRY_ASSERT (current_p < end_p);
 
   if (*current_p == LIT_CHAR_MINUS)
   {
+    sign = true;
     current_p++;
   }
 
@@ -273,6 +450,16 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
   {
     do
     {
+      if (digit_count < ECMA_NUMBER_MAX_DIGITS)
+      {
+        significand = significand * 10 + (uint32_t) (*current_p - LIT_CHAR_0);
+        digit_count++;
+      }
+      else
+      {
+        decimal_exponent++;
+      }
+
       current_p++;
     } while (current_p < end_p && lit_char_is_decimal_digit (*current_p));
   }
@@ -288,16 +475,32 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
 
     do
     {
+      if (digit_count == 0 && *current_p == LIT_CHAR_0)
+      {
+        /* Leading zeros are omitted. */
+        decimal_exponent--;
+      }
+      else if (digit_count < ECMA_NUMBER_MAX_DIGITS)
+      {
+        significand = significand * 10 + (uint32_t) (*current_p - LIT_CHAR_0);
+        digit_count++;
+        decimal_exponent--;
+      }
+
       current_p++;
     } while (current_p < end_p && lit_char_is_decimal_digit (*current_p));
   }
 
   if (current_p < end_p && (*current_p == LIT_CHAR_LOWERCASE_E || *current_p == LIT_CHAR_UPPERCASE_E))
   {
+    bool exponent_sign = false;
+    int32_t exponent = 0;
+
     current_p++;
 
     if (current_p < end_p && (*current_p == LIT_CHAR_PLUS || *current_p == LIT_CHAR_MINUS))
     {
+      exponent_sign = (*current_p == LIT_CHAR_MINUS);
       current_p++;
     }
 
@@ -308,12 +511,20 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
 
     do
     {
+      /* Larger exponents produce zero or infinity regardless of the digits. */
+      if (exponent < 100000)
+      {
+        exponent = exponent * 10 + (*current_p - LIT_CHAR_0);
+      }
+
       current_p++;
     } while (current_p < end_p && lit_char_is_decimal_digit (*current_p));
+
+    decimal_exponent += exponent_sign ? -exponent : exponent;
   }
 
   token_p->type = TOKEN_NUMBER;
-  token_p->u.number = ecma_utf8_string_to_number (start_p, (lit_utf8_size_t) (current_p - start_p), 0);
+  token_p->u.number = ecma_number_from_decimal (significand, decimal_exponent, sign);
 
   token_p->current_p = current_p;
 } /* ecma_builtin_json_parse_number */
@@ -326,7 +537,7 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
  */
 static void
 ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p, /**< token argument */
-                                    bool parse_string) /**< strings are allowed to parse */
+                                    ecma_json_string_mode_t string_mode) /**< how string tokens are parsed */
 {
   const lit_utf8_byte_t *current_p = token_p->current_p;
   const lit_utf8_byte_t *end_p = token_p->end_p;
@@ -385,10 +596,10 @@ ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p, /**< token argum
     }
     case LIT_CHAR_DOUBLE_QUOTE:
     {
-      if (parse_string)
+      if (string_mode != ECMA_JSON_STRING_NONE)
       {
         token_p->current_p = current_p + 1;
-        ecma_builtin_json_parse_string (token_p);
+        ecma_builtin_json_parse_string (token_p, string_mode == ECMA_JSON_STRING_KEY);
       }
       return;
     }
@@ -448,20 +659,24 @@ ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p, /**< token argum
 } /* ecma_builtin_json_parse_next_token */
 
 /**
- * Utility for defining properties.
- *
- * It silently ignores all errors.
+ * Store a property name in an object shape and drop the names after it.
  */
 static void
-ecma_builtin_json_define_value_property (ecma_object_t *obj_p, /**< this object */
-                                         ecma_string_t *property_name_p, /**< property name */
-                                         ecma_value_t value) /**< value */
+ecma_builtin_json_shape_set_key (ecma_json_shape_t *shape_p, /**< object shape */
+                                 uint32_t index, /**< index of the property name */
+                                 ecma_string_t *name_p) /**< property name */
 {
-  ecma_value_t completion_value =
-    ecma_builtin_helper_def_prop (obj_p, property_name_p, value, ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
+  JERRY_ASSERT (index < ECMA_JSON_SHAPE_MAX_KEYS && index <= shape_p->count);
+
+  for (uint32_t i = index; i < shape_p->count; i++)
+  {
+    ecma_deref_ecma_string (shape_p->keys[i]);
+  }
 
-  JERRY_ASSERT (ecma_is_value_boolean (completion_value));
-} /* ecma_builtin_json_define_value_property */
+  ecma_ref_ecma_string (name_p);
+  shape_p->keys[index] = name_p;
+  shape_p->count = index + 1;
+} /* ecma_builtin_json_shape_set_key */
 
 /**
  * Parse next value.
@@ -499,8 +714,12 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
     case TOKEN_LEFT_BRACE:
     {
       ecma_object_t *object_p = ecma_op_create_object_object_noarg ();
+      ecma_json_parse_cache_t *cache_p = token_p->cache_p;
+      ecma_json_shape_t *shape_p = NULL;
+      uint32_t generation = 0;
+      uint32_t index = 0;
 
-      ecma_builtin_json_parse_next_token (token_p, true);
+      ecma_builtin_json_parse_next_token (token_p, ECMA_JSON_STRING_KEY);
 
       if (token_p->type == TOKEN_RIGHT_BRACE)
       {
@@ -516,14 +735,14 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
 
         ecma_string_t *name_p = token_p->u.string_p;
 
-        ecma_builtin_json_parse_next_token (token_p, false);
+        ecma_builtin_json_parse_next_token (token_p, ECMA_JSON_STRING_NONE);
         if (token_p->type != TOKEN_COLON)
         {
           ecma_deref_ecma_string (name_p);
           break;
         }
 
-        ecma_builtin_json_parse_next_token (token_p, true);
+        ecma_builtin_json_parse_next_token (token_p, ECMA_JSON_STRING_VALUE);
         ecma_value_t value = ecma_builtin_json_parse_value (token_p);
 
         if (ecma_is_value_empty (value))
@@ -532,11 +751,58 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
           break;
         }
 
-        ecma_builtin_json_define_value_property (object_p, name_p, value);
+        if (index == 0 && cache_p != NULL)
+        {
+          shape_p = cache_p->shapes + (ecma_string_hash (name_p) & (ECMA_JSON_SHAPE_CACHE_SIZE - 1));
+          generation = cache_p->generation;
+        }
+
+        /* The shape cannot be trusted if it has been changed while parsing a nested value. */
+        if (shape_p != NULL && (cache_p->generation != generation || index >= ECMA_JSON_SHAPE_MAX_KEYS))
+        {
+          shape_p = NULL;
+        }
+
+        ecma_property_t *property_p = NULL;
+
+        if (shape_p == NULL || index >= shape_p->count || shape_p->keys[index] != name_p)
+        {
+          property_p = ecma_find_named_property (object_p, name_p);
+
+          if (shape_p != NULL)
+          {
+            if (property_p == NULL)
+            {
+              ecma_builtin_json_shape_set_key (shape_p, index, name_p);
+              generation = ++cache_p->generation;
+            }
+            else
+            {
+              shape_p = NULL;
+            }
+          }
+        }
+
+        ecma_property_value_t *prop_value_p;
+
+        if (property_p == NULL)
+        {
+          prop_value_p = ecma_create_named_data_property (object_p,
+                                                          name_p,
+                                                          ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                          NULL);
+        }
+        else
+        {
+          prop_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+        }
+
+        ecma_named_data_property_assign_value (object_p, prop_value_p, value);
         ecma_deref_ecma_string (name_p);
         ecma_free_value (value);
+        index++;
 
-        ecma_builtin_json_parse_next_token (token_p, false);
+        ecma_builtin_json_parse_next_token (token_p, ECMA_JSON_STRING_NONE);
         if (token_p->type == TOKEN_RIGHT_BRACE)
         {
           return ecma_make_object_value (object_p);
@@ -547,7 +813,7 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
           break;
         }
 
-        ecma_builtin_json_parse_next_token (token_p, true);
+        ecma_builtin_json_parse_next_token (token_p, ECMA_JSON_STRING_KEY);
       }
 
       /*
@@ -561,7 +827,7 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
       uint32_t length = 0;
       ecma_object_t *array_p = ecma_op_new_array_object (0);
 
-      ecma_builtin_json_parse_next_token (token_p, true);
+      ecma_builtin_json_parse_next_token (token_p, ECMA_JSON_STRING_VALUE);
 
       if (token_p->type == TOKEN_RIGHT_SQUARE)
       {
@@ -578,15 +844,11 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
           break;
         }
 
-        ecma_value_t completion;
-        completion = ecma_builtin_helper_def_prop_by_index (array_p,
-                                                            length,
-                                                            value,
-                                                            ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
-        JERRY_ASSERT (ecma_is_value_true (completion));
+        bool is_set = ecma_fast_array_set_property (array_p, length, value);
+        JERRY_ASSERT (is_set);
         ecma_free_value (value);
 
-        ecma_builtin_json_parse_next_token (token_p, false);
+        ecma_builtin_json_parse_next_token (token_p, ECMA_JSON_STRING_NONE);
 
         if (token_p->type == TOKEN_RIGHT_SQUARE)
         {
@@ -599,7 +861,7 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
           break;
         }
 
-        ecma_builtin_json_parse_next_token (token_p, true);
+        ecma_builtin_json_parse_next_token (token_p, ECMA_JSON_STRING_VALUE);
         length++;
       }
 
@@ -806,13 +1068,25 @@ ecma_builtin_json_parse_buffer (const lit_utf8_byte_t *str_start_p, /**< String
   ecma_json_token_t token;
   token.current_p = str_start_p;
   token.end_p = str_start_p + string_size;
+  token.cache_p = NULL;
+
+  ecma_builtin_json_parse_next_token (&token, ECMA_JSON_STRING_VALUE);
+
+  if (token.type == TOKEN_LEFT_BRACE || token.type == TOKEN_LEFT_SQUARE)
+  {
+    token.cache_p = ecma_builtin_json_create_cache ();
+  }
 
-  ecma_builtin_json_parse_next_token (&token, true);
   ecma_value_t result = ecma_builtin_json_parse_value (&token);
 
+  if (token.cache_p != NULL)
+  {
+    ecma_builtin_json_free_cache (token.cache_p);
+  }
+
   if (!ecma_is_value_empty (result))
   {
-    ecma_builtin_json_parse_next_token (&token, false);
+    ecma_builtin_json_parse_next_token (&token, ECMA_JSON_STRING_NONE);
     if (token.type == TOKEN_END)
     {
       return result;
@@ -825,101 +1099,577 @@ ecma_builtin_json_parse_buffer (const lit_utf8_byte_t *str_start_p, /**< String
 } /* ecma_builtin_json_parse_buffer */
 
 /**
- * The JSON object's 'parse' routine
+ * States of the incremental JSON parser
+ */
+typedef enum
+{
+  ECMA_JSON_STREAM_BEFORE_VALUE, /**< whitespace before a top-level value */
+  ECMA_JSON_STREAM_VALUE, /**< inside a top-level value */
+  ECMA_JSON_STREAM_ELEMENTS, /**< inside the top-level array */
+  ECMA_JSON_STREAM_AFTER_VALUE, /**< whitespace after the top-level value */
+  ECMA_JSON_STREAM_ERROR, /**< a parse error has occurred */
+} ecma_json_stream_state_t;
+
+/**
+ * Flags of the incremental JSON parser
+ */
+typedef enum
+{
+  ECMA_JSON_STREAM_IN_STRING = (1u << 0), /**< the scanned text ends inside a string */
+  ECMA_JSON_STREAM_ESCAPE = (1u << 1), /**< the scanned text ends with a backslash inside a string */
+  ECMA_JSON_STREAM_HAS_COMMA = (1u << 2), /**< a comma is found in the top-level array */
+} ecma_json_stream_flags_t;
+
+/**
+ * Minimum size of the source text buffer of the incremental JSON parser
+ */
+#define ECMA_JSON_STREAM_MIN_BUFFER_SIZE 64
+
+/**
+ * Checks whether the character is a JSON whitespace.
  *
- * See also:
- *          ECMA-262 v5, 15.12.2
+ * @return true - if the character is a whitespace
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_builtin_json_is_whitespace (lit_utf8_byte_t c) /**< character */
+{
+  return (c == LIT_CHAR_SP || c == LIT_CHAR_CR || c == LIT_CHAR_LF || c == LIT_CHAR_TAB);
+} /* ecma_builtin_json_is_whitespace */
+
+/**
+ * Create an incremental JSON parser.
  *
- * @return ecma value
- *         Returned value must be freed with ecma_free_value.
+ * @return pointer to the parser
+ *         NULL - if there is not enough memory
  */
-static ecma_value_t
-ecma_builtin_json_parse (ecma_value_t arg1, /**< string argument */
-                         ecma_value_t arg2) /**< reviver argument */
+ecma_json_stream_t *
+ecma_builtin_json_stream_create (uint32_t options, /**< jerry_json_parser_option_t option bits */
+                                 jerry_json_parser_cb_t callback, /**< callback for the completed values */
+                                 void *user_p) /**< user pointer passed to the callback */
 {
-  ecma_string_t *text_string_p = ecma_op_to_string (arg1);
+  ecma_json_stream_t *stream_p =
+    (ecma_json_stream_t *) jmem_heap_alloc_block_null_on_error (sizeof (ecma_json_stream_t));
 
-  if (JERRY_UNLIKELY (text_string_p == NULL))
+  if (JERRY_UNLIKELY (stream_p == NULL))
   {
-    return ECMA_VALUE_ERROR;
+    return NULL;
   }
 
-  ECMA_STRING_TO_UTF8_STRING (text_string_p, str_start_p, string_size);
-  ecma_value_t result = ecma_builtin_json_parse_buffer (str_start_p, string_size);
-  ECMA_FINALIZE_UTF8_STRING (str_start_p, string_size);
-  ecma_deref_ecma_string (text_string_p);
+  stream_p->callback = callback;
+  stream_p->user_p = user_p;
+  stream_p->buffer_p = NULL;
+  stream_p->buffer_size = 0;
+  stream_p->text_size = 0;
+  stream_p->scan_size = 0;
+  stream_p->depth = 0;
+  stream_p->options = (uint16_t) (options & (JERRY_JSON_PARSER_ARRAY_ELEMENTS | JERRY_JSON_PARSER_VALUE_SEQUENCE));
+  stream_p->state = ECMA_JSON_STREAM_BEFORE_VALUE;
+  stream_p->flags = 0;
 
-  if (!ECMA_IS_VALUE_ERROR (result) && ecma_op_is_callable (arg2))
-  {
-    ecma_object_t *object_p = ecma_op_create_object_object_noarg ();
+  return stream_p;
+} /* ecma_builtin_json_stream_create */
 
-    ecma_property_value_t *prop_value_p;
-    prop_value_p = ecma_create_named_data_property (object_p,
-                                                    ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY),
-                                                    ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
-                                                    NULL);
+/**
+ * Parse a completed part of the source text and pass the result to the callback.
+ *
+ * @return ECMA_VALUE_EMPTY - if the parsing is successful
+ *         error - otherwise
+ */
+static ecma_value_t
+ecma_builtin_json_stream_emit (ecma_json_stream_t *stream_p, /**< incremental JSON parser */
+                               lit_utf8_size_t start, /**< start offset of the value */
+                               lit_utf8_size_t end) /**< end offset of the value */
+{
+  JERRY_ASSERT (start <= end && end <= stream_p->text_size);
 
-    ecma_named_data_property_assign_value (object_p, prop_value_p, result);
+  ecma_value_t value = ecma_builtin_json_parse_buffer (stream_p->buffer_p + start, end - start);
 
-    ecma_free_value (result);
-    result = ecma_builtin_json_internalize_property (ecma_get_object_from_value (arg2),
-                                                     object_p,
-                                                     ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY));
-    ecma_deref_object (object_p);
+  if (ECMA_IS_VALUE_ERROR (value))
+  {
+    stream_p->state = ECMA_JSON_STREAM_ERROR;
+    return value;
   }
 
-  return result;
-} /* ecma_builtin_json_parse */
+  if (stream_p->callback != NULL)
+  {
+    stream_p->callback (value, stream_p->user_p);
+  }
+
+  ecma_free_value (value);
+  return ECMA_VALUE_EMPTY;
+} /* ecma_builtin_json_stream_emit */
 
 /**
- * Abstract operation 'QuoteJSONString' defined in 24.3.2.2
+ * Raise the syntax error of the incremental JSON parser.
+ *
+ * @return ECMA_VALUE_ERROR
  */
-static void
-ecma_builtin_json_quote (ecma_stringbuilder_t *builder_p, /**< builder for the result */
-                         ecma_string_t *string_p) /**< string that should be quoted */
+static ecma_value_t
+ecma_builtin_json_stream_raise_error (ecma_json_stream_t *stream_p) /**< incremental JSON parser */
 {
-  ECMA_STRING_TO_UTF8_STRING (string_p, string_buff, string_buff_size);
-  const lit_utf8_byte_t *str_p = string_buff;
-  const lit_utf8_byte_t *regular_str_start_p = string_buff;
-  const lit_utf8_byte_t *str_end_p = str_p + string_buff_size;
+  stream_p->state = ECMA_JSON_STREAM_ERROR;
+  return ecma_raise_syntax_error (ECMA_ERR_INVALID_JSON_FORMAT);
+} /* ecma_builtin_json_stream_raise_error */
 
-  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
+/**
+ * Raise the error of the incremental JSON parser when the source text cannot be stored.
+ *
+ * @return ECMA_VALUE_ERROR
+ */
+static ecma_value_t
+ecma_builtin_json_stream_raise_allocation_error (ecma_json_stream_t *stream_p) /**< incremental JSON parser */
+{
+  stream_p->state = ECMA_JSON_STREAM_ERROR;
+  return ecma_raise_range_error (ECMA_ERR_ALLOCATE_JSON_SOURCE_TEXT);
+} /* ecma_builtin_json_stream_raise_allocation_error */
 
-  while (str_p < str_end_p)
-  {
-    ecma_char_t c = lit_cesu8_read_next (&str_p);
+/**
+ * Scan the newly appended source text, and parse the top-level values
+ * or top-level array elements which are completed.
+ *
+ * Note:
+ *      only the boundaries of the values are tracked here,
+ *      the values themselves are parsed by ecma_builtin_json_parse_buffer
+ *
+ * @return ECMA_VALUE_EMPTY - if no error is found
+ *         error - otherwise
+ */
+static ecma_value_t
+ecma_builtin_json_stream_scan (ecma_json_stream_t *stream_p) /**< incremental JSON parser */
+{
+  const lit_utf8_byte_t *buffer_p = stream_p->buffer_p;
+  lit_utf8_size_t text_size = stream_p->text_size;
+  lit_utf8_size_t start = 0;
+  lit_utf8_size_t pos = stream_p->scan_size;
+  ecma_value_t result = ECMA_VALUE_EMPTY;
 
-    bool should_escape = false;
+  while (pos < text_size)
+  {
+    lit_utf8_byte_t c = buffer_p[pos];
 
-    if (lit_is_code_point_utf16_high_surrogate (c))
+    if (stream_p->flags & ECMA_JSON_STREAM_IN_STRING)
     {
-      if (str_p < str_end_p)
+      if (stream_p->flags & ECMA_JSON_STREAM_ESCAPE)
       {
-        const ecma_char_t next_ch = lit_cesu8_peek_next (str_p);
-        if (lit_is_code_point_utf16_low_surrogate (next_ch))
+        stream_p->flags &= (uint8_t) ~ECMA_JSON_STREAM_ESCAPE;
+      }
+      else if (c == LIT_CHAR_BACKSLASH)
+      {
+        stream_p->flags |= ECMA_JSON_STREAM_ESCAPE;
+      }
+      else if (c == LIT_CHAR_DOUBLE_QUOTE)
+      {
+        stream_p->flags &= (uint8_t) ~ECMA_JSON_STREAM_IN_STRING;
+
+        if (stream_p->state == ECMA_JSON_STREAM_VALUE && stream_p->depth == 0)
         {
-          str_p += LIT_UTF8_MAX_BYTES_IN_CODE_UNIT;
-          continue;
+          result = ecma_builtin_json_stream_emit (stream_p, start, pos + 1);
+          stream_p->state = ECMA_JSON_STREAM_BEFORE_VALUE;
+          start = pos + 1;
         }
-        should_escape = true;
       }
-      else
+
+      pos++;
+
+      if (ECMA_IS_VALUE_ERROR (result))
       {
-        should_escape = true;
+        break;
       }
-    }
-    else if (lit_is_code_point_utf16_low_surrogate (c))
-    {
-      should_escape = true;
+      continue;
     }
 
-    if (c == LIT_CHAR_BACKSLASH || c == LIT_CHAR_DOUBLE_QUOTE)
+    switch (stream_p->state)
     {
-      ecma_stringbuilder_append_raw (builder_p,
-                                     regular_str_start_p,
-                                     (lit_utf8_size_t) (str_p - regular_str_start_p - 1));
-      regular_str_start_p = str_p;
-      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_BACKSLASH);
+      case ECMA_JSON_STREAM_BEFORE_VALUE:
+      {
+        if (ecma_builtin_json_is_whitespace (c))
+        {
+          start = ++pos;
+          continue;
+        }
+
+        if (!(stream_p->options & JERRY_JSON_PARSER_ARRAY_ELEMENTS))
+        {
+          /* The character is processed again as part of the value. */
+          stream_p->state = ECMA_JSON_STREAM_VALUE;
+          continue;
+        }
+
+        if (c != LIT_CHAR_LEFT_SQUARE)
+        {
+          result = ecma_builtin_json_stream_raise_error (stream_p);
+          break;
+        }
+
+        stream_p->state = ECMA_JSON_STREAM_ELEMENTS;
+        stream_p->flags &= (uint8_t) ~ECMA_JSON_STREAM_HAS_COMMA;
+        stream_p->depth = 1;
+        start = ++pos;
+        continue;
+      }
+      case ECMA_JSON_STREAM_VALUE:
+      {
+        if (c == LIT_CHAR_DOUBLE_QUOTE)
+        {
+          stream_p->flags |= ECMA_JSON_STREAM_IN_STRING;
+        }
+        else if (c == LIT_CHAR_LEFT_BRACE || c == LIT_CHAR_LEFT_SQUARE)
+        {
+          stream_p->depth++;
+        }
+        else if (c == LIT_CHAR_RIGHT_BRACE || c == LIT_CHAR_RIGHT_SQUARE)
+        {
+          if (stream_p->depth <= 1)
+          {
+            /* Unbalanced brackets are reported by the parser. */
+            stream_p->depth = 0;
+            result = ecma_builtin_json_stream_emit (stream_p, start, pos + 1);
+            stream_p->state = ECMA_JSON_STREAM_BEFORE_VALUE;
+            start = pos + 1;
+          }
+          else
+          {
+            stream_p->depth--;
+          }
+        }
+        else if (stream_p->depth == 0 && ecma_builtin_json_is_whitespace (c))
+        {
+          /* End of a top-level number or literal. */
+          result = ecma_builtin_json_stream_emit (stream_p, start, pos);
+          stream_p->state = ECMA_JSON_STREAM_BEFORE_VALUE;
+          start = pos + 1;
+        }
+
+        pos++;
+        break;
+      }
+      case ECMA_JSON_STREAM_ELEMENTS:
+      {
+        if (c == LIT_CHAR_DOUBLE_QUOTE)
+        {
+          stream_p->flags |= ECMA_JSON_STREAM_IN_STRING;
+        }
+        else if (c == LIT_CHAR_LEFT_BRACE || c == LIT_CHAR_LEFT_SQUARE)
+        {
+          stream_p->depth++;
+        }
+        else if (c == LIT_CHAR_RIGHT_BRACE || c == LIT_CHAR_RIGHT_SQUARE)
+        {
+          if (--stream_p->depth == 0)
+          {
+            if (c != LIT_CHAR_RIGHT_SQUARE)
+            {
+              result = ecma_builtin_json_stream_raise_error (stream_p);
+              break;
+            }
+
+            bool is_empty = true;
+
+            for (lit_utf8_size_t i = start; i < pos; i++)
+            {
+              if (!ecma_builtin_json_is_whitespace (buffer_p[i]))
+              {
+                is_empty = false;
+                break;
+              }
+            }
+
+            /* An empty array has no elements, but a trailing comma is an error. */
+            if (!is_empty || (stream_p->flags & ECMA_JSON_STREAM_HAS_COMMA))
+            {
+              result = ecma_builtin_json_stream_emit (stream_p, start, pos);
+            }
+
+            stream_p->state = ((stream_p->options & JERRY_JSON_PARSER_VALUE_SEQUENCE) ? ECMA_JSON_STREAM_BEFORE_VALUE
+                                                                                      : ECMA_JSON_STREAM_AFTER_VALUE);
+            start = pos + 1;
+          }
+        }
+        else if (c == LIT_CHAR_COMMA && stream_p->depth == 1)
+        {
+          stream_p->flags |= ECMA_JSON_STREAM_HAS_COMMA;
+          result = ecma_builtin_json_stream_emit (stream_p, start, pos);
+          start = pos + 1;
+        }
+
+        pos++;
+        break;
+      }
+      case ECMA_JSON_STREAM_AFTER_VALUE:
+      {
+        if (!ecma_builtin_json_is_whitespace (c))
+        {
+          result = ecma_builtin_json_stream_raise_error (stream_p);
+          break;
+        }
+
+        start = ++pos;
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (stream_p->state == ECMA_JSON_STREAM_ERROR);
+        return ecma_raise_syntax_error (ECMA_ERR_INVALID_JSON_FORMAT);
+      }
+    }
+
+    if (ECMA_IS_VALUE_ERROR (result))
+    {
+      return result;
+    }
+  }
+
+  /* Only the text of the incomplete value is kept. */
+  if (start > 0)
+  {
+    memmove (stream_p->buffer_p, stream_p->buffer_p + start, text_size - start);
+    stream_p->text_size = text_size - start;
+  }
+
+  stream_p->scan_size = stream_p->text_size;
+  return result;
+} /* ecma_builtin_json_stream_scan */
+
+/**
+ * Append a chunk of source text to the incremental JSON parser.
+ *
+ * @return ECMA_VALUE_UNDEFINED - if no error is found
+ *         error - otherwise
+ */
+ecma_value_t
+ecma_builtin_json_stream_feed (ecma_json_stream_t *stream_p, /**< incremental JSON parser */
+                               const lit_utf8_byte_t *chunk_p, /**< source text chunk */
+                               lit_utf8_size_t chunk_size) /**< size of the chunk */
+{
+  if (stream_p->state == ECMA_JSON_STREAM_ERROR)
+  {
+    return ecma_raise_syntax_error (ECMA_ERR_INVALID_JSON_FORMAT);
+  }
+
+  if (chunk_size > UINT32_MAX - stream_p->text_size)
+  {
+    return ecma_builtin_json_stream_raise_allocation_error (stream_p);
+  }
+
+  lit_utf8_size_t new_text_size = stream_p->text_size + chunk_size;
+
+  if (new_text_size > stream_p->buffer_size)
+  {
+    lit_utf8_size_t new_buffer_size = JERRY_MAX (stream_p->buffer_size, ECMA_JSON_STREAM_MIN_BUFFER_SIZE);
+
+    while (new_buffer_size < new_text_size)
+    {
+      /* Doubling would overflow: the buffer is allocated with the exact size. */
+      if (new_buffer_size > UINT32_MAX / 2)
+      {
+        new_buffer_size = new_text_size;
+        break;
+      }
+
+      new_buffer_size *= 2;
+    }
+
+    lit_utf8_byte_t *buffer_p = (lit_utf8_byte_t *) jmem_heap_alloc_block_null_on_error (new_buffer_size);
+
+    if (JERRY_UNLIKELY (buffer_p == NULL))
+    {
+      return ecma_builtin_json_stream_raise_allocation_error (stream_p);
+    }
+
+    if (stream_p->buffer_p != NULL)
+    {
+      memcpy (buffer_p, stream_p->buffer_p, stream_p->text_size);
+      jmem_heap_free_block (stream_p->buffer_p, stream_p->buffer_size);
+    }
+
+    stream_p->buffer_p = buffer_p;
+    stream_p->buffer_size = new_buffer_size;
+  }
+
+  memcpy (stream_p->buffer_p + stream_p->text_size, chunk_p, chunk_size);
+  stream_p->text_size = new_text_size;
+
+  if (stream_p->options == JERRY_JSON_PARSER_NO_OPTS)
+  {
+    /* The whole text is parsed by ecma_builtin_json_stream_finish. */
+    return ECMA_VALUE_UNDEFINED;
+  }
+
+  ecma_value_t result = ecma_builtin_json_stream_scan (stream_p);
+
+  if (ECMA_IS_VALUE_ERROR (result))
+  {
+    return result;
+  }
+
+  JERRY_ASSERT (ecma_is_value_empty (result));
+  return ECMA_VALUE_UNDEFINED;
+} /* ecma_builtin_json_stream_feed */
+
+/**
+ * Finish the parsing and free the incremental JSON parser.
+ *
+ * @return parsed value - if no options are specified
+ *         ECMA_VALUE_UNDEFINED - if the values are passed to the callback
+ *         error - if the source text is invalid or incomplete
+ */
+ecma_value_t
+ecma_builtin_json_stream_finish (ecma_json_stream_t *stream_p) /**< incremental JSON parser */
+{
+  ecma_value_t result = ECMA_VALUE_UNDEFINED;
+
+  if (stream_p->options == JERRY_JSON_PARSER_NO_OPTS)
+  {
+    result = ecma_builtin_json_parse_buffer (stream_p->buffer_p, stream_p->text_size);
+  }
+  else
+  {
+    switch (stream_p->state)
+    {
+      case ECMA_JSON_STREAM_BEFORE_VALUE:
+      {
+        /* An empty sequence is valid, but a single value is required otherwise. */
+        if (!(stream_p->options & JERRY_JSON_PARSER_VALUE_SEQUENCE))
+        {
+          result = ecma_raise_syntax_error (ECMA_ERR_INVALID_JSON_FORMAT);
+        }
+        break;
+      }
+      case ECMA_JSON_STREAM_VALUE:
+      {
+        /* A top-level number or literal can be terminated by the end of the input. */
+        if (stream_p->depth == 0 && !(stream_p->flags & ECMA_JSON_STREAM_IN_STRING))
+        {
+          result = ecma_builtin_json_stream_emit (stream_p, 0, stream_p->text_size);
+
+          if (!ECMA_IS_VALUE_ERROR (result))
+          {
+            result = ECMA_VALUE_UNDEFINED;
+          }
+          break;
+        }
+
+        result = ecma_raise_syntax_error (ECMA_ERR_INVALID_JSON_FORMAT);
+        break;
+      }
+      case ECMA_JSON_STREAM_AFTER_VALUE:
+      {
+        break;
+      }
+      default:
+      {
+        result = ecma_raise_syntax_error (ECMA_ERR_INVALID_JSON_FORMAT);
+        break;
+      }
+    }
+  }
+
+  if (stream_p->buffer_p != NULL)
+  {
+    jmem_heap_free_block (stream_p->buffer_p, stream_p->buffer_size);
+  }
+
+  jmem_heap_free_block (stream_p, sizeof (ecma_json_stream_t));
+  return result;
+} /* ecma_builtin_json_stream_finish */
+
+/**
+ * The JSON object's 'parse' routine
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_parse (ecma_value_t arg1, /**< string argument */
+                         ecma_value_t arg2) /**< reviver argument */
+{
+  ecma_string_t *text_string_p = ecma_op_to_string (arg1);
+
+  if (JERRY_UNLIKELY (text_string_p == NULL))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+
+  ECMA_STRING_TO_UTF8_STRING (text_string_p, str_start_p, string_size);
+  ecma_value_t result = ecma_builtin_json_parse_buffer (str_start_p, string_size);
+  ECMA_FINALIZE_UTF8_STRING (str_start_p, string_size);
+  ecma_deref_ecma_string (text_string_p);
+
+  if (!ECMA_IS_VALUE_ERROR (result) && ecma_op_is_callable (arg2))
+  {
+    ecma_object_t *object_p = ecma_op_create_object_object_noarg ();
+
+    ecma_property_value_t *prop_value_p;
+    prop_value_p = ecma_create_named_data_property (object_p,
+                                                    ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY),
+                                                    ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                    NULL);
+
+    ecma_named_data_property_assign_value (object_p, prop_value_p, result);
+
+    ecma_free_value (result);
+    result = ecma_builtin_json_internalize_property (ecma_get_object_from_value (arg2),
+                                                     object_p,
+                                                     ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY));
+    ecma_deref_object (object_p);
+  }
+
+  return result;
+} /* ecma_builtin_json_parse */
+
+/**
+ * Abstract operation 'QuoteJSONString' defined in 24.3.2.2
+ */
+static void
+ecma_builtin_json_quote (ecma_stringbuilder_t *builder_p, /**< builder for the result */
+                         ecma_string_t *string_p) /**< string that should be quoted */
+{
+  ECMA_STRING_TO_UTF8_STRING (string_p, string_buff, string_buff_size);
+  const lit_utf8_byte_t *str_p = string_buff;
+  const lit_utf8_byte_t *regular_str_start_p = string_buff;
+  const lit_utf8_byte_t *str_end_p = str_p + string_buff_size;
+
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
+
+  while (str_p < str_end_p)
+  {
+    ecma_char_t c = lit_cesu8_read_next (&str_p);
+
+    bool should_escape = false;
+
+    if (lit_is_code_point_utf16_high_surrogate (c))
+    {
+      if (str_p < str_end_p)
+      {
+        const ecma_char_t next_ch = lit_cesu8_peek_next (str_p);
+        if (lit_is_code_point_utf16_low_surrogate (next_ch))
+        {
+          str_p += LIT_UTF8_MAX_BYTES_IN_CODE_UNIT;
+          continue;
+        }
+        should_escape = true;
+      }
+      else
+      {
+        should_escape = true;
+      }
+    }
+    else if (lit_is_code_point_utf16_low_surrogate (c))
+    {
+      should_escape = true;
+    }
+
+    if (c == LIT_CHAR_BACKSLASH || c == LIT_CHAR_DOUBLE_QUOTE)
+    {
+      ecma_stringbuilder_append_raw (builder_p,
+                                     regular_str_start_p,
+                                     (lit_utf8_size_t) (str_p - regular_str_start_p - 1));
+      regular_str_start_p = str_p;
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_BACKSLASH);
       ecma_stringbuilder_append_byte (builder_p, (lit_utf8_byte_t) c);
     }
     else if (c < LIT_CHAR_SP || should_escape)
@@ -978,6 +1728,160 @@ ecma_builtin_json_quote (ecma_stringbuilder_t *builder_p, /**< builder for the r
   ECMA_FINALIZE_UTF8_STRING (string_buff, string_buff_size);
 } /* ecma_builtin_json_quote */
 
+/**
+ * Check whether the toJSON lookup of an object can be skipped
+ *
+ * Note:
+ *      only ordinary objects and fast arrays are checked whose prototype chain
+ *      consists of the built-in Object.prototype and Array.prototype objects
+ *
+ * @return true - if the object surely has no toJSON property
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_json_has_no_to_json (ecma_object_t *obj_p) /**< object */
+{
+  ecma_string_t *to_json_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_TO_JSON_UL);
+  jmem_cpointer_t proto_cp = obj_p->u2.prototype_cp;
+
+  if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    if (ecma_find_named_property (obj_p, to_json_str_p) != NULL)
+    {
+      return false;
+    }
+  }
+  else if (ecma_op_object_is_fast_array (obj_p))
+  {
+    ecma_object_t *array_prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_ARRAY_PROTOTYPE);
+
+    if (proto_cp == JMEM_CP_NULL || ECMA_GET_NON_NULL_POINTER (ecma_object_t, proto_cp) != array_prototype_p
+        || ecma_find_named_property (array_prototype_p, to_json_str_p) != NULL)
+    {
+      return false;
+    }
+
+    proto_cp = array_prototype_p->u2.prototype_cp;
+  }
+  else
+  {
+    return false;
+  }
+
+  ecma_object_t *object_prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+
+  return (proto_cp != JMEM_CP_NULL && ECMA_GET_NON_NULL_POINTER (ecma_object_t, proto_cp) == object_prototype_p
+          && ecma_find_named_property (object_prototype_p, to_json_str_p) == NULL);
+} /* ecma_builtin_json_has_no_to_json */
+
+/**
+ * Collect the enumerable string keys of an ordinary object by walking its property list
+ *
+ * Note:
+ *      integer indexed keys must be sorted, so objects with such keys are not handled
+ *
+ * @return collection of the keys in property creation order - if the keys can be collected directly
+ *         NULL - otherwise
+ */
+static ecma_collection_t *
+ecma_builtin_json_get_plain_object_keys (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_GENERAL)
+  {
+    return NULL;
+  }
+
+  ecma_collection_t *keys_p = ecma_new_collection ();
+  jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
+
+#if JERRY_PROPERTY_HASHMAP
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+    {
+      prop_iter_cp = prop_iter_p->next_property_cp;
+    }
+  }
+#endif /* JERRY_PROPERTY_HASHMAP */
+
+  while (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      ecma_property_t property = prop_iter_p->types[i];
+
+      if (!ECMA_PROPERTY_IS_RAW (property) || (property & ECMA_PROPERTY_FLAG_BUILT_IN)
+          || !(property & ECMA_PROPERTY_FLAG_ENUMERABLE))
+      {
+        continue;
+      }
+
+      if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_MAGIC
+          && prop_pair_p->names_cp[i] >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
+          && prop_pair_p->names_cp[i] < LIT_MAGIC_STRING__COUNT)
+      {
+        continue;
+      }
+
+      ecma_string_t *name_p = ecma_string_from_property_name (property, prop_pair_p->names_cp[i]);
+
+      if (ecma_prop_name_is_symbol (name_p))
+      {
+        ecma_deref_ecma_string (name_p);
+        continue;
+      }
+
+      if (ecma_string_get_array_index (name_p) != ECMA_STRING_NOT_ARRAY_INDEX)
+      {
+        ecma_deref_ecma_string (name_p);
+        ecma_collection_free (keys_p);
+        return NULL;
+      }
+
+      ecma_collection_push_back (keys_p, ecma_make_string_value (name_p));
+    }
+
+    prop_iter_cp = prop_iter_p->next_property_cp;
+  }
+
+  /* The property list starts with the most recently created property. */
+  ecma_value_t *start_p = keys_p->buffer_p;
+  ecma_value_t *end_p = start_p + keys_p->item_count;
+
+  while (start_p + 1 < end_p)
+  {
+    ecma_value_t tmp = *start_p;
+    *start_p++ = *(--end_p);
+    *end_p = tmp;
+  }
+
+  return keys_p;
+} /* ecma_builtin_json_get_plain_object_keys */
+
+/**
+ * Append the string representation of a finite number to the result
+ */
+static void
+ecma_builtin_json_append_number (ecma_json_stringify_context_t *context_p, /**< context */
+                                 ecma_number_t num) /**< finite number */
+{
+  JERRY_ASSERT (!ecma_number_is_nan (num) && !ecma_number_is_infinity (num));
+
+  lit_utf8_byte_t buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+  lit_utf8_size_t size = ecma_number_to_utf8_string (num, buffer, sizeof (buffer));
+
+  ecma_stringbuilder_append_raw (&context_p->result_builder, buffer, size);
+} /* ecma_builtin_json_append_number */
+
+static ecma_value_t ecma_builtin_json_serialize_value (ecma_json_stringify_context_t *context_p, ecma_value_t value);
+
 static ecma_value_t ecma_builtin_json_serialize_property (ecma_json_stringify_context_t *context_p,
                                                           ecma_object_t *holder_p,
                                                           ecma_string_t *key_p);
@@ -1020,14 +1924,19 @@ ecma_builtin_json_serialize_object (ecma_json_stringify_context_t *context_p, /*
   /* 6. */
   else
   {
-    property_keys_p = ecma_op_object_get_enumerable_property_names (obj_p, ECMA_ENUMERABLE_PROPERTY_KEYS);
+    property_keys_p = ecma_builtin_json_get_plain_object_keys (obj_p);
 
-#if JERRY_BUILTIN_PROXY
     if (property_keys_p == NULL)
     {
-      return ECMA_VALUE_ERROR;
-    }
+      property_keys_p = ecma_op_object_get_enumerable_property_names (obj_p, ECMA_ENUMERABLE_PROPERTY_KEYS);
+
+#if JERRY_BUILTIN_PROXY
+      if (property_keys_p == NULL)
+      {
+        return ECMA_VALUE_ERROR;
+      }
 #endif /* JERRY_BUILTIN_PROXY */
+    }
   }
 
   /* 8. */
@@ -1168,9 +2077,6 @@ ecma_builtin_json_serialize_array (ecma_json_stringify_context_t *context_p, /**
   /* 8. - 9. */
   for (ecma_length_t index = 0; index < array_length; index++)
   {
-    /* 9.a */
-    ecma_string_t *index_str_p = ecma_new_ecma_string_from_length (index);
-
     if (has_gap)
     {
       ecma_stringbuilder_append_raw (&context_p->result_builder,
@@ -1178,8 +2084,29 @@ ecma_builtin_json_serialize_array (ecma_json_stringify_context_t *context_p, /**
                                      separator_size);
     }
 
-    ecma_value_t result = ecma_builtin_json_serialize_property (context_p, obj_p, index_str_p);
-    ecma_deref_ecma_string (index_str_p);
+    ecma_value_t result = ECMA_VALUE_NOT_FOUND;
+
+    /* The elements of fast arrays can be read directly, when neither toJSON nor the replacer needs the key. */
+    if (context_p->replacer_function_p == NULL && ecma_op_object_is_fast_array (obj_p)
+        && index < ((ecma_extended_object_t *) obj_p)->u.array.length)
+    {
+      ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_value_t, obj_p->u1.property_list_cp);
+      ecma_value_t value = values_p[index];
+
+      if (!ecma_is_value_array_hole (value) && !ecma_is_value_bigint (value)
+          && (!ecma_is_value_object (value) || ecma_builtin_json_has_no_to_json (ecma_get_object_from_value (value))))
+      {
+        result = ecma_builtin_json_serialize_value (context_p, ecma_copy_value (value));
+      }
+    }
+
+    if (result == ECMA_VALUE_NOT_FOUND)
+    {
+      /* 9.a */
+      ecma_string_t *index_str_p = ecma_new_ecma_string_from_length (index);
+      result = ecma_builtin_json_serialize_property (context_p, obj_p, index_str_p);
+      ecma_deref_ecma_string (index_str_p);
+    }
 
     if (ECMA_IS_VALUE_ERROR (result))
     {
@@ -1244,7 +2171,8 @@ ecma_builtin_json_serialize_property (ecma_json_stringify_context_t *context_p,
   }
 
   /* 3. */
-  if (ecma_is_value_object (value) || ecma_is_value_bigint (value))
+  if ((ecma_is_value_object (value) && !ecma_builtin_json_has_no_to_json (ecma_get_object_from_value (value)))
+      || ecma_is_value_bigint (value))
   {
     ecma_value_t to_object_value = ecma_op_to_object (value);
 
@@ -1304,6 +2232,22 @@ ecma_builtin_json_serialize_property (ecma_json_stringify_context_t *context_p,
     value = result;
   }
 
+  return ecma_builtin_json_serialize_value (context_p, value);
+} /* ecma_builtin_json_serialize_property */
+
+/**
+ * Steps 5 - 12 of abstract operation 'SerializeJSONProperty' defined in 24.3.2.1
+ *
+ * Note:
+ *      the value is released by this function
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_serialize_value (ecma_json_stringify_context_t *context_p, /**< context*/
+                                   ecma_value_t value) /**< value to serialize */
+{
   /* 5. */
   if (ecma_is_value_object (value))
   {
@@ -1402,11 +2346,7 @@ ecma_builtin_json_serialize_property (ecma_json_stringify_context_t *context_p,
     /* 10.a */
     if (!ecma_number_is_nan (num_value) && !ecma_number_is_infinity (num_value))
     {
-      ecma_string_t *result_string_p = ecma_op_to_string (value);
-      JERRY_ASSERT (result_string_p != NULL);
-
-      ecma_stringbuilder_append (&context_p->result_builder, result_string_p);
-      ecma_deref_ecma_string (result_string_p);
+      ecma_builtin_json_append_number (context_p, num_value);
     }
     else
     {
@@ -1460,18 +2400,21 @@ ecma_builtin_json_serialize_property (ecma_json_stringify_context_t *context_p,
   /* 12. */
   ecma_free_value (value);
   return ECMA_VALUE_UNDEFINED;
-} /* ecma_builtin_json_serialize_property */
+} /* ecma_builtin_json_serialize_value */
 
 /**
- * Helper function to stringify an object in JSON format representing an ecma_value.
+ * Helper function to serialize an ecma_value in JSON format into the result builder of the context.
  *
- *  @return ecma_value_t string created from an abject formating by a given context
- *          Returned value must be freed with ecma_free_value.
+ * Note:
+ *      the result builder is only kept if the serialization succeeds
  *
+ * @return ECMA_VALUE_EMPTY - if the JSON text is stored in the result builder
+ *         ECMA_VALUE_UNDEFINED - if the value has no JSON representation
+ *         error - otherwise
  */
 static ecma_value_t
-ecma_builtin_json_str_helper (ecma_json_stringify_context_t *context_p, /**< context argument */
-                              const ecma_value_t arg1) /**< object argument */
+ecma_builtin_json_serialize (ecma_json_stringify_context_t *context_p, /**< context argument */
+                             const ecma_value_t arg1) /**< object argument */
 {
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
   ecma_object_t *obj_wrapper_p = ecma_op_create_object_object_noarg ();
@@ -1494,12 +2437,45 @@ ecma_builtin_json_str_helper (ecma_json_stringify_context_t *context_p, /**< con
   if (ECMA_IS_VALUE_ERROR (ret_value) || ecma_is_value_undefined (ret_value))
   {
     ecma_stringbuilder_destroy (&context_p->result_builder);
+  }
+
+  return ret_value;
+} /* ecma_builtin_json_serialize */
+
+/**
+ * Helper function to stringify an object in JSON format representing an ecma_value.
+ *
+ *  @return ecma_value_t string created from an abject formating by a given context
+ *          Returned value must be freed with ecma_free_value.
+ *
+ */
+static ecma_value_t
+ecma_builtin_json_str_helper (ecma_json_stringify_context_t *context_p, /**< context argument */
+                              const ecma_value_t arg1) /**< object argument */
+{
+  ecma_value_t ret_value = ecma_builtin_json_serialize (context_p, arg1);
+
+  if (!ecma_is_value_empty (ret_value))
+  {
     return ret_value;
   }
 
   return ecma_make_string_value (ecma_stringbuilder_finalize (&context_p->result_builder));
 } /* ecma_builtin_json_str_helper */
 
+/**
+ * Initialize a stringify context without replacer function, property list and indentation
+ */
+static void
+ecma_builtin_json_init_no_opts_context (ecma_json_stringify_context_t *context_p) /**< [out] context */
+{
+  context_p->occurrence_stack_last_p = NULL;
+  context_p->indent_builder = ecma_stringbuilder_create ();
+  context_p->property_list_p = NULL;
+  context_p->replacer_function_p = NULL;
+  context_p->gap_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+} /* ecma_builtin_json_init_no_opts_context */
+
 /**
  * Function to create a JSON string from a JS value.
  *
@@ -1513,11 +2489,7 @@ ecma_value_t
 ecma_builtin_json_stringify_no_opts (const ecma_value_t value) /**< value to stringify */
 {
   ecma_json_stringify_context_t context;
-  context.occurrence_stack_last_p = NULL;
-  context.indent_builder = ecma_stringbuilder_create ();
-  context.property_list_p = NULL;
-  context.replacer_function_p = NULL;
-  context.gap_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+  ecma_builtin_json_init_no_opts_context (&context);
 
   ecma_value_t ret_value = ecma_builtin_json_str_helper (&context, value);
 
@@ -1526,6 +2498,54 @@ ecma_builtin_json_stringify_no_opts (const ecma_value_t value) /**< value to str
   return ret_value;
 } /* ecma_builtin_json_stringify_no_opts */
 
+/**
+ * Function to write the JSON text of a JS value into a buffer in UTF-8 encoding.
+ *
+ * Note:
+ *      the text is only copied when the whole text fits into the buffer,
+ *      no string value is created for the text
+ *
+ * @return - number value containing the size of the JSON text
+ *         - ECMA_VALUE_UNDEFINED if the value has no JSON representation
+ *         - Error value in case of any errors.
+ */
+ecma_value_t
+ecma_builtin_json_stringify_to_buffer (const ecma_value_t value, /**< value to stringify */
+                                       lit_utf8_byte_t *buffer_p, /**< [out] output buffer */
+                                       lit_utf8_size_t buffer_size) /**< size of the output buffer */
+{
+  ecma_json_stringify_context_t context;
+  ecma_builtin_json_init_no_opts_context (&context);
+
+  ecma_value_t ret_value = ecma_builtin_json_serialize (&context, value);
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    const lit_utf8_byte_t *data_p = ecma_stringbuilder_get_data (&context.result_builder);
+    const lit_utf8_size_t data_size = ecma_stringbuilder_get_size (&context.result_builder);
+    const lit_utf8_size_t text_size = lit_get_utf8_size_of_cesu8_string (data_p, data_size);
+
+    if (text_size <= buffer_size)
+    {
+      if (text_size == data_size)
+      {
+        memcpy (buffer_p, data_p, data_size);
+      }
+      else
+      {
+        lit_convert_cesu8_string_to_utf8_string (data_p, data_size, buffer_p, buffer_size);
+      }
+    }
+
+    ecma_stringbuilder_destroy (&context.result_builder);
+    ret_value = ecma_make_uint32_value (text_size);
+  }
+
+  ecma_deref_ecma_string (context.gap_str_p);
+  ecma_stringbuilder_destroy (&context.indent_builder);
+  return ret_value;
+} /* ecma_builtin_json_stringify_to_buffer */
+
 /**
  * The JSON object's 'stringify' routine
  *
@@ -1217,6 +1217,259 @@ ecma_builtin_typedarray_prototype_sort_compare_helper (ecma_value_t lhs, /**< le
   return ecma_make_number_value (ret_num);
 } /* ecma_builtin_typedarray_prototype_sort_compare_helper */
 
+/**
+ * Read an element of a TypedArray as an unsigned integer of the same size.
+ *
+ * @return raw bits of the element
+ */
+static inline uint64_t JERRY_ATTR_ALWAYS_INLINE
+ecma_builtin_typedarray_prototype_sort_get_bits (const uint8_t *element_p, /**< element */
+                                                 uint8_t shift) /**< element size shift */
+{
+  switch (shift)
+  {
+    case 0:
+    {
+      return *element_p;
+    }
+    case 1:
+    {
+      uint16_t bits;
+      memcpy (&bits, element_p, sizeof (uint16_t));
+      return bits;
+    }
+    case 2:
+    {
+      uint32_t bits;
+      memcpy (&bits, element_p, sizeof (uint32_t));
+      return bits;
+    }
+    default:
+    {
+      JERRY_ASSERT (shift == 3);
+      uint64_t bits;
+      memcpy (&bits, element_p, sizeof (uint64_t));
+      return bits;
+    }
+  }
+} /* ecma_builtin_typedarray_prototype_sort_get_bits */
+
+/**
+ * Write an element of a TypedArray as an unsigned integer of the same size.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_builtin_typedarray_prototype_sort_set_bits (uint8_t *element_p, /**< element */
+                                                 uint8_t shift, /**< element size shift */
+                                                 uint64_t bits) /**< raw bits of the element */
+{
+  switch (shift)
+  {
+    case 0:
+    {
+      *element_p = (uint8_t) bits;
+      break;
+    }
+    case 1:
+    {
+      uint16_t value = (uint16_t) bits;
+      memcpy (element_p, &value, sizeof (uint16_t));
+      break;
+    }
+    case 2:
+    {
+      uint32_t value = (uint32_t) bits;
+      memcpy (element_p, &value, sizeof (uint32_t));
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (shift == 3);
+      memcpy (element_p, &bits, sizeof (uint64_t));
+      break;
+    }
+  }
+} /* ecma_builtin_typedarray_prototype_sort_set_bits */
+
+/**
+ * Convert the elements of a TypedArray to unsigned sort keys, or convert the keys back.
+ *
+ * The unsigned order of the keys is the same as the order used by the default comparator:
+ * the sign bit of signed integers is flipped, negative floating point numbers are inverted,
+ * and all NaN values are replaced by a positive quiet NaN, so -0 is before +0 and NaNs are
+ * at the end of the array.
+ */
+static void
+ecma_builtin_typedarray_prototype_sort_convert_keys (uint8_t *buffer_p, /**< start of the elements */
+                                                     ecma_typedarray_info_t *info_p, /**< object info */
+                                                     bool to_keys) /**< true - convert elements to keys,
+                                                                    *   false - convert keys to elements */
+{
+  uint8_t shift = info_p->shift;
+  uint64_t sign_bit = ((uint64_t) 1) << ((8u << shift) - 1);
+  uint64_t mask = sign_bit | (sign_bit - 1);
+  uint8_t *limit_p = buffer_p + (info_p->length << shift);
+
+  switch (info_p->id)
+  {
+    case ECMA_INT8_ARRAY:
+    case ECMA_INT16_ARRAY:
+    case ECMA_INT32_ARRAY:
+    case ECMA_BIGINT64_ARRAY:
+    {
+      for (uint8_t *element_p = buffer_p; element_p < limit_p; element_p += (1u << shift))
+      {
+        uint64_t bits = ecma_builtin_typedarray_prototype_sort_get_bits (element_p, shift);
+        ecma_builtin_typedarray_prototype_sort_set_bits (element_p, shift, bits ^ sign_bit);
+      }
+      break;
+    }
+    case ECMA_FLOAT32_ARRAY:
+    case ECMA_FLOAT64_ARRAY:
+    {
+      /* Exponent bits of positive infinity and the quiet bit of a NaN. */
+      uint64_t infinity_bits = (info_p->id == ECMA_FLOAT32_ARRAY) ? 0x7f800000u : 0x7ff0000000000000u;
+      uint64_t quiet_nan_bits = (info_p->id == ECMA_FLOAT32_ARRAY) ? 0x7fc00000u : 0x7ff8000000000000u;
+
+      for (uint8_t *element_p = buffer_p; element_p < limit_p; element_p += (1u << shift))
+      {
+        uint64_t bits = ecma_builtin_typedarray_prototype_sort_get_bits (element_p, shift);
+
+        if (to_keys)
+        {
+          if ((bits & ~sign_bit) > infinity_bits)
+          {
+            bits = quiet_nan_bits;
+          }
+
+          bits = (bits & sign_bit) ? (~bits & mask) : (bits | sign_bit);
+        }
+        else
+        {
+          bits = (bits & sign_bit) ? (bits ^ sign_bit) : (~bits & mask);
+        }
+
+        ecma_builtin_typedarray_prototype_sort_set_bits (element_p, shift, bits);
+      }
+      break;
+    }
+    default:
+    {
+      /* Unsigned elements are their own keys. */
+      break;
+    }
+  }
+} /* ecma_builtin_typedarray_prototype_sort_convert_keys */
+
+/**
+ * Sort the elements of a TypedArray in place with the default comparator.
+ *
+ * Note:
+ *      the elements are sorted by a least significant digit radix sort on their unsigned keys,
+ *      so no values are allocated and user code is never called
+ *
+ * @return true - if the elements are sorted
+ *         false - if the temporary buffer cannot be allocated
+ */
+static bool
+ecma_builtin_typedarray_prototype_sort_native (ecma_typedarray_info_t *info_p) /**< object info */
+{
+  uint8_t *buffer_p = ecma_arraybuffer_get_buffer (info_p->array_buffer_p) + info_p->offset;
+  uint32_t length = info_p->length;
+  uint8_t shift = info_p->shift;
+  uint32_t counts[256];
+
+  if (shift == 0)
+  {
+    /* Byte sized elements are sorted by counting. */
+    memset (counts, 0, sizeof (counts));
+    ecma_builtin_typedarray_prototype_sort_convert_keys (buffer_p, info_p, true);
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+      counts[buffer_p[i]]++;
+    }
+
+    uint8_t *element_p = buffer_p;
+
+    for (uint32_t digit = 0; digit < 256; digit++)
+    {
+      memset (element_p, (int) digit, counts[digit]);
+      element_p += counts[digit];
+    }
+
+    ecma_builtin_typedarray_prototype_sort_convert_keys (buffer_p, info_p, false);
+    return true;
+  }
+
+  size_t buffer_size = ((size_t) length) << shift;
+  uint8_t *temp_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (buffer_size);
+
+  if (temp_p == NULL)
+  {
+    return false;
+  }
+
+  ecma_builtin_typedarray_prototype_sort_convert_keys (buffer_p, info_p, true);
+
+  uint8_t *source_p = buffer_p;
+  uint8_t *destination_p = temp_p;
+
+  for (uint32_t digit_shift = 0; digit_shift < (8u << shift); digit_shift += 8)
+  {
+    memset (counts, 0, sizeof (counts));
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+      uint64_t bits = ecma_builtin_typedarray_prototype_sort_get_bits (source_p + (i << shift), shift);
+      counts[(bits >> digit_shift) & 0xff]++;
+    }
+
+    uint32_t offset = 0;
+    bool is_sorted_by_digit = false;
+
+    for (uint32_t digit = 0; digit < 256; digit++)
+    {
+      uint32_t count = counts[digit];
+
+      if (count == length)
+      {
+        /* All elements have the same digit. */
+        is_sorted_by_digit = true;
+        break;
+      }
+
+      counts[digit] = offset;
+      offset += count;
+    }
+
+    if (is_sorted_by_digit)
+    {
+      continue;
+    }
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+      uint64_t bits = ecma_builtin_typedarray_prototype_sort_get_bits (source_p + (i << shift), shift);
+      uint32_t index = counts[(bits >> digit_shift) & 0xff]++;
+      ecma_builtin_typedarray_prototype_sort_set_bits (destination_p + (index << shift), shift, bits);
+    }
+
+    uint8_t *swap_p = source_p;
+    source_p = destination_p;
+    destination_p = swap_p;
+  }
+
+  if (source_p != buffer_p)
+  {
+    memcpy (buffer_p, source_p, buffer_size);
+  }
+
+  jmem_heap_free_block (temp_p, buffer_size);
+
+  ecma_builtin_typedarray_prototype_sort_convert_keys (buffer_p, info_p, false);
+  return true;
+} /* ecma_builtin_typedarray_prototype_sort_native */
+
 /**
  * The %TypedArray%.prototype object's 'sort' routine.
  *
@@ -1244,6 +1497,11 @@ ecma_builtin_typedarray_prototype_sort (ecma_value_t this_arg, /**< this argumen
     return ecma_copy_value (this_arg);
   }
 
+  if (ecma_is_value_undefined (compare_func) && ecma_builtin_typedarray_prototype_sort_native (info_p))
+  {
+    return ecma_copy_value (this_arg);
+  }
+
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
   JMEM_DEFINE_LOCAL_ARRAY (values_buffer, info_p->length, ecma_value_t);
 
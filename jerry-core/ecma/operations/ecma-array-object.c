@@ -366,14 +366,12 @@ ecma_fast_array_set_property (ecma_object_t *object_p, /**< fast access mode arr
     if (ecma_is_value_array_hole (values_p[index]))
     {
       ext_obj_p->u.array.length_prop_and_hole_count -= ECMA_FAST_ARRAY_HOLE_ONE;
+      values_p[index] = ecma_copy_value_if_not_object (value);
+      return true;
     }
-    else
-    {
-      ecma_free_value_if_not_object (values_p[index]);
-    }
-
-    values_p[index] = ecma_copy_value_if_not_object (value);
 
+    /* Float numbers are updated in place. */
+    ecma_value_assign_value (values_p + index, value);
     return true;
   }
 
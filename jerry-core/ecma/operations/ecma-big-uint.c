@@ -360,6 +360,24 @@ ecma_big_uint_to_string (ecma_extended_primitive_t *value_p, /**< BigUInt value
   /* This space can be used to store a sign. */
   max_size += (uint32_t) (2 * sizeof (ecma_bigint_digit_t) - 1);
   max_size &= ~(uint32_t) (sizeof (ecma_bigint_digit_t) - 1);
+
+  ecma_bigint_digit_t divisor = radix;
+  uint32_t chars_per_division = 1;
+
+  if (sizeof (uintptr_t) == sizeof (ecma_bigint_two_digits_t))
+  {
+    /* Produce as many characters with one division as possible. Since the
+     * characters are no longer produced one by one, they are stored after
+     * the digits instead of overwriting the already processed digits. */
+    while (divisor <= ~((ecma_bigint_digit_t) 0) / radix)
+    {
+      divisor *= radix;
+      chars_per_division++;
+    }
+
+    max_size += size;
+  }
+
   *char_size_p = max_size;
 
   lit_utf8_byte_t *result_p = (lit_utf8_byte_t *) jmem_heap_alloc_block_null_on_error (max_size);
@@ -386,8 +404,8 @@ ecma_big_uint_to_string (ecma_extended_primitive_t *value_p, /**< BigUInt value
       {
         ecma_bigint_two_digits_t result = *(--current_p) | ECMA_BIGINT_HIGH_DIGIT (remainder);
 
-        *current_p = (ecma_bigint_digit_t) (result / radix);
-        remainder = (ecma_bigint_digit_t) (result % radix);
+        *current_p = (ecma_bigint_digit_t) (result / divisor);
+        remainder = (ecma_bigint_digit_t) (result % divisor);
       } while (current_p > end_p);
     }
     else
@@ -431,14 +449,23 @@ ecma_big_uint_to_string (ecma_extended_primitive_t *value_p, /**< BigUInt value
       }
     }
 
-    *(--string_p) =
-      (lit_utf8_byte_t) ((remainder < 10) ? (remainder + LIT_CHAR_0) : (remainder + (LIT_CHAR_LOWERCASE_A - 10)));
-    JERRY_ASSERT (string_p >= (lit_utf8_byte_t *) start_p);
-
     if (start_p[-1] == 0)
     {
       start_p--;
     }
+
+    uint32_t char_count = chars_per_division;
+
+    /* Leading zeros are only omitted from the most significant characters. */
+    do
+    {
+      ecma_bigint_digit_t char_value = remainder % radix;
+      remainder /= radix;
+
+      *(--string_p) = (lit_utf8_byte_t) ((char_value < 10) ? (char_value + LIT_CHAR_0)
+                                                            : (char_value + (LIT_CHAR_LOWERCASE_A - 10)));
+      JERRY_ASSERT (string_p >= (lit_utf8_byte_t *) start_p);
+    } while (--char_count > 0 && (remainder != 0 || start_p > end_p));
   } while (start_p > end_p);
 
   *char_start_p = (uint32_t) (string_p - result_p);
@@ -759,6 +786,212 @@ ecma_big_uint_sub (ecma_extended_primitive_t *left_value_p, /**< left BigUInt va
   return ecma_big_uint_normalize_result (result_p, current_p);
 } /* ecma_big_uint_sub */
 
+/**
+ * Operands with at least this many digits are multiplied by the Karatsuba algorithm.
+ */
+#define ECMA_BIG_UINT_KARATSUBA_THRESHOLD 32
+
+/**
+ * Add a digit sequence to another digit sequence in place
+ *
+ * return carry of the addition
+ */
+static ecma_bigint_digit_t
+ecma_big_uint_add_digits (ecma_bigint_digit_t *destination_p, /**< [in, out] left operand and result */
+                          uint32_t destination_count, /**< number of digits of the left operand */
+                          const ecma_bigint_digit_t *source_p, /**< right operand */
+                          uint32_t source_count) /**< number of digits of the right operand */
+{
+  JERRY_ASSERT (source_count <= destination_count);
+
+  ecma_bigint_digit_t *end_p = destination_p + destination_count;
+  const ecma_bigint_digit_t *source_end_p = source_p + source_count;
+  ecma_bigint_digit_t carry = 0;
+
+  while (source_p < source_end_p)
+  {
+    ecma_bigint_two_digits_t sum = (ecma_bigint_two_digits_t) *destination_p + *source_p++ + carry;
+
+    *destination_p++ = (ecma_bigint_digit_t) sum;
+    carry = (ecma_bigint_digit_t) (sum >> (8 * sizeof (ecma_bigint_digit_t)));
+  }
+
+  while (carry != 0 && destination_p < end_p)
+  {
+    carry = (++(*destination_p) == 0);
+    destination_p++;
+  }
+
+  return carry;
+} /* ecma_big_uint_add_digits */
+
+/**
+ * Subtract a digit sequence from a not smaller digit sequence in place
+ */
+static void
+ecma_big_uint_sub_digits (ecma_bigint_digit_t *destination_p, /**< [in, out] left operand and result */
+                          uint32_t destination_count, /**< number of digits of the left operand */
+                          const ecma_bigint_digit_t *source_p, /**< right operand */
+                          uint32_t source_count) /**< number of digits of the right operand */
+{
+  JERRY_ASSERT (source_count <= destination_count);
+
+  ecma_bigint_digit_t *end_p = destination_p + destination_count;
+  const ecma_bigint_digit_t *source_end_p = source_p + source_count;
+  ecma_bigint_digit_t borrow = 0;
+
+  while (source_p < source_end_p)
+  {
+    ecma_bigint_two_digits_t difference = (ecma_bigint_two_digits_t) *destination_p - *source_p++ - borrow;
+
+    *destination_p++ = (ecma_bigint_digit_t) difference;
+    borrow = (ecma_bigint_digit_t) ((difference >> (8 * sizeof (ecma_bigint_digit_t))) != 0);
+  }
+
+  while (borrow != 0)
+  {
+    JERRY_ASSERT (destination_p < end_p);
+    borrow = ((*destination_p)-- == 0);
+    destination_p++;
+  }
+
+  JERRY_UNUSED (end_p);
+} /* ecma_big_uint_sub_digits */
+
+/**
+ * Schoolbook multiplication of two digit sequences
+ */
+static void
+ecma_big_uint_mul_digits_basic (const ecma_bigint_digit_t *left_p, /**< left operand */
+                                uint32_t left_count, /**< number of digits of the left operand */
+                                const ecma_bigint_digit_t *right_p, /**< right operand */
+                                uint32_t right_count, /**< number of digits of the right operand */
+                                ecma_bigint_digit_t *result_p) /**< [out] left_count + right_count digits */
+{
+  memset (result_p, 0, (left_count + right_count) * sizeof (ecma_bigint_digit_t));
+
+  for (uint32_t i = 0; i < right_count; i++)
+  {
+    ecma_bigint_two_digits_t right = right_p[i];
+    ecma_bigint_digit_t *destination_p = result_p + i;
+    ecma_bigint_digit_t carry = 0;
+
+    if (right == 0)
+    {
+      continue;
+    }
+
+    for (uint32_t j = 0; j < left_count; j++)
+    {
+      /* The sum cannot overflow: (2^n - 1)^2 + 2 * (2^n - 1) == 2^2n - 1 */
+      ecma_bigint_two_digits_t value = right * left_p[j] + destination_p[j] + carry;
+
+      destination_p[j] = (ecma_bigint_digit_t) value;
+      carry = (ecma_bigint_digit_t) (value >> (8 * sizeof (ecma_bigint_digit_t)));
+    }
+
+    destination_p[left_count] = carry;
+  }
+} /* ecma_big_uint_mul_digits_basic */
+
+/**
+ * Multiply two digit sequences with the Karatsuba algorithm
+ *
+ * Note:
+ *      the scratch buffer must have at least 4 * left_count + 128 digits
+ */
+static void
+ecma_big_uint_mul_digits (const ecma_bigint_digit_t *left_p, /**< left operand */
+                          uint32_t left_count, /**< number of digits of the left operand */
+                          const ecma_bigint_digit_t *right_p, /**< right operand */
+                          uint32_t right_count, /**< number of digits of the right operand */
+                          ecma_bigint_digit_t *result_p, /**< [out] left_count + right_count digits */
+                          ecma_bigint_digit_t *scratch_p) /**< temporary buffer */
+{
+  JERRY_ASSERT (left_count >= right_count);
+
+  if (right_count < ECMA_BIG_UINT_KARATSUBA_THRESHOLD)
+  {
+    ecma_big_uint_mul_digits_basic (left_p, left_count, right_p, right_count, result_p);
+    return;
+  }
+
+  uint32_t half_count = (left_count + 1) / 2;
+
+  if (right_count <= half_count)
+  {
+    /* Unbalanced operands: multiply the right operand with right_count sized slices of the left. */
+    memset (result_p, 0, (left_count + right_count) * sizeof (ecma_bigint_digit_t));
+
+    for (uint32_t offset = 0; offset < left_count; offset += right_count)
+    {
+      uint32_t slice_count = JERRY_MIN (right_count, left_count - offset);
+
+      if (slice_count == right_count)
+      {
+        ecma_big_uint_mul_digits (left_p + offset, slice_count, right_p, right_count, scratch_p, scratch_p + 2 * right_count);
+      }
+      else
+      {
+        ecma_big_uint_mul_digits (right_p, right_count, left_p + offset, slice_count, scratch_p, scratch_p + 2 * right_count);
+      }
+
+      ecma_big_uint_add_digits (result_p + offset,
+                                left_count + right_count - offset,
+                                scratch_p,
+                                slice_count + right_count);
+    }
+    return;
+  }
+
+  /* left = left_high * B^half + left_low, right = right_high * B^half + right_low */
+  uint32_t left_high_count = left_count - half_count;
+  uint32_t right_high_count = right_count - half_count;
+
+  /* The low and high products are stored in their final positions. */
+  ecma_big_uint_mul_digits (left_p, half_count, right_p, half_count, result_p, scratch_p);
+  ecma_big_uint_mul_digits (left_p + half_count,
+                            left_high_count,
+                            right_p + half_count,
+                            right_high_count,
+                            result_p + 2 * half_count,
+                            scratch_p);
+
+  ecma_bigint_digit_t *left_sum_p = scratch_p;
+  ecma_bigint_digit_t *right_sum_p = left_sum_p + half_count + 1;
+  ecma_bigint_digit_t *middle_p = right_sum_p + half_count + 1;
+  uint32_t middle_count = 2 * half_count + 2;
+
+  memcpy (left_sum_p, left_p, half_count * sizeof (ecma_bigint_digit_t));
+  left_sum_p[half_count] = 0;
+  ecma_big_uint_add_digits (left_sum_p, half_count + 1, left_p + half_count, left_high_count);
+
+  memcpy (right_sum_p, right_p, half_count * sizeof (ecma_bigint_digit_t));
+  right_sum_p[half_count] = 0;
+  ecma_big_uint_add_digits (right_sum_p, half_count + 1, right_p + half_count, right_high_count);
+
+  /* middle = (left_low + left_high) * (right_low + right_high) - low - high */
+  ecma_big_uint_mul_digits (left_sum_p,
+                            half_count + 1,
+                            right_sum_p,
+                            half_count + 1,
+                            middle_p,
+                            middle_p + middle_count);
+  ecma_big_uint_sub_digits (middle_p, middle_count, result_p, 2 * half_count);
+  ecma_big_uint_sub_digits (middle_p,
+                            middle_count,
+                            result_p + 2 * half_count,
+                            left_high_count + right_high_count);
+
+  /* The middle product is zero when, for example, both low halves are zero. */
+  while (middle_count > 0 && middle_p[middle_count - 1] == 0)
+  {
+    middle_count--;
+  }
+
+  ecma_big_uint_add_digits (result_p + half_count, left_count + right_count - half_count, middle_p, middle_count);
+} /* ecma_big_uint_mul_digits */
+
 /**
  * Multiply two BigUInt values
  *
@@ -786,6 +1019,40 @@ ecma_big_uint_mul (ecma_extended_primitive_t *left_value_p, /**< left BigUInt va
     right_size = tmp_size;
   }
 
+  if (right_size >= ECMA_BIG_UINT_KARATSUBA_THRESHOLD * sizeof (ecma_bigint_digit_t))
+  {
+    uint32_t left_count = left_size / (uint32_t) sizeof (ecma_bigint_digit_t);
+    size_t scratch_size = (4 * left_count + 128) * sizeof (ecma_bigint_digit_t);
+    ecma_bigint_digit_t *scratch_p = (ecma_bigint_digit_t *) jmem_heap_alloc_block_null_on_error (scratch_size);
+
+    /* Without a scratch buffer the schoolbook algorithm below is used. */
+    if (scratch_p != NULL)
+    {
+      ecma_extended_primitive_t *result_p = ecma_bigint_create (left_size + right_size);
+
+      if (JERRY_UNLIKELY (result_p == NULL))
+      {
+        jmem_heap_free_block (scratch_p, scratch_size);
+        return NULL;
+      }
+
+      ecma_big_uint_mul_digits (ECMA_BIGINT_GET_DIGITS (left_value_p, 0),
+                                left_count,
+                                ECMA_BIGINT_GET_DIGITS (right_value_p, 0),
+                                right_size / (uint32_t) sizeof (ecma_bigint_digit_t),
+                                ECMA_BIGINT_GET_DIGITS (result_p, 0),
+                                scratch_p);
+      jmem_heap_free_block (scratch_p, scratch_size);
+
+      if (ECMA_BIGINT_GET_LAST_DIGIT (result_p, left_size + right_size) != 0)
+      {
+        return result_p;
+      }
+
+      return ecma_big_uint_normalize_result (result_p, ECMA_BIGINT_GET_DIGITS (result_p, left_size + right_size));
+    }
+  }
+
   uint32_t result_size = left_size + right_size - (uint32_t) sizeof (ecma_bigint_digit_t);
 
   ecma_extended_primitive_t *result_p = ecma_bigint_create (result_size);
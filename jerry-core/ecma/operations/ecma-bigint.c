@@ -125,6 +125,11 @@ ecma_bigint_parse_string (const lit_utf8_byte_t *string_p, /**< string represena
     return ECMA_BIGINT_ZERO;
   }
 
+  /* Characters are collected into a single digit before the result is updated. */
+  ecma_bigint_digit_t chunk = 0;
+  ecma_bigint_digit_t chunk_radix = 1;
+  const ecma_bigint_digit_t max_chunk_radix = ~((ecma_bigint_digit_t) 0) / radix;
+
   do
   {
     ecma_bigint_digit_t digit = radix;
@@ -165,25 +170,48 @@ ecma_bigint_parse_string (const lit_utf8_byte_t *string_p, /**< string represena
       return ecma_raise_syntax_error (ECMA_ERR_STRING_CANNOT_BE_CONVERTED_TO_BIGINT_VALUE);
     }
 
-    result_p = ecma_big_uint_mul_digit (result_p, radix, digit);
+    chunk = chunk * radix + digit;
+    chunk_radix *= radix;
 
-    if (JERRY_UNLIKELY (result_p == NULL))
+    if (chunk_radix > max_chunk_radix)
     {
-      break;
+      result_p = ecma_big_uint_mul_digit (result_p, chunk_radix, chunk);
+
+      if (JERRY_UNLIKELY (result_p == NULL))
+      {
+        goto memory_error;
+      }
+
+      chunk = 0;
+      chunk_radix = 1;
     }
   } while (++string_p < string_end_p);
 
-  if (JERRY_UNLIKELY (result_p == NULL))
+  if (chunk_radix > 1)
   {
-    if (options & ECMA_BIGINT_PARSE_DISALLOW_MEMORY_ERROR)
+    result_p = ecma_big_uint_mul_digit (result_p, chunk_radix, chunk);
+
+    if (JERRY_UNLIKELY (result_p == NULL))
     {
-      return ECMA_VALUE_NULL;
+      goto memory_error;
     }
-    return ecma_bigint_raise_memory_error ();
+  }
+
+  if (result_p == NULL)
+  {
+    /* Only zeros and trailing whitespace. */
+    return ECMA_BIGINT_ZERO;
   }
 
   result_p->u.bigint_sign_and_size |= sign;
   return ecma_make_extended_primitive_value (result_p, ECMA_TYPE_BIGINT);
+
+memory_error:
+  if (options & ECMA_BIGINT_PARSE_DISALLOW_MEMORY_ERROR)
+  {
+    return ECMA_VALUE_NULL;
+  }
+  return ecma_bigint_raise_memory_error ();
 } /* ecma_bigint_parse_string */
 
 /**
@@ -17,6 +17,7 @@
 
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
+#include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
@@ -94,6 +95,205 @@ ecma_op_eval_chars_buffer (void *source_p, /**< source code */
 #endif /* JERRY_PARSER */
 } /* ecma_op_eval_chars_buffer */
 
+#if JERRY_PARSER
+
+/**
+ * Get the argument list of a source passed to the eval cache
+ *
+ * @return argument list string - if a dynamic function is parsed
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
+ecma_eval_cache_get_argument_list (const ecma_value_t *source_p, /**< source code and argument list values */
+                                   uint32_t parse_opts) /**< ecma_parse_opts_t option bits */
+{
+  return (parse_opts & ECMA_PARSE_HAS_ARGUMENT_LIST_VALUE) ? source_p[1] : ECMA_VALUE_EMPTY;
+} /* ecma_eval_cache_get_argument_list */
+
+/**
+ * Release the compiled code and the source of an eval cache entry
+ */
+static void
+ecma_eval_cache_free_entry (ecma_eval_cache_entry_t *entry_p) /**< cache entry */
+{
+  JERRY_ASSERT (entry_p->bytecode_p != NULL);
+
+  ecma_bytecode_deref (entry_p->bytecode_p);
+  ecma_free_value (entry_p->source);
+  ecma_free_value (entry_p->argument_list);
+  entry_p->bytecode_p = NULL;
+} /* ecma_eval_cache_free_entry */
+
+/**
+ * Search the eval cache for the compiled code of a source
+ *
+ * Note:
+ *      the reference counter of the returned compiled code is increased
+ *
+ * @return compiled code - if the source was compiled in the current realm with the same options
+ *         NULL - otherwise
+ */
+ecma_compiled_code_t *
+ecma_eval_cache_lookup (const ecma_value_t *source_p, /**< source code and argument list values */
+                        uint32_t parse_opts) /**< ecma_parse_opts_t option bits */
+{
+  ecma_eval_cache_entry_t *entry_p = JERRY_CONTEXT (eval_cache_p);
+
+  if (entry_p == NULL)
+  {
+    return NULL;
+  }
+
+  ecma_string_t *source_str_p = ecma_get_string_from_value (source_p[0]);
+  ecma_value_t argument_list = ecma_eval_cache_get_argument_list (source_p, parse_opts);
+  ecma_eval_cache_entry_t *end_p = entry_p + ECMA_EVAL_CACHE_SIZE;
+
+  for (; entry_p < end_p; entry_p++)
+  {
+    ecma_compiled_code_t *bytecode_p = entry_p->bytecode_p;
+
+    if (bytecode_p == NULL || entry_p->parse_opts != parse_opts)
+    {
+      continue;
+    }
+
+#if JERRY_BUILTIN_REALMS
+    if ((ecma_object_t *) ecma_op_function_get_realm (bytecode_p) != (ecma_object_t *) JERRY_CONTEXT (global_object_p))
+    {
+      continue;
+    }
+#endif /* JERRY_BUILTIN_REALMS */
+
+    if (!ecma_compare_ecma_strings (ecma_get_string_from_value (entry_p->source), source_str_p))
+    {
+      continue;
+    }
+
+    if (argument_list != ECMA_VALUE_EMPTY
+        && !ecma_compare_ecma_strings (ecma_get_string_from_value (entry_p->argument_list),
+                                       ecma_get_string_from_value (argument_list)))
+    {
+      continue;
+    }
+
+    if (bytecode_p->refs >= ECMA_EVAL_CACHE_MAX_REFS)
+    {
+      /* The functions created from the cached code must not exhaust its reference counter. */
+      ecma_eval_cache_free_entry (entry_p);
+      return NULL;
+    }
+
+    ecma_bytecode_ref (bytecode_p);
+    return bytecode_p;
+  }
+
+  return NULL;
+} /* ecma_eval_cache_lookup */
+
+/**
+ * Store the compiled code of a source in the eval cache
+ */
+void
+ecma_eval_cache_insert (const ecma_value_t *source_p, /**< source code and argument list values */
+                        uint32_t parse_opts, /**< ecma_parse_opts_t option bits */
+                        ecma_compiled_code_t *bytecode_p) /**< compiled code of the source */
+{
+  ecma_eval_cache_entry_t *cache_p = JERRY_CONTEXT (eval_cache_p);
+
+  if (cache_p == NULL)
+  {
+    const size_t cache_size = ECMA_EVAL_CACHE_SIZE * sizeof (ecma_eval_cache_entry_t);
+    cache_p = (ecma_eval_cache_entry_t *) jmem_heap_alloc_block_null_on_error (cache_size);
+
+    if (cache_p == NULL)
+    {
+      return;
+    }
+
+    for (uint32_t i = 0; i < ECMA_EVAL_CACHE_SIZE; i++)
+    {
+      cache_p[i].bytecode_p = NULL;
+    }
+
+    JERRY_CONTEXT (eval_cache_p) = cache_p;
+    JERRY_CONTEXT (eval_cache_idx) = 0;
+  }
+
+  uint8_t cache_idx = JERRY_CONTEXT (eval_cache_idx);
+  ecma_eval_cache_entry_t *entry_p = cache_p + cache_idx;
+
+  if (entry_p->bytecode_p != NULL)
+  {
+    ecma_eval_cache_free_entry (entry_p);
+  }
+
+  ecma_bytecode_ref (bytecode_p);
+  entry_p->bytecode_p = bytecode_p;
+  entry_p->source = ecma_copy_value (source_p[0]);
+  entry_p->argument_list = ecma_copy_value (ecma_eval_cache_get_argument_list (source_p, parse_opts));
+  entry_p->parse_opts = parse_opts;
+
+  JERRY_CONTEXT (eval_cache_idx) = (uint8_t) ((cache_idx + 1) % ECMA_EVAL_CACHE_SIZE);
+} /* ecma_eval_cache_insert */
+
+/**
+ * Free the eval cache and the compiled codes stored in it
+ */
+void
+ecma_eval_cache_free (void)
+{
+  ecma_eval_cache_entry_t *cache_p = JERRY_CONTEXT (eval_cache_p);
+
+  if (cache_p == NULL)
+  {
+    return;
+  }
+
+  JERRY_CONTEXT (eval_cache_p) = NULL;
+
+  for (uint32_t i = 0; i < ECMA_EVAL_CACHE_SIZE; i++)
+  {
+    if (cache_p[i].bytecode_p != NULL)
+    {
+      ecma_eval_cache_free_entry (cache_p + i);
+    }
+  }
+
+  jmem_heap_free_block (cache_p, ECMA_EVAL_CACHE_SIZE * sizeof (ecma_eval_cache_entry_t));
+} /* ecma_eval_cache_free */
+
+#if JERRY_BUILTIN_REALMS
+
+/**
+ * Remove the compiled codes of a realm from the eval cache
+ *
+ * Note:
+ *      called when the global object of the realm is freed
+ */
+void
+ecma_eval_cache_remove_realm (ecma_object_t *realm_p) /**< global object of the realm */
+{
+  ecma_eval_cache_entry_t *cache_p = JERRY_CONTEXT (eval_cache_p);
+
+  if (cache_p == NULL)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < ECMA_EVAL_CACHE_SIZE; i++)
+  {
+    if (cache_p[i].bytecode_p != NULL
+        && (ecma_object_t *) ecma_op_function_get_realm (cache_p[i].bytecode_p) == realm_p)
+    {
+      ecma_eval_cache_free_entry (cache_p + i);
+    }
+  }
+} /* ecma_eval_cache_remove_realm */
+
+#endif /* JERRY_BUILTIN_REALMS */
+
+#endif /* JERRY_PARSER */
+
 /**
  * @}
  * @}
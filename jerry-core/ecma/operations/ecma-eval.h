@@ -29,6 +29,15 @@ ecma_value_t ecma_op_eval (ecma_value_t source_code, uint32_t parse_opts);
 
 ecma_value_t ecma_op_eval_chars_buffer (void *source_p, uint32_t parse_opts);
 
+#if JERRY_PARSER
+ecma_compiled_code_t *ecma_eval_cache_lookup (const ecma_value_t *source_p, uint32_t parse_opts);
+void ecma_eval_cache_insert (const ecma_value_t *source_p, uint32_t parse_opts, ecma_compiled_code_t *bytecode_p);
+void ecma_eval_cache_free (void);
+#if JERRY_BUILTIN_REALMS
+void ecma_eval_cache_remove_realm (ecma_object_t *realm_p);
+#endif /* JERRY_BUILTIN_REALMS */
+#endif /* JERRY_PARSER */
+
 /**
  * @}
  * @}
@@ -700,6 +700,35 @@ ecma_op_object_find_own (ecma_value_t base_value, /**< base value */
   return ecma_op_invoke_getter (ecma_get_named_accessor_property (prop_value_p), base_value);
 } /* ecma_op_object_find_own */
 
+/**
+ * Get an element of a fast access mode array without the generic property lookup
+ *
+ * @return copy of the element - if the element is stored in the array
+ *         ECMA_VALUE_NOT_FOUND - otherwise (the object is not a fast array, or the element is a hole)
+ *         Returned value must be freed with ecma_free_value
+ */
+static inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
+ecma_op_object_find_fast_array_element (ecma_object_t *object_p, /**< the object */
+                                        ecma_length_t index) /**< property index */
+{
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_ARRAY)
+  {
+    ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+    if (ecma_op_array_is_fast_array (ext_object_p) && index < ext_object_p->u.array.length)
+    {
+      ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_value_t, object_p->u1.property_list_cp);
+
+      if (!ecma_is_value_array_hole (values_p[index]))
+      {
+        return ecma_fast_copy_value (values_p[index]);
+      }
+    }
+  }
+
+  return ECMA_VALUE_NOT_FOUND;
+} /* ecma_op_object_find_fast_array_element */
+
 /**
  * Search the value corresponding to a property index
  *
@@ -713,6 +742,13 @@ ecma_value_t
 ecma_op_object_find_by_index (ecma_object_t *object_p, /**< the object */
                               ecma_length_t index) /**< property index */
 {
+  ecma_value_t element = ecma_op_object_find_fast_array_element (object_p, index);
+
+  if (ecma_is_value_found (element))
+  {
+    return element;
+  }
+
   if (JERRY_LIKELY (index <= ECMA_DIRECT_STRING_MAX_IMM))
   {
     return ecma_op_object_find (object_p, ECMA_CREATE_DIRECT_UINT32_STRING (index));
@@ -846,6 +882,13 @@ ecma_value_t
 ecma_op_object_get_by_index (ecma_object_t *object_p, /**< the object */
                              ecma_length_t index) /**< property index */
 {
+  ecma_value_t element = ecma_op_object_find_fast_array_element (object_p, index);
+
+  if (ecma_is_value_found (element))
+  {
+    return element;
+  }
+
   if (JERRY_LIKELY (index <= ECMA_DIRECT_STRING_MAX_IMM))
   {
     return ecma_op_object_get (object_p, ECMA_CREATE_DIRECT_UINT32_STRING (index));
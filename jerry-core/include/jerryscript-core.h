@@ -94,6 +94,15 @@ void jerry_register_magic_strings (const jerry_char_t *const *ext_strings_p,
  */
 jerry_value_t jerry_parse (const jerry_char_t *source_p, size_t source_size, const jerry_parse_options_t *options_p);
 jerry_value_t jerry_parse_value (const jerry_value_t source, const jerry_parse_options_t *options_p);
+void jerry_parse_cache (jerry_parse_cache_load_cb_t load_callback,
+                        jerry_parse_cache_store_cb_t store_callback,
+                        void *user_p);
+bool jerry_parse_stats (jerry_parse_stats_t *out_stats_p);
+bool jerry_byte_code_stats (const jerry_value_t value,
+                            jerry_byte_code_stats_t *out_stats_p,
+                            jerry_function_stats_cb_t function_callback,
+                            jerry_opcode_stats_cb_t opcode_callback,
+                            void *user_p);
 /**
  * jerry-api-code-parse @}
  */
@@ -1076,10 +1085,26 @@ void jerry_error_on_created (jerry_error_object_created_cb_t callback, void *use
  */
 jerry_value_t jerry_json_parse (const jerry_char_t *string_p, jerry_size_t string_size);
 jerry_value_t jerry_json_stringify (const jerry_value_t object);
+jerry_value_t jerry_json_stringify_to_buffer (const jerry_value_t object,
+                                             jerry_char_t *buffer_p,
+                                             jerry_size_t buffer_size);
 /**
  * jerry-api-json-op @}
  */
 
+/**
+ * @defgroup jerry-api-json-parser Incremental parser
+ * @{
+ */
+jerry_json_parser_t *jerry_json_parser_new (uint32_t options, jerry_json_parser_cb_t callback, void *user_p);
+jerry_value_t jerry_json_parser_feed (jerry_json_parser_t *parser_p,
+                                      const jerry_char_t *chunk_p,
+                                      jerry_size_t chunk_size);
+jerry_value_t jerry_json_parser_finish (jerry_json_parser_t *parser_p);
+/**
+ * jerry-api-json-parser @}
+ */
+
 /**
  * jerry-api-json @}
  */
@@ -287,7 +287,7 @@ int32_t jerry_port_local_tza (double unix_ms);
 /**
  * Get the current system time in UTC.
  *
- * This port function is called by jerry-core when JERRY_BUILTIN_DATE is enabled.
+ * This port function is called by jerry-core when JERRY_BUILTIN_DATE or JERRY_PARSER_STATS is enabled.
  * It can also be used in the implementing application to initialize the random number generator.
  *
  * @return milliseconds since Unix epoch
@@ -27,7 +27,7 @@ JERRY_C_API_BEGIN
 /**
  * Jerry snapshot format version.
  */
-#define JERRY_SNAPSHOT_VERSION (70u)
+#define JERRY_SNAPSHOT_VERSION (72u)
 
 /**
  * Flags for jerry_generate_snapshot and jerry_generate_function_snapshot.
@@ -35,6 +35,7 @@ JERRY_C_API_BEGIN
 typedef enum
 {
   JERRY_SNAPSHOT_SAVE_STATIC = (1u << 0), /**< static snapshot */
+  JERRY_SNAPSHOT_SAVE_OPTIMIZE_SIZE = (1u << 1), /**< minimize the snapshot size */
 } jerry_generate_snapshot_opts_t;
 
 /**
@@ -105,6 +105,7 @@ typedef enum
   JERRY_FEATURE_MODULE, /**< Module support */
   JERRY_FEATURE_WEAKREF, /**< WeakRef support */
   JERRY_FEATURE_FUNCTION_TO_STRING, /**< function toString support */
+  JERRY_FEATURE_PARSER_STATS, /**< parser and byte code statistics */
   JERRY_FEATURE__COUNT /**< number of features. NOTE: must be at the end of the list */
 } jerry_feature_t;
 
@@ -262,6 +263,55 @@ typedef struct
   size_t reserved[4]; /**< padding for future extensions */
 } jerry_heap_stats_t;
 
+/**
+ * Description of the parser statistics.
+ * It is for parser profiling.
+ */
+typedef struct
+{
+  size_t version; /**< the version of the stats struct */
+  size_t parse_count; /**< number of parsed scripts, modules and functions */
+  size_t source_size; /**< total size of the parsed source code (including argument lists) */
+  double scanner_time; /**< time spent in the scanner pre-pass (in milliseconds) */
+  double parser_time; /**< time spent in the parser and the byte code emitter (in milliseconds) */
+} jerry_parse_stats_t;
+
+/**
+ * Description of the byte code statistics of a compiled script or function,
+ * including all functions nested in it.
+ */
+typedef struct
+{
+  size_t version; /**< the version of the stats struct */
+  uint32_t function_count; /**< number of compiled functions */
+  uint32_t byte_code_size; /**< total size of the compiled code blocks */
+  uint32_t instruction_size; /**< total size of the instructions */
+  uint32_t instruction_count; /**< total number of instructions */
+  uint32_t identifier_count; /**< total number of identifier literals */
+  uint32_t literal_count; /**< total number of constant literals */
+  uint32_t max_register_count; /**< maximum number of registers used by a function */
+  uint32_t max_stack_limit; /**< maximum stack depth required by a function */
+} jerry_byte_code_stats_t;
+
+/**
+ * Description of the byte code statistics of a single compiled function.
+ */
+typedef struct
+{
+  uint32_t depth; /**< nesting depth of the function (0 for the outermost code) */
+  uint32_t line; /**< start line of the function (0 if unknown) */
+  uint32_t column; /**< start column of the function (0 if unknown) */
+  uint32_t byte_code_size; /**< size of the compiled code block */
+  uint32_t instruction_size; /**< size of the instructions */
+  uint32_t instruction_count; /**< number of instructions */
+  uint32_t argument_count; /**< number of formal arguments */
+  uint32_t register_count; /**< number of registers (including the arguments) */
+  uint32_t stack_limit; /**< maximum stack depth */
+  uint32_t identifier_count; /**< number of identifier literals */
+  uint32_t literal_count; /**< number of constant literals */
+  uint32_t function_count; /**< number of directly nested functions and regular expressions */
+} jerry_function_stats_t;
+
 /**
  * Call related information passed to jerry_external_handler_t.
  */
@@ -331,6 +381,57 @@ typedef jerry_value_t (*jerry_halt_cb_t) (void *user_data_p);
  */
 typedef void (*jerry_throw_cb_t) (const jerry_value_t exception_value, void *user_data_p);
 
+/**
+ * Callback which is called before a source code is parsed to get the pre-scanning
+ * data stored by jerry_parse_cache_store_cb_t for the same source code.
+ *
+ * Note: the engine validates and copies the data before the parsing continues,
+ *       so the returned buffer only needs to be kept alive until the parsing
+ *       of the source code is completed.
+ *
+ * @param source_hash: hash of the source code and its parsing options
+ * @param data_size_p: [out] size of the returned data
+ * @param user_p: user pointer passed to jerry_parse_cache
+ *
+ * @return pointer to the stored data - if it is available, NULL - otherwise
+ */
+typedef const uint8_t *(*jerry_parse_cache_load_cb_t) (uint32_t source_hash, size_t *data_size_p, void *user_p);
+
+/**
+ * Callback which is called after a source code is successfully parsed
+ * to store its pre-scanning data. The data can be used to skip the
+ * pre-scanning when the same source code is parsed again.
+ *
+ * Note: the data is only valid until the callback returns.
+ *
+ * @param source_hash: hash of the source code and its parsing options
+ * @param data_p: pre-scanning data
+ * @param data_size: size of the data
+ * @param user_p: user pointer passed to jerry_parse_cache
+ */
+typedef void (*jerry_parse_cache_store_cb_t) (uint32_t source_hash,
+                                              const uint8_t *data_p,
+                                              size_t data_size,
+                                              void *user_p);
+
+/**
+ * Callback which is called by jerry_byte_code_stats for each compiled function.
+ *
+ * @param stats_p: statistics of the function
+ * @param user_p: user pointer passed to jerry_byte_code_stats
+ */
+typedef void (*jerry_function_stats_cb_t) (const jerry_function_stats_t *stats_p, void *user_p);
+
+/**
+ * Callback which is called by jerry_byte_code_stats for each opcode used by the compiled functions.
+ *
+ * @param opcode_name_p: name of the opcode
+ * @param count: number of occurrences of the opcode
+ * @param size: total size of these instructions (including their arguments)
+ * @param user_p: user pointer passed to jerry_byte_code_stats
+ */
+typedef void (*jerry_opcode_stats_cb_t) (const char *opcode_name_p, uint32_t count, uint32_t size, void *user_p);
+
 /**
  * Function type applied to each unit of encoding when iterating over a string.
  *
@@ -863,6 +964,37 @@ typedef void (*jerry_arraybuffer_free_cb_t) (jerry_arraybuffer_type_t buffer_typ
                                              void *arraybuffer_user_p,
                                              void *user_p);
 
+/**
+ * JSON parser related types.
+ */
+
+/**
+ * Option bits for jerry_json_parser_new.
+ */
+typedef enum
+{
+  JERRY_JSON_PARSER_NO_OPTS = 0, /**< the input is a single JSON value returned by jerry_json_parser_finish */
+  JERRY_JSON_PARSER_ARRAY_ELEMENTS = (1u << 0), /**< the elements of the top-level array are passed
+                                                 *   to the callback one by one */
+  JERRY_JSON_PARSER_VALUE_SEQUENCE = (1u << 1), /**< the input is a whitespace separated sequence of
+                                                 *   JSON values (e.g. newline delimited JSON) */
+} jerry_json_parser_option_t;
+
+/**
+ * Callback which is called by the incremental JSON parser for each completed value.
+ */
+typedef void (*jerry_json_parser_cb_t) (const jerry_value_t value, void *user_p);
+
+/*
+ * Internal data structure for jerry_json_parser_t definition.
+ */
+struct jerry_json_parser_internal_t;
+
+/**
+ * Incremental JSON parser created by jerry_json_parser_new.
+ */
+typedef struct jerry_json_parser_internal_t jerry_json_parser_t;
+
 /**
  * Helper to expand string literal to [string pointer, string size] argument pair.
  */
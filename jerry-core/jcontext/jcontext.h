@@ -129,6 +129,18 @@ struct jerry_context_t
 #endif /* JERRY_CPOINTER_32_BIT */
   const lit_utf8_byte_t *const *lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
+  jmem_cpointer_t *string_index_p; /**< hash index of the literal string list (NULL if not built) */
+#if JERRY_PARSER
+  parser_arena_t *parser_arena_p; /**< arena of the running parser (NULL if no parsing is in progress) */
+  parser_arena_page_t *parser_arena_cache_p; /**< arena pages kept for the next parser */
+  ecma_eval_cache_entry_t *eval_cache_p; /**< compiled eval and dynamic function code (NULL if not allocated) */
+  jerry_parse_cache_load_cb_t parse_cache_load_callback_p; /**< callback which provides stored scanner data */
+  jerry_parse_cache_store_cb_t parse_cache_store_callback_p; /**< callback which stores scanner data */
+  void *parse_cache_user_p; /**< user pointer for parse cache callbacks */
+#if JERRY_PARSER_STATS
+  jerry_parse_stats_t parse_stats; /**< parser statistics */
+#endif /* JERRY_PARSER_STATS */
+#endif /* JERRY_PARSER */
   jmem_cpointer_t ecma_gc_objects_cp; /**< List of currently alive objects. */
   jmem_cpointer_t string_list_first_cp; /**< first item of the literal string list */
   jmem_cpointer_t symbol_list_first_cp; /**< first item of the global symbol list */
@@ -163,6 +175,8 @@ struct jerry_context_t
                            *   causes call of "try give memory back" callbacks */
   ecma_value_t error_value; /**< currently thrown error value */
   uint32_t lit_magic_string_ex_count; /**< external magic strings count */
+  uint32_t string_list_count; /**< number of strings in the literal string list */
+  uint32_t string_index_size; /**< number of slots of the literal string hash index */
   uint32_t jerry_init_flags; /**< run-time configuration flags */
   uint32_t status_flags; /**< run-time flags (the top 8 bits are used for passing class parsing options) */
 
@@ -175,9 +189,16 @@ struct jerry_context_t
                                           *   if !0 property hashmap allocation is disabled */
 #endif /* JERRY_PROPERTY_HASHMAP */
 
+#if JERRY_BUILTIN_DATE
+  ecma_date_cache_t date_cache; /**< cache of recently computed date components */
+#endif /* JERRY_BUILTIN_DATE */
+
 #if JERRY_BUILTIN_REGEXP
   uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
 #endif /* JERRY_BUILTIN_REGEXP */
+#if JERRY_PARSER
+  uint8_t eval_cache_idx; /**< evicted item index when eval cache is full (round-robin) */
+#endif /* JERRY_PARSER */
   ecma_job_queue_item_t *job_queue_head_p; /**< points to the head item of the job queue */
   ecma_job_queue_item_t *job_queue_tail_p; /**< points to the tail item of the job queue */
 #if JERRY_PROMISE_CALLBACK
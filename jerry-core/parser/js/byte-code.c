@@ -40,7 +40,7 @@ JERRY_STATIC_ASSERT (CBC_EXT_END == 170, number_of_cbc_ext_opcodes_changed);
  * @{
  */
 
-#if JERRY_PARSER || JERRY_PARSER_DUMP_BYTE_CODE
+#if JERRY_PARSER || JERRY_PARSER_DUMP_BYTE_CODE || JERRY_PARSER_STATS
 
 /**
  * Compact bytecode definition
@@ -59,9 +59,9 @@ const uint8_t cbc_ext_flags[] = { CBC_EXT_OPCODE_LIST };
 
 #undef CBC_OPCODE
 
-#endif /* JERRY_PARSER || JERRY_PARSER_DUMP_BYTE_CODE */
+#endif /* JERRY_PARSER || JERRY_PARSER_DUMP_BYTE_CODE || JERRY_PARSER_STATS */
 
-#if JERRY_PARSER_DUMP_BYTE_CODE
+#if JERRY_PARSER_DUMP_BYTE_CODE || JERRY_PARSER_STATS
 
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) #arg1,
 
@@ -77,7 +77,7 @@ const char* const cbc_ext_names[] = { CBC_EXT_OPCODE_LIST };
 
 #undef CBC_OPCODE
 
-#endif /* JERRY_PARSER_DUMP_BYTE_CODE */
+#endif /* JERRY_PARSER_DUMP_BYTE_CODE || JERRY_PARSER_STATS */
 
 /**
  * @}
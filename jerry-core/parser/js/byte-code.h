@@ -1037,7 +1037,7 @@ typedef enum
 extern const uint8_t cbc_flags[];
 extern const uint8_t cbc_ext_flags[];
 
-#if JERRY_PARSER_DUMP_BYTE_CODE
+#if JERRY_PARSER_DUMP_BYTE_CODE || JERRY_PARSER_STATS
 
 /**
  * Opcode names for debugging.
@@ -1045,7 +1045,7 @@ extern const uint8_t cbc_ext_flags[];
 extern const char *const cbc_names[];
 extern const char *const cbc_ext_names[];
 
-#endif /* JERRY_PARSER_DUMP_BYTE_CODE */
+#endif /* JERRY_PARSER_DUMP_BYTE_CODE || JERRY_PARSER_STATS */
 
 /**
  * @}
@@ -55,6 +55,105 @@ align_column_to_tab (parser_line_counter_t column) /**< current column */
   return (parser_line_counter_t) (((column + (8u - 1u)) & ~ECMA_STRING_CONTAINER_MASK) + 1u);
 } /* align_column_to_tab */
 
+/**
+ * Machine word type used for scanning several source bytes at once.
+ */
+typedef uintptr_t lexer_word_t;
+
+/**
+ * Machine word which has all of its bytes set to one.
+ */
+#define LEXER_WORD_ONES ((lexer_word_t) -1 / 0xff)
+
+/**
+ * Machine word which has all of its bytes set to the given byte.
+ */
+#define LEXER_WORD_REPEAT(byte) (LEXER_WORD_ONES * (uint8_t) (byte))
+
+/**
+ * Checks whether any byte of the machine word is less than value (value must not be greater than 0x80).
+ */
+#define LEXER_WORD_HAS_BYTE_LESS_THAN(word, value) \
+  (((word) - LEXER_WORD_REPEAT (value)) & ~(word) & LEXER_WORD_REPEAT (0x80))
+
+/**
+ * Checks whether any byte of the machine word is equal to the given byte.
+ */
+#define LEXER_WORD_HAS_BYTE(word, byte) LEXER_WORD_HAS_BYTE_LESS_THAN ((word) ^ LEXER_WORD_REPEAT (byte), 1)
+
+/**
+ * Checks whether a byte is a printable ASCII character.
+ */
+#define LEXER_IS_PRINTABLE_ASCII(byte) ((byte) >= LIT_CHAR_SP && (byte) < 0x7f)
+
+/**
+ * Find the end of a sequence of printable ASCII characters which does not contain any of the stop
+ * characters. Each of these characters occupies a single byte and a single column, so callers
+ * can skip the whole sequence without examining its characters one by one.
+ *
+ * Note:
+ *   the source is processed one machine word at a time while no word contains any
+ *   interesting byte, and the remaining bytes are processed one by one
+ *
+ * @return pointer to the first byte which is not part of the sequence
+ */
+static const uint8_t *
+lexer_find_ascii_sequence_end (const uint8_t *source_p, /**< current source position */
+                               const uint8_t *source_end_p, /**< end of the source */
+                               uint8_t stop1, /**< first stop character */
+                               uint8_t stop2, /**< second stop character */
+                               uint8_t stop3) /**< third stop character */
+{
+  while (source_p + sizeof (lexer_word_t) <= source_end_p)
+  {
+    lexer_word_t word;
+    memcpy (&word, source_p, sizeof (lexer_word_t));
+
+    if ((word & LEXER_WORD_REPEAT (0x80)) || LEXER_WORD_HAS_BYTE_LESS_THAN (word, LIT_CHAR_SP)
+        || LEXER_WORD_HAS_BYTE (word, 0x7f) || LEXER_WORD_HAS_BYTE (word, stop1) || LEXER_WORD_HAS_BYTE (word, stop2)
+        || LEXER_WORD_HAS_BYTE (word, stop3))
+    {
+      break;
+    }
+
+    source_p += sizeof (lexer_word_t);
+  }
+
+  while (source_p < source_end_p && LEXER_IS_PRINTABLE_ASCII (*source_p) && *source_p != stop1
+         && *source_p != stop2 && *source_p != stop3)
+  {
+    source_p++;
+  }
+
+  return source_p;
+} /* lexer_find_ascii_sequence_end */
+
+/**
+ * Find the end of a sequence of ASCII identifier part characters.
+ *
+ * @return pointer to the first byte which is not part of the sequence
+ */
+static inline const uint8_t *JERRY_ATTR_ALWAYS_INLINE
+lexer_find_ascii_identifier_end (const uint8_t *source_p, /**< current source position */
+                                 const uint8_t *source_end_p) /**< end of the source */
+{
+  while (source_p < source_end_p)
+  {
+    uint8_t chr = *source_p;
+    uint8_t lowercase_chr = (uint8_t) LEXER_TO_ASCII_LOWERCASE (chr);
+
+    if (!((lowercase_chr >= LIT_CHAR_LOWERCASE_A && lowercase_chr <= LIT_CHAR_LOWERCASE_Z)
+          || (chr >= LIT_CHAR_0 && chr <= LIT_CHAR_9) || chr == LIT_CHAR_DOLLAR_SIGN || chr == LIT_CHAR_UNDERSCORE))
+    {
+      break;
+    }
+
+    source_p++;
+  }
+
+  return source_p;
+} /* lexer_find_ascii_identifier_end */
+
 /**
  * Parse hexadecimal character sequence
  *
@@ -372,6 +471,21 @@ lexer_skip_spaces (parser_context_t *context_p) /**< context */
       return;
     }
 
+    /* Comment bodies are mostly printable ASCII characters which can be skipped together. The
+     * last character of the sequence is processed below, since its column depends on the next byte. */
+    const uint8_t *ascii_end_p =
+      lexer_find_ascii_sequence_end (context_p->source_p,
+                                     source_end_p,
+                                     LIT_CHAR_LF,
+                                     LIT_CHAR_LF,
+                                     (mode == LEXER_SKIP_MULTI_LINE_COMMENT) ? LIT_CHAR_ASTERISK : LIT_CHAR_LF);
+
+    if (ascii_end_p - context_p->source_p > 1)
+    {
+      PARSER_PLUS_EQUAL_LC (context_p->column, ascii_end_p - context_p->source_p - 1);
+      context_p->source_p = ascii_end_p - 1;
+    }
+
     context_p->source_p++;
 
     if (context_p->source_p < source_end_p && !IS_UTF8_INTERMEDIATE_OCTET (context_p->source_p[0]))
@@ -710,6 +824,12 @@ lexer_parse_identifier (parser_context_t *context_p, /**< context */
     source_p += utf8_length;
     length += decoded_length;
     PARSER_PLUS_EQUAL_LC (column, char_count);
+
+    /* Most identifiers are ASCII, so the rest of the ASCII characters are consumed without decoding. */
+    const uint8_t *ascii_end_p = lexer_find_ascii_identifier_end (source_p, source_end_p);
+    length += (size_t) (ascii_end_p - source_p);
+    PARSER_PLUS_EQUAL_LC (column, ascii_end_p - source_p);
+    source_p = ascii_end_p;
   } while (source_p < source_end_p);
 
   JERRY_ASSERT (length > 0);
@@ -878,8 +998,18 @@ lexer_parse_string (parser_context_t *context_p, /**< context */
     str_end_character = LIT_CHAR_GRAVE_ACCENT;
   }
 
+  /* Templates are also terminated by a substitution. */
+  uint8_t str_stop_character = (str_end_character == LIT_CHAR_GRAVE_ACCENT) ? LIT_CHAR_DOLLAR_SIGN : str_end_character;
+
   while (true)
   {
+    const uint8_t *ascii_end_p =
+      lexer_find_ascii_sequence_end (source_p, source_end_p, str_end_character, LIT_CHAR_BACKSLASH, str_stop_character);
+
+    length += (size_t) (ascii_end_p - source_p);
+    PARSER_PLUS_EQUAL_LC (column, ascii_end_p - source_p);
+    source_p = ascii_end_p;
+
     if (source_p >= source_end_p)
     {
       context_p->token.line = original_line;
@@ -2502,6 +2632,80 @@ lexer_construct_literal_object (parser_context_t *context_p, /**< context */
   JERRY_ASSERT (context_p->u.allocated_buffer_p == NULL);
 } /* lexer_construct_literal_object */
 
+/**
+ * Construct a string literal object from the concatenation of two string literals.
+ *
+ * Note: the length of the result must not exceed PARSER_MAXIMUM_STRING_LENGTH
+ *
+ * @return index of the concatenated string literal
+ */
+uint16_t
+lexer_construct_concat_string_object (parser_context_t *context_p, /**< context */
+                                      uint16_t left_index, /**< index of the left string literal */
+                                      uint16_t right_index) /**< index of the right string literal */
+{
+  lexer_literal_t *left_p = PARSER_GET_LITERAL (left_index);
+  lexer_literal_t *right_p = PARSER_GET_LITERAL (right_index);
+
+  JERRY_ASSERT (left_p->type == LEXER_STRING_LITERAL && right_p->type == LEXER_STRING_LITERAL);
+
+  size_t left_length = left_p->prop.length;
+  size_t length = left_length + right_p->prop.length;
+
+  JERRY_ASSERT (length <= PARSER_MAXIMUM_STRING_LENGTH);
+
+  if (right_p->prop.length == 0)
+  {
+    return left_index;
+  }
+
+  if (left_length == 0)
+  {
+    return right_index;
+  }
+
+  parser_list_iterator_t literal_iterator;
+  lexer_literal_t *literal_p;
+  uint32_t literal_index = 0;
+
+  parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
+
+  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+  {
+    if (literal_p->type == LEXER_STRING_LITERAL && literal_p->prop.length == length
+        && memcmp (literal_p->u.char_p, left_p->u.char_p, left_length) == 0
+        && memcmp (literal_p->u.char_p + left_length, right_p->u.char_p, length - left_length) == 0)
+    {
+      return (uint16_t) literal_index;
+    }
+
+    literal_index++;
+  }
+
+  JERRY_ASSERT (literal_index == context_p->literal_count);
+
+  if (literal_index >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
+  {
+    parser_raise_error (context_p, PARSER_ERR_LITERAL_LIMIT_REACHED);
+  }
+
+  literal_p = (lexer_literal_t *) parser_list_append (context_p, &context_p->literal_pool);
+  literal_p->prop.length = (prop_length_t) length;
+  literal_p->type = LEXER_STRING_LITERAL;
+  /* The literal must be valid if the allocation below fails. */
+  literal_p->u.char_p = left_p->u.char_p;
+  literal_p->status_flags = LEXER_FLAG_SOURCE_PTR;
+  context_p->literal_count++;
+
+  uint8_t *char_p = (uint8_t *) parser_malloc (context_p, length);
+  memcpy (char_p, left_p->u.char_p, left_length);
+  memcpy (char_p + left_length, right_p->u.char_p, length - left_length);
+
+  literal_p->u.char_p = char_p;
+  literal_p->status_flags = 0;
+  return (uint16_t) literal_index;
+} /* lexer_construct_concat_string_object */
+
 /**
  * Construct a number object.
  *
@@ -1807,6 +1807,9 @@ parser_parse_tagged_template_literal (parser_context_t *context_p) /**< context
   uint32_t call_arguments = 0;
   ecma_collection_t *collection_p;
 
+  /* The template objects are created by the parser, and each parsing must create new ones. */
+  context_p->global_status_flags &= (uint32_t) ~ECMA_PARSE_INTERNAL_CACHEABLE;
+
   if (context_p->tagged_template_literal_cp == JMEM_CP_NULL)
   {
     collection_p = ecma_new_collection ();
@@ -2990,6 +2993,455 @@ parser_parse_postfix_lvalue (parser_context_t *context_p, /**< context */
   lexer_next_token (context_p);
 } /* parser_parse_postfix_lvalue */
 
+/**
+ * Constant value pushed by a byte code.
+ */
+typedef struct
+{
+  uint16_t opcode; /**< opcode which pushes the value */
+  uint16_t value; /**< literal index or byte argument of the opcode */
+} parser_constant_t;
+
+/**
+ * Checks whether the last pushed value is a constant which is known at parse time.
+ *
+ * @return true - if the value is a constant
+ *         false - otherwise
+ */
+static bool
+parser_get_last_constant (parser_context_t *context_p, /**< context */
+                          parser_constant_t *constant_p) /**< [out] constant value */
+{
+  uint16_t literal_index;
+
+  switch (context_p->last_cbc_opcode)
+  {
+    case CBC_PUSH_TRUE:
+    case CBC_PUSH_FALSE:
+    case CBC_PUSH_NULL:
+    case CBC_PUSH_UNDEFINED:
+    case CBC_PUSH_NUMBER_0:
+    case CBC_PUSH_NUMBER_POS_BYTE:
+    case CBC_PUSH_NUMBER_NEG_BYTE:
+    {
+      constant_p->opcode = context_p->last_cbc_opcode;
+      constant_p->value = context_p->last_cbc.value;
+      return true;
+    }
+    case CBC_PUSH_LITERAL_PUSH_NUMBER_0:
+    case CBC_PUSH_LITERAL_PUSH_NUMBER_POS_BYTE:
+    case CBC_PUSH_LITERAL_PUSH_NUMBER_NEG_BYTE:
+    {
+      constant_p->opcode =
+        (uint16_t) (context_p->last_cbc_opcode - (CBC_PUSH_LITERAL_PUSH_NUMBER_0 - CBC_PUSH_NUMBER_0));
+      constant_p->value = context_p->last_cbc.value;
+      return true;
+    }
+    case CBC_PUSH_LITERAL:
+    case CBC_PUSH_THIS_LITERAL:
+    {
+      literal_index = context_p->last_cbc.literal_index;
+      break;
+    }
+    case CBC_PUSH_TWO_LITERALS:
+    {
+      literal_index = context_p->last_cbc.value;
+      break;
+    }
+    case CBC_PUSH_THREE_LITERALS:
+    {
+      literal_index = context_p->last_cbc.third_literal_index;
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  if (literal_index >= PARSER_REGISTER_START)
+  {
+    return false;
+  }
+
+  lexer_literal_t *literal_p = PARSER_GET_LITERAL (literal_index);
+
+  if (literal_p->type != LEXER_STRING_LITERAL
+      && (literal_p->type != LEXER_NUMBER_LITERAL || !ecma_is_value_number (literal_p->u.value)))
+  {
+    return false;
+  }
+
+  constant_p->opcode = CBC_PUSH_LITERAL;
+  constant_p->value = literal_index;
+  return true;
+} /* parser_get_last_constant */
+
+/**
+ * Removes the constant pushed by the last byte code.
+ */
+static void
+parser_drop_last_constant (parser_context_t *context_p) /**< context */
+{
+  switch (context_p->last_cbc_opcode)
+  {
+    case CBC_PUSH_TWO_LITERALS:
+    case CBC_PUSH_LITERAL_PUSH_NUMBER_0:
+    case CBC_PUSH_LITERAL_PUSH_NUMBER_POS_BYTE:
+    case CBC_PUSH_LITERAL_PUSH_NUMBER_NEG_BYTE:
+    {
+      context_p->last_cbc_opcode = CBC_PUSH_LITERAL;
+      break;
+    }
+    case CBC_PUSH_THREE_LITERALS:
+    {
+      context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
+      break;
+    }
+    case CBC_PUSH_THIS_LITERAL:
+    {
+      context_p->last_cbc_opcode = CBC_PUSH_THIS;
+      break;
+    }
+    default:
+    {
+      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+      break;
+    }
+  }
+} /* parser_drop_last_constant */
+
+/**
+ * Pushes a constant value.
+ */
+static void
+parser_emit_constant (parser_context_t *context_p, /**< context */
+                      const parser_constant_t *constant_p) /**< constant value */
+{
+  if (constant_p->opcode == CBC_PUSH_LITERAL)
+  {
+    if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
+    {
+      context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
+      context_p->last_cbc.value = constant_p->value;
+    }
+    else if (context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS)
+    {
+      context_p->last_cbc_opcode = CBC_PUSH_THREE_LITERALS;
+      context_p->last_cbc.third_literal_index = constant_p->value;
+    }
+    else
+    {
+      parser_emit_cbc_literal (context_p, CBC_PUSH_LITERAL, constant_p->value);
+    }
+
+    context_p->last_cbc.literal_type = PARSER_GET_LITERAL (constant_p->value)->type;
+    context_p->last_cbc.literal_keyword_type = LEXER_EOS;
+    return;
+  }
+
+  if (!PARSER_IS_PUSH_NUMBER (constant_p->opcode))
+  {
+    parser_emit_cbc (context_p, constant_p->opcode);
+    return;
+  }
+
+  if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
+  {
+    context_p->last_cbc_opcode =
+      (uint16_t) (constant_p->opcode + (CBC_PUSH_LITERAL_PUSH_NUMBER_0 - CBC_PUSH_NUMBER_0));
+  }
+  else
+  {
+    if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
+    {
+      parser_flush_cbc (context_p);
+    }
+
+    context_p->last_cbc_opcode = constant_p->opcode;
+  }
+
+  context_p->last_cbc.value = constant_p->value;
+} /* parser_emit_constant */
+
+/**
+ * Converts a constant value to boolean.
+ *
+ * @return boolean value of the constant
+ */
+static bool
+parser_constant_to_boolean (parser_context_t *context_p, /**< context */
+                            const parser_constant_t *constant_p) /**< constant value */
+{
+  switch (constant_p->opcode)
+  {
+    case CBC_PUSH_TRUE:
+    case CBC_PUSH_NUMBER_POS_BYTE:
+    case CBC_PUSH_NUMBER_NEG_BYTE:
+    {
+      return true;
+    }
+    case CBC_PUSH_LITERAL:
+    {
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  lexer_literal_t *literal_p = PARSER_GET_LITERAL (constant_p->value);
+
+  if (literal_p->type == LEXER_STRING_LITERAL)
+  {
+    return literal_p->prop.length != 0;
+  }
+
+  ecma_number_t num = ecma_get_number_from_value (literal_p->u.value);
+  return !ecma_number_is_nan (num) && !ecma_number_is_zero (num);
+} /* parser_constant_to_boolean */
+
+/**
+ * Gets the type of a constant value.
+ *
+ * @return magic string id of the result of the typeof operator
+ */
+static lit_magic_string_id_t
+parser_constant_typeof (parser_context_t *context_p, /**< context */
+                        const parser_constant_t *constant_p) /**< constant value */
+{
+  switch (constant_p->opcode)
+  {
+    case CBC_PUSH_TRUE:
+    case CBC_PUSH_FALSE:
+    {
+      return LIT_MAGIC_STRING_BOOLEAN;
+    }
+    case CBC_PUSH_NULL:
+    {
+      return LIT_MAGIC_STRING_OBJECT;
+    }
+    case CBC_PUSH_UNDEFINED:
+    {
+      return LIT_MAGIC_STRING_UNDEFINED;
+    }
+    case CBC_PUSH_LITERAL:
+    {
+      if (PARSER_GET_LITERAL (constant_p->value)->type == LEXER_STRING_LITERAL)
+      {
+        return LIT_MAGIC_STRING_STRING;
+      }
+      return LIT_MAGIC_STRING_NUMBER;
+    }
+    default:
+    {
+      JERRY_ASSERT (PARSER_IS_PUSH_NUMBER (constant_p->opcode));
+      return LIT_MAGIC_STRING_NUMBER;
+    }
+  }
+} /* parser_constant_typeof */
+
+/**
+ * Removes the value pushed by the last byte code if it is a
+ * constant whose boolean value is known at parse time.
+ *
+ * @return value of the condition
+ */
+parser_condition_t
+parser_pop_constant_condition (parser_context_t *context_p) /**< context */
+{
+  parser_constant_t constant;
+
+  if (!parser_get_last_constant (context_p, &constant))
+  {
+    return PARSER_CONDITION_UNKNOWN;
+  }
+
+  parser_drop_last_constant (context_p);
+  return parser_constant_to_boolean (context_p, &constant) ? PARSER_CONDITION_TRUE : PARSER_CONDITION_FALSE;
+} /* parser_pop_constant_condition */
+
+/**
+ * Replaces a constant operand of a prefix unary operator with the result of the operation.
+ *
+ * @return true - if the operation is evaluated
+ *         false - otherwise
+ */
+static bool
+parser_fold_unary_constant (parser_context_t *context_p, /**< context */
+                            uint16_t opcode) /**< opcode of the operator */
+{
+  parser_constant_t constant;
+
+  if ((opcode != CBC_LOGICAL_NOT && opcode != CBC_TYPEOF && opcode != CBC_VOID)
+      || !parser_get_last_constant (context_p, &constant))
+  {
+    return false;
+  }
+
+  parser_drop_last_constant (context_p);
+
+  if (opcode == CBC_LOGICAL_NOT)
+  {
+    parser_emit_cbc (context_p, parser_constant_to_boolean (context_p, &constant) ? CBC_PUSH_FALSE : CBC_PUSH_TRUE);
+    return true;
+  }
+
+  if (opcode == CBC_VOID)
+  {
+    parser_emit_cbc (context_p, CBC_PUSH_UNDEFINED);
+    return true;
+  }
+
+  lit_magic_string_id_t type_id = parser_constant_typeof (context_p, &constant);
+  lexer_lit_location_t lit_location;
+
+  lit_location.char_p = lit_get_magic_string_utf8 (type_id);
+  lit_location.length = (prop_length_t) lit_get_magic_string_size (type_id);
+  lit_location.type = LEXER_STRING_LITERAL;
+  lit_location.status_flags = LEXER_LIT_LOCATION_IS_ASCII;
+
+  lexer_construct_literal_object (context_p, &lit_location, LEXER_STRING_LITERAL);
+
+  constant.opcode = CBC_PUSH_LITERAL;
+  constant.value = context_p->lit_object.index;
+  parser_emit_constant (context_p, &constant);
+  return true;
+} /* parser_fold_unary_constant */
+
+/**
+ * Replaces two constant operands of a binary operator with the result of the operation.
+ *
+ * Note: only string concatenation and comparisons are evaluated
+ *
+ * @return true - if the operation is evaluated
+ *         false - otherwise
+ */
+static bool
+parser_fold_binary_constants (parser_context_t *context_p, /**< context */
+                              uint8_t token) /**< token of the operator */
+{
+  uint16_t left_index;
+  uint16_t right_index;
+
+  if (context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS)
+  {
+    left_index = context_p->last_cbc.literal_index;
+    right_index = context_p->last_cbc.value;
+  }
+  else
+  {
+    JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_THREE_LITERALS);
+    left_index = context_p->last_cbc.value;
+    right_index = context_p->last_cbc.third_literal_index;
+  }
+
+  if (left_index >= PARSER_REGISTER_START || right_index >= PARSER_REGISTER_START)
+  {
+    return false;
+  }
+
+  lexer_literal_t *left_p = PARSER_GET_LITERAL (left_index);
+  lexer_literal_t *right_p = PARSER_GET_LITERAL (right_index);
+  int compare;
+
+  if (left_p->type == LEXER_STRING_LITERAL && right_p->type == LEXER_STRING_LITERAL)
+  {
+    size_t left_length = left_p->prop.length;
+    size_t right_length = right_p->prop.length;
+
+    if (token == LEXER_ADD)
+    {
+      if (left_length + right_length > PARSER_MAXIMUM_STRING_LENGTH)
+      {
+        return false;
+      }
+
+      parser_constant_t result;
+      result.opcode = CBC_PUSH_LITERAL;
+      result.value = lexer_construct_concat_string_object (context_p, left_index, right_index);
+
+      parser_drop_last_constant (context_p);
+      parser_drop_last_constant (context_p);
+      parser_emit_constant (context_p, &result);
+      return true;
+    }
+
+    /* CESU-8 byte order is the same as the order of UTF-16 code units. */
+    compare = memcmp (left_p->u.char_p, right_p->u.char_p, JERRY_MIN (left_length, right_length));
+
+    if (compare == 0)
+    {
+      compare = (left_length < right_length) ? -1 : (left_length > right_length);
+    }
+  }
+  else if (left_p->type == LEXER_NUMBER_LITERAL && right_p->type == LEXER_NUMBER_LITERAL
+           && ecma_is_value_number (left_p->u.value) && ecma_is_value_number (right_p->u.value))
+  {
+    ecma_number_t left_num = ecma_get_number_from_value (left_p->u.value);
+    ecma_number_t right_num = ecma_get_number_from_value (right_p->u.value);
+
+    if (ecma_number_is_nan (left_num) || ecma_number_is_nan (right_num))
+    {
+      return false;
+    }
+
+    compare = (left_num < right_num) ? -1 : (left_num > right_num);
+  }
+  else
+  {
+    return false;
+  }
+
+  bool result;
+
+  switch (token)
+  {
+    case LEXER_EQUAL:
+    case LEXER_STRICT_EQUAL:
+    {
+      result = (compare == 0);
+      break;
+    }
+    case LEXER_NOT_EQUAL:
+    case LEXER_STRICT_NOT_EQUAL:
+    {
+      result = (compare != 0);
+      break;
+    }
+    case LEXER_LESS:
+    {
+      result = (compare < 0);
+      break;
+    }
+    case LEXER_GREATER:
+    {
+      result = (compare > 0);
+      break;
+    }
+    case LEXER_LESS_EQUAL:
+    {
+      result = (compare <= 0);
+      break;
+    }
+    case LEXER_GREATER_EQUAL:
+    {
+      result = (compare >= 0);
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  parser_drop_last_constant (context_p);
+  parser_drop_last_constant (context_p);
+  parser_emit_cbc (context_p, result ? CBC_PUSH_TRUE : CBC_PUSH_FALSE);
+  return true;
+} /* parser_fold_binary_constants */
+
 /**
  * Emit bytecode for prefix unary tokes
  */
@@ -3039,6 +3491,11 @@ parser_process_prefix_unary_opcodes (parser_context_t *context_p) /**< context *
     {
       token = (uint8_t) (LEXER_UNARY_OP_TOKEN_TO_OPCODE (token));
 
+      if (parser_fold_unary_constant (context_p, token))
+      {
+        continue;
+      }
+
       if (token == CBC_TYPEOF)
       {
         if (PARSER_IS_PUSH_LITERALS_WITH_THIS (context_p->last_cbc_opcode)
@@ -3360,7 +3817,46 @@ parser_append_logical_token (parser_context_t *context_p, /**< context */
   }
 
   parser_branch_t branch;
-  parser_emit_cbc_forward_branch (context_p, opcode, &branch);
+
+  if (context_p->token.type == LEXER_LOGICAL_OR || context_p->token.type == LEXER_LOGICAL_AND)
+  {
+    parser_constant_t constant;
+    parser_dead_code_t dead_code;
+
+    dead_code.byte_code_size = PARSER_DEAD_CODE_NONE;
+
+    if (!parser_get_last_constant (context_p, &constant))
+    {
+      parser_emit_cbc_forward_branch (context_p, opcode, &branch);
+    }
+    else if (parser_constant_to_boolean (context_p, &constant) == (context_p->token.type == LEXER_LOGICAL_AND))
+    {
+      /* The result is the right operand. */
+      parser_drop_last_constant (context_p);
+      branch.page_p = NULL;
+    }
+    else
+    {
+      /* The right operand is never evaluated, and it is removed after it is parsed. */
+      parser_drop_last_constant (context_p);
+      parser_dead_code_start (context_p, &dead_code);
+      parser_emit_constant (context_p, &constant);
+      parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &branch);
+
+      /* The jump does not pop the left operand, but the stack
+       * is adjusted as if it were popped by a conditional branch. */
+      JERRY_ASSERT (context_p->stack_depth > 0);
+      context_p->stack_depth--;
+    }
+
+    parser_stack_push (context_p, &constant, sizeof (parser_constant_t));
+    parser_stack_push (context_p, &dead_code, sizeof (parser_dead_code_t));
+  }
+  else
+  {
+    parser_emit_cbc_forward_branch (context_p, opcode, &branch);
+  }
+
   parser_stack_push (context_p, &branch, sizeof (parser_branch_t));
   parser_stack_push_uint8 (context_p, (uint8_t) context_p->token.type);
 } /* parser_append_logical_token */
@@ -3559,11 +4055,31 @@ parser_process_binary_assignment_token (parser_context_t *context_p, /**< contex
  * Emit opcode for logical tokens.
  */
 static void
-parser_process_logical_token (parser_context_t *context_p) /**< context */
+parser_process_logical_token (parser_context_t *context_p, /**< context */
+                              uint8_t token) /**< token */
 {
   parser_branch_t branch;
   parser_stack_pop (context_p, &branch, sizeof (parser_branch_t));
-  parser_set_branch_to_current_position (context_p, &branch);
+
+  if (token == LEXER_LOGICAL_OR || token == LEXER_LOGICAL_AND)
+  {
+    parser_constant_t constant;
+    parser_dead_code_t dead_code;
+
+    parser_stack_pop (context_p, &dead_code, sizeof (parser_dead_code_t));
+    parser_stack_pop (context_p, &constant, sizeof (parser_constant_t));
+
+    if (parser_dead_code_remove (context_p, &dead_code))
+    {
+      parser_emit_constant (context_p, &constant);
+      return;
+    }
+  }
+
+  if (branch.page_p != NULL)
+  {
+    parser_set_branch_to_current_position (context_p, &branch);
+  }
 } /* parser_process_logical_token */
 
 /**
@@ -3606,6 +4122,12 @@ parser_process_binary_token (parser_context_t *context_p, /**< context */
     lexer_convert_push_number_to_push_literal (context_p);
   }
 
+  if ((context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS || context_p->last_cbc_opcode == CBC_PUSH_THREE_LITERALS)
+      && parser_fold_binary_constants (context_p, token))
+  {
+    return;
+  }
+
   if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
   {
     JERRY_ASSERT (CBC_SAME_ARGS (context_p->last_cbc_opcode, opcode + CBC_BINARY_WITH_LITERAL));
@@ -3696,7 +4218,7 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
       case LEXER_LOGICAL_OR:
       case LEXER_LOGICAL_AND:
       {
-        parser_process_logical_token (context_p);
+        parser_process_logical_token (context_p, token);
         continue;
       }
       case LEXER_KEYW_IN:
@@ -4335,6 +4857,7 @@ parser_process_ternary_expression (parser_context_t *context_p) /**< context */
   cbc_opcode_t opcode = CBC_BRANCH_IF_FALSE_FORWARD;
   parser_branch_t cond_branch;
   parser_branch_t uncond_branch;
+  parser_dead_code_t dead_code;
 
   parser_push_result (context_p);
 
@@ -4344,18 +4867,45 @@ parser_process_ternary_expression (parser_context_t *context_p) /**< context */
     opcode = CBC_BRANCH_IF_TRUE_FORWARD;
   }
 
-  parser_emit_cbc_forward_branch (context_p, (uint16_t) opcode, &cond_branch);
+  parser_condition_t condition = parser_pop_constant_condition (context_p);
+  dead_code.byte_code_size = PARSER_DEAD_CODE_NONE;
+
+  if (condition == PARSER_CONDITION_FALSE)
+  {
+    parser_dead_code_start (context_p, &dead_code);
+    opcode = CBC_JUMP_FORWARD;
+  }
+
+  if (condition != PARSER_CONDITION_TRUE)
+  {
+    parser_emit_cbc_forward_branch (context_p, (uint16_t) opcode, &cond_branch);
+  }
 
   lexer_next_token (context_p);
   parser_parse_expression (context_p, PARSE_EXPR_NO_COMMA);
-  parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &uncond_branch);
-  parser_set_branch_to_current_position (context_p, &cond_branch);
 
-  /* Although byte code is constructed for two branches,
-   * only one of them will be executed. To reflect this
-   * the stack is manually adjusted. */
-  JERRY_ASSERT (context_p->stack_depth > 0);
-  context_p->stack_depth--;
+  uncond_branch.page_p = NULL;
+
+  if (!parser_dead_code_remove (context_p, &dead_code))
+  {
+    if (condition == PARSER_CONDITION_TRUE)
+    {
+      parser_dead_code_start (context_p, &dead_code);
+    }
+
+    parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &uncond_branch);
+
+    if (condition != PARSER_CONDITION_TRUE)
+    {
+      parser_set_branch_to_current_position (context_p, &cond_branch);
+    }
+
+    /* Although byte code is constructed for two branches,
+     * only one of them will be executed. To reflect this
+     * the stack is manually adjusted. */
+    JERRY_ASSERT (context_p->stack_depth > 0);
+    context_p->stack_depth--;
+  }
 
   if (context_p->token.type != LEXER_COLON)
   {
@@ -4365,7 +4915,11 @@ parser_process_ternary_expression (parser_context_t *context_p) /**< context */
   lexer_next_token (context_p);
 
   parser_parse_expression (context_p, PARSE_EXPR_NO_COMMA);
-  parser_set_branch_to_current_position (context_p, &uncond_branch);
+
+  if (!parser_dead_code_remove (context_p, &dead_code) && uncond_branch.page_p != NULL)
+  {
+    parser_set_branch_to_current_position (context_p, &uncond_branch);
+  }
 
   /* Last opcode rewrite is not allowed because
    * the result may come from the first branch. */
@@ -130,6 +130,16 @@ typedef enum
   PARSER_CHECK_FUNCTION_CONTEXT, /**< check function context */
 } parser_check_context_type_t;
 
+/**
+ * Value of a condition which is known at parse time.
+ */
+typedef enum
+{
+  PARSER_CONDITION_UNKNOWN, /**< the value of the condition is only known at runtime */
+  PARSER_CONDITION_FALSE, /**< the condition is always false */
+  PARSER_CONDITION_TRUE, /**< the condition is always true */
+} parser_condition_t;
+
 /**
  * Class field bits.
  */
@@ -223,6 +233,15 @@ typedef enum
 /* Defines the size of the max page. */
 #define PARSER_STACK_PAGE_SIZE ((uint32_t) (((sizeof (void *) > 4) ? 128 : 64) - sizeof (void *)))
 
+/* Size of the pages allocated by the parser arena (including the page header). */
+#define PARSER_ARENA_PAGE_SIZE 1024
+
+/* Larger blocks are allocated on the heap. Must be a multiple of JMEM_ALIGNMENT. */
+#define PARSER_ARENA_MAX_BLOCK_SIZE 128
+
+/* Maximum number of arena pages kept for later parsers. */
+#define PARSER_ARENA_CACHE_PAGE_COUNT 2
+
 /* Avoid compiler warnings for += operations. */
 #define PARSER_PLUS_EQUAL_U16(base, value)  (base) = (uint16_t) ((base) + (value))
 #define PARSER_MINUS_EQUAL_U16(base, value) (base) = (uint16_t) ((base) - (value))
@@ -299,6 +318,43 @@ typedef struct parser_mem_page_t
   uint8_t bytes[]; /**< memory bytes, C99 flexible array member */
 } parser_mem_page_t;
 
+/**
+ * Free block of the parser arena.
+ */
+typedef struct parser_arena_block_t
+{
+  struct parser_arena_block_t *next_p; /**< next free block of the same size */
+} parser_arena_block_t;
+
+/**
+ * Page of the parser arena.
+ */
+typedef struct parser_arena_page_t
+{
+  struct parser_arena_page_t *next_p; /**< next page */
+  size_t size; /**< size of the page (including the page header) */
+} parser_arena_page_t;
+
+/**
+ * Arena for the short lived allocations of a parser instance.
+ *
+ * Blocks are carved from pages allocated on the heap and released blocks are
+ * reused by later allocations of the same or a smaller size. Smaller pages are
+ * allocated when the heap has no room for a full page. All pages are returned
+ * at once when the parsing is completed.
+ */
+typedef struct parser_arena_t
+{
+  struct parser_arena_t *prev_arena_p; /**< arena of the enclosing parser */
+  parser_arena_page_t *pages_p; /**< pages owned by the arena */
+  uint8_t *free_start_p; /**< start of the unused space of the current page */
+  uint8_t *free_end_p; /**< end of the unused space of the current page */
+  parser_arena_block_t *free_blocks_p[PARSER_ARENA_MAX_BLOCK_SIZE / JMEM_ALIGNMENT]; /**< released blocks by size */
+#ifndef JERRY_NDEBUG
+  size_t allocated_size; /**< total size of the blocks in use */
+#endif /* !JERRY_NDEBUG */
+} parser_arena_t;
+
 /**
  * Structure for managing parser memory.
  */
@@ -366,6 +422,24 @@ typedef struct parser_branch_node_t
   parser_branch_t branch; /**< branch */
 } parser_branch_node_t;
 
+/**
+ * Byte code position where a removable unreachable code region starts.
+ */
+typedef struct
+{
+  parser_mem_page_t *page_p; /**< last page of the byte code stream */
+  uint32_t last_position; /**< position of the last byte on the page */
+  uint32_t byte_code_size; /**< byte code size or PARSER_DEAD_CODE_NONE */
+  uint32_t jump_count; /**< value of the jump counter of the parser context */
+  uint16_t stack_depth; /**< stack depth */
+  uint16_t no_end_label; /**< PARSER_NO_END_LABEL status bit */
+} parser_dead_code_t;
+
+/**
+ * Byte code size value of a parser_dead_code_t which does not start a region.
+ */
+#define PARSER_DEAD_CODE_NONE UINT32_MAX
+
 /**
  * Items of scope stack.
  */
@@ -502,6 +576,9 @@ typedef struct parser_saved_context_t
   uint16_t scope_stack_reg_top; /**< preserved top register of scope stack */
   uint16_t scope_stack_global_end; /**< end of global declarations of a function */
   ecma_value_t tagged_template_literal_cp; /**< compessed pointer to the tagged template literal collection */
+  uint32_t jump_count; /**< number of break and continue statements */
+  parser_dead_code_t dead_statements; /**< unreachable statements of a statement list */
+  parser_stack_iterator_t dead_statements_list; /**< statement list of the unreachable statements */
 #ifndef JERRY_NDEBUG
   uint16_t context_stack_depth; /**< current context stack depth */
 #endif /* !JERRY_NDEBUG */
@@ -590,6 +667,9 @@ typedef struct
   uint16_t scope_stack_global_end; /**< end of global declarations of a function */
   ecma_value_t tagged_template_literal_cp; /**< compessed pointer to the tagged template literal collection */
   parser_private_context_t *private_context_p; /**< private context */
+  uint32_t jump_count; /**< number of break and continue statements */
+  parser_dead_code_t dead_statements; /**< unreachable statements after a return, throw, break or continue */
+  parser_stack_iterator_t dead_statements_list; /**< statement list which contains the unreachable statements */
   uint8_t stack_top_uint8; /**< top byte stored on the stack */
 
 #ifndef JERRY_NDEBUG
@@ -638,11 +718,20 @@ void *parser_malloc_local (parser_context_t *context_p, size_t size);
 void parser_free_local (void *ptr, size_t size);
 void parser_free_allocated_buffer (parser_context_t *context_p);
 
+/* Parser arena. Blocks must be freed with the size they were allocated with. */
+
+void parser_arena_init (parser_arena_t *arena_p);
+void parser_arena_release (parser_arena_t *arena_p);
+void *parser_arena_alloc_null_on_error (size_t size);
+void *parser_arena_alloc (parser_context_t *context_p, size_t size);
+void parser_arena_free (void *ptr, size_t size);
+
 /* Parser byte stream. */
 
 void parser_cbc_stream_init (parser_mem_data_t *data_p);
 void parser_cbc_stream_free (parser_mem_data_t *data_p);
 void parser_cbc_stream_alloc_page (parser_context_t *context_p, parser_mem_data_t *data_p);
+void parser_cbc_stream_truncate (parser_mem_data_t *data_p, parser_mem_page_t *last_p, uint32_t last_position);
 
 /* Parser list. Ensures pointer alignment. */
 
@@ -707,6 +796,11 @@ void parser_set_breaks_to_current_position (parser_context_t *context_p, parser_
 void parser_set_continues_to_current_position (parser_context_t *context_p, parser_branch_node_t *current_p);
 void parser_reverse_class_fields (parser_context_t *context_p, size_t fields_size);
 
+/* Unreachable code removal. */
+
+void parser_dead_code_start (parser_context_t *context_p, parser_dead_code_t *dead_code_p);
+bool parser_dead_code_remove (parser_context_t *context_p, parser_dead_code_t *dead_code_p);
+
 /* Convenience macros. */
 #define parser_emit_cbc_ext(context_p, opcode) parser_emit_cbc ((context_p), PARSER_TO_EXT_OPCODE (opcode))
 #define parser_emit_cbc_ext_literal(context_p, opcode, literal_index) \
@@ -760,6 +854,7 @@ lexer_literal_t *lexer_construct_unused_literal (parser_context_t *context_p);
 void lexer_construct_literal_object (parser_context_t *context_p,
                                      const lexer_lit_location_t *lit_location_p,
                                      uint8_t literal_type);
+uint16_t lexer_construct_concat_string_object (parser_context_t *context_p, uint16_t left_index, uint16_t right_index);
 bool lexer_construct_number_object (parser_context_t *context_p, bool is_expr, bool is_negative_number);
 void lexer_convert_push_number_to_push_literal (parser_context_t *context_p);
 uint16_t lexer_construct_function_object (parser_context_t *context_p, uint32_t extra_status_flags);
@@ -791,6 +886,7 @@ uint8_t lexer_convert_binary_lvalue_token_to_binary (uint8_t token);
 void parser_parse_block_expression (parser_context_t *context_p, int options);
 void parser_parse_expression_statement (parser_context_t *context_p, int options);
 void parser_parse_expression (parser_context_t *context_p, int options);
+parser_condition_t parser_pop_constant_condition (parser_context_t *context_p);
 void parser_resolve_private_identifier (parser_context_t *context_p);
 void parser_save_private_context (parser_context_t *context_p,
                                   parser_private_context_t *private_ctx_p,
@@ -815,6 +911,9 @@ void scanner_release_private_fields (scanner_class_private_member_t *member_p);
 void scanner_seek (parser_context_t *context_p);
 void scanner_reverse_info_list (parser_context_t *context_p);
 void scanner_cleanup (parser_context_t *context_p);
+bool scanner_cache_get_key (parser_context_t *context_p, scanner_cache_key_t *key_p);
+bool scanner_cache_load (parser_context_t *context_p, const scanner_cache_key_t *key_p);
+uint8_t *scanner_cache_save (parser_context_t *context_p, const scanner_cache_key_t *key_p, size_t *size_p);
 
 bool scanner_is_context_needed (parser_context_t *context_p, parser_check_context_type_t check_type);
 bool scanner_try_scan_new_target (parser_context_t *context_p);
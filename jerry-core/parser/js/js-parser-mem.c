@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "jcontext.h"
 #include "js-parser-internal.h"
 
 #if JERRY_PARSER
@@ -102,6 +103,246 @@ parser_free_allocated_buffer (parser_context_t *context_p) /**< context */
   }
 } /* parser_free_allocated_buffer */
 
+/**********************************************************************/
+/* Parser arena                                                       */
+/**********************************************************************/
+
+/**
+ * Offset of the first block on an arena page.
+ */
+#define PARSER_ARENA_PAGE_HEADER_SIZE JERRY_ALIGNUP (sizeof (parser_arena_page_t), JMEM_ALIGNMENT)
+
+/**
+ * Get the free list of a block size.
+ */
+#define PARSER_ARENA_GET_FREE_BLOCKS(arena_p, block_size) \
+  ((arena_p)->free_blocks_p + ((block_size) / JMEM_ALIGNMENT) - 1)
+
+/**
+ * Make an arena the active arena. The previously active arena
+ * is restored when the arena is released.
+ */
+void
+parser_arena_init (parser_arena_t *arena_p) /**< arena */
+{
+  memset (arena_p, 0, sizeof (parser_arena_t));
+  arena_p->prev_arena_p = JERRY_CONTEXT (parser_arena_p);
+  JERRY_CONTEXT (parser_arena_p) = arena_p;
+} /* parser_arena_init */
+
+/**
+ * Release all pages of the active arena. Some of the pages
+ * are kept in the context for the arenas created later.
+ */
+void
+parser_arena_release (parser_arena_t *arena_p) /**< arena */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (parser_arena_p) == arena_p);
+#ifndef JERRY_NDEBUG
+  JERRY_ASSERT (arena_p->allocated_size == 0);
+#endif /* !JERRY_NDEBUG */
+
+  uint32_t cached_page_count = 0;
+
+  for (parser_arena_page_t *page_p = JERRY_CONTEXT (parser_arena_cache_p); page_p != NULL; page_p = page_p->next_p)
+  {
+    cached_page_count++;
+  }
+
+  parser_arena_page_t *page_p = arena_p->pages_p;
+
+  while (page_p != NULL)
+  {
+    parser_arena_page_t *next_p = page_p->next_p;
+
+    if (page_p->size == PARSER_ARENA_PAGE_SIZE && cached_page_count < PARSER_ARENA_CACHE_PAGE_COUNT)
+    {
+      page_p->next_p = JERRY_CONTEXT (parser_arena_cache_p);
+      JERRY_CONTEXT (parser_arena_cache_p) = page_p;
+      cached_page_count++;
+    }
+    else
+    {
+      jmem_heap_free_block (page_p, page_p->size);
+    }
+
+    page_p = next_p;
+  }
+
+  JERRY_CONTEXT (parser_arena_p) = arena_p->prev_arena_p;
+} /* parser_arena_release */
+
+/**
+ * Free the arena pages kept in the context.
+ */
+void
+parser_arena_free_cache (void)
+{
+  parser_arena_page_t *page_p = JERRY_CONTEXT (parser_arena_cache_p);
+
+  while (page_p != NULL)
+  {
+    parser_arena_page_t *next_p = page_p->next_p;
+
+    jmem_heap_free_block (page_p, PARSER_ARENA_PAGE_SIZE);
+    page_p = next_p;
+  }
+
+  JERRY_CONTEXT (parser_arena_cache_p) = NULL;
+} /* parser_arena_free_cache */
+
+/**
+ * Append a new page to the active arena.
+ *
+ * @return true - if the page is allocated, false - otherwise
+ */
+static bool
+parser_arena_add_page (parser_arena_t *arena_p, /**< arena */
+                       size_t block_size) /**< size of the block allocated from the page */
+{
+  parser_arena_page_t *page_p = JERRY_CONTEXT (parser_arena_cache_p);
+  size_t page_size = PARSER_ARENA_PAGE_SIZE;
+
+  if (page_p != NULL)
+  {
+    JERRY_CONTEXT (parser_arena_cache_p) = page_p->next_p;
+  }
+  else
+  {
+    const size_t min_page_size = PARSER_ARENA_PAGE_HEADER_SIZE + block_size;
+
+    /* A full page needs more contiguous memory than the block itself, so
+     * smaller pages are tried before the parsing fails on a tight heap. */
+    while ((page_p = (parser_arena_page_t *) jmem_heap_alloc_block_null_on_error (page_size)) == NULL)
+    {
+      if (page_size == min_page_size)
+      {
+        return false;
+      }
+
+      page_size = JERRY_MAX (page_size / 2, min_page_size);
+    }
+
+    page_p->size = page_size;
+  }
+
+  size_t remaining_size = (size_t) (arena_p->free_end_p - arena_p->free_start_p);
+
+  /* The unused end of the current page is still available for smaller blocks. */
+  if (remaining_size > 0)
+  {
+    parser_arena_block_t **free_blocks_p = PARSER_ARENA_GET_FREE_BLOCKS (arena_p, remaining_size);
+    parser_arena_block_t *block_p = (parser_arena_block_t *) arena_p->free_start_p;
+
+    block_p->next_p = *free_blocks_p;
+    *free_blocks_p = block_p;
+  }
+
+  page_p->next_p = arena_p->pages_p;
+  arena_p->pages_p = page_p;
+  arena_p->free_start_p = ((uint8_t *) page_p) + PARSER_ARENA_PAGE_HEADER_SIZE;
+  arena_p->free_end_p = ((uint8_t *) page_p) + page_size;
+  return true;
+} /* parser_arena_add_page */
+
+/**
+ * Allocate memory from the active arena.
+ *
+ * @return allocated memory, or NULL if there is not enough memory
+ */
+void *
+parser_arena_alloc_null_on_error (size_t size) /**< size of the memory block */
+{
+  parser_arena_t *arena_p = JERRY_CONTEXT (parser_arena_p);
+
+  JERRY_ASSERT (arena_p != NULL && size > 0);
+
+  if (size > PARSER_ARENA_MAX_BLOCK_SIZE)
+  {
+    return jmem_heap_alloc_block_null_on_error (size);
+  }
+
+  size_t block_size = JERRY_ALIGNUP (size, JMEM_ALIGNMENT);
+  parser_arena_block_t **free_blocks_p = PARSER_ARENA_GET_FREE_BLOCKS (arena_p, block_size);
+  parser_arena_block_t *block_p = *free_blocks_p;
+
+  if (block_p != NULL)
+  {
+    *free_blocks_p = block_p->next_p;
+  }
+  else
+  {
+    if ((size_t) (arena_p->free_end_p - arena_p->free_start_p) < block_size
+        && !parser_arena_add_page (arena_p, block_size))
+    {
+      return NULL;
+    }
+
+    block_p = (parser_arena_block_t *) arena_p->free_start_p;
+    arena_p->free_start_p += block_size;
+  }
+
+#ifndef JERRY_NDEBUG
+  arena_p->allocated_size += block_size;
+#endif /* !JERRY_NDEBUG */
+  return block_p;
+} /* parser_arena_alloc_null_on_error */
+
+/**
+ * Allocate memory from the active arena.
+ *
+ * @return allocated memory.
+ */
+void *
+parser_arena_alloc (parser_context_t *context_p, /**< context */
+                    size_t size) /**< size of the memory block */
+{
+  void *result = parser_arena_alloc_null_on_error (size);
+
+  if (result == NULL)
+  {
+    parser_raise_error (context_p, PARSER_ERR_OUT_OF_MEMORY);
+  }
+  return result;
+} /* parser_arena_alloc */
+
+/**
+ * Free memory allocated from the active arena.
+ */
+void
+parser_arena_free (void *ptr, /**< pointer to free */
+                   size_t size) /**< size of the memory block */
+{
+  if (size > PARSER_ARENA_MAX_BLOCK_SIZE)
+  {
+    jmem_heap_free_block (ptr, size);
+    return;
+  }
+
+  parser_arena_t *arena_p = JERRY_CONTEXT (parser_arena_p);
+  size_t block_size = JERRY_ALIGNUP (size, JMEM_ALIGNMENT);
+
+  JERRY_ASSERT (arena_p != NULL);
+
+#ifndef JERRY_NDEBUG
+  JERRY_ASSERT (arena_p->allocated_size >= block_size);
+  arena_p->allocated_size -= block_size;
+#endif /* !JERRY_NDEBUG */
+
+  /* The most recently allocated block is given back to the current page. */
+  if ((uint8_t *) ptr + block_size == arena_p->free_start_p)
+  {
+    arena_p->free_start_p = (uint8_t *) ptr;
+    return;
+  }
+
+  parser_arena_block_t **free_blocks_p = PARSER_ARENA_GET_FREE_BLOCKS (arena_p, block_size);
+  parser_arena_block_t *block_p = (parser_arena_block_t *) ptr;
+
+  block_p->next_p = *free_blocks_p;
+  *free_blocks_p = block_p;
+} /* parser_arena_free */
+
 /**********************************************************************/
 /* Parser data management functions                                   */
 /**********************************************************************/
@@ -131,7 +372,7 @@ parser_data_free (parser_mem_data_t *data_p, /**< memory manager */
   {
     parser_mem_page_t *next_p = page_p->next_p;
 
-    parser_free (page_p, page_size);
+    parser_arena_free (page_p, page_size);
     page_p = next_p;
   }
 } /* parser_data_free */
@@ -166,7 +407,7 @@ parser_cbc_stream_alloc_page (parser_context_t *context_p, /**< context */
                               parser_mem_data_t *data_p) /**< memory manager */
 {
   size_t size = sizeof (parser_mem_page_t *) + PARSER_CBC_STREAM_PAGE_SIZE;
-  parser_mem_page_t *page_p = (parser_mem_page_t *) parser_malloc (context_p, size);
+  parser_mem_page_t *page_p = (parser_mem_page_t *) parser_arena_alloc (context_p, size);
 
   page_p->next_p = NULL;
   data_p->last_position = 0;
@@ -182,6 +423,39 @@ parser_cbc_stream_alloc_page (parser_context_t *context_p, /**< context */
   data_p->last_p = page_p;
 } /* parser_cbc_stream_alloc_page */
 
+/**
+ * Removes the bytes appended after a previous end position of the byte stream.
+ */
+void
+parser_cbc_stream_truncate (parser_mem_data_t *data_p, /**< memory manager */
+                            parser_mem_page_t *last_p, /**< last page at the previous end position */
+                            uint32_t last_position) /**< last position at the previous end position */
+{
+  parser_mem_page_t *page_p;
+
+  if (last_p != NULL)
+  {
+    page_p = last_p->next_p;
+    last_p->next_p = NULL;
+  }
+  else
+  {
+    page_p = data_p->first_p;
+    data_p->first_p = NULL;
+  }
+
+  while (page_p != NULL)
+  {
+    parser_mem_page_t *next_p = page_p->next_p;
+
+    parser_arena_free (page_p, sizeof (parser_mem_page_t *) + PARSER_CBC_STREAM_PAGE_SIZE);
+    page_p = next_p;
+  }
+
+  data_p->last_p = last_p;
+  data_p->last_position = last_position;
+} /* parser_cbc_stream_truncate */
+
 /**********************************************************************/
 /* Parser list management functions                                   */
 /**********************************************************************/
@@ -236,7 +510,7 @@ parser_list_append (parser_context_t *context_p, /**< context */
   {
     size_t size = sizeof (parser_mem_page_t *) + list_p->page_size;
 
-    page_p = (parser_mem_page_t *) parser_malloc (context_p, size);
+    page_p = (parser_mem_page_t *) parser_arena_alloc (context_p, size);
 
     page_p->next_p = NULL;
     list_p->data.last_position = 0;
@@ -353,7 +627,7 @@ parser_stack_free (parser_context_t *context_p) /**< context */
 
   if (context_p->free_page_p != NULL)
   {
-    parser_free (context_p->free_page_p, sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE);
+    parser_arena_free (context_p->free_page_p, sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE);
   }
 } /* parser_stack_free */
 
@@ -381,7 +655,7 @@ parser_stack_push_uint8 (parser_context_t *context_p, /**< context */
     else
     {
       size_t size = sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE;
-      page_p = (parser_mem_page_t *) parser_malloc (context_p, size);
+      page_p = (parser_mem_page_t *) parser_arena_alloc (context_p, size);
     }
 
     page_p->next_p = context_p->stack.first_p;
@@ -416,7 +690,7 @@ parser_stack_pop_uint8 (parser_context_t *context_p) /**< context */
     }
     else
     {
-      parser_free (page_p, sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE);
+      parser_arena_free (page_p, sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE);
     }
 
     page_p = context_p->stack.first_p;
@@ -560,7 +834,7 @@ parser_stack_push (parser_context_t *context_p, /**< context */
   {
     size_t size = sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE;
 
-    page_p = (parser_mem_page_t *) parser_malloc (context_p, size);
+    page_p = (parser_mem_page_t *) parser_arena_alloc (context_p, size);
   }
 
   page_p->next_p = context_p->stack.first_p;
@@ -622,7 +896,7 @@ parser_stack_pop (parser_context_t *context_p, /**< context */
   }
   else
   {
-    parser_free (page_p, sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE);
+    parser_arena_free (page_p, sizeof (parser_mem_page_t *) + PARSER_STACK_PAGE_SIZE);
   }
 } /* parser_stack_pop */
 
@@ -159,7 +159,8 @@ typedef struct
  */
 typedef struct
 {
-  parser_branch_t branch; /**< branch to the end */
+  parser_branch_t branch; /**< branch to the end (page_p is NULL if there is no branch) */
+  parser_dead_code_t dead_code; /**< unreachable code of a constant condition */
 } parser_if_else_statement_t;
 
 /**
@@ -777,7 +778,28 @@ parser_parse_if_statement_start (parser_context_t *context_p) /**< context */
 
   parser_parse_enclosed_expr (context_p);
 
-  parser_emit_cbc_forward_branch (context_p, CBC_BRANCH_IF_FALSE_FORWARD, &if_statement.branch);
+  if_statement.dead_code.byte_code_size = PARSER_DEAD_CODE_NONE;
+
+  switch (parser_pop_constant_condition (context_p))
+  {
+    case PARSER_CONDITION_TRUE:
+    {
+      if_statement.branch.page_p = NULL;
+      break;
+    }
+    case PARSER_CONDITION_FALSE:
+    {
+      /* The jump is removed together with the statement if possible. */
+      parser_dead_code_start (context_p, &if_statement.dead_code);
+      parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &if_statement.branch);
+      break;
+    }
+    default:
+    {
+      parser_emit_cbc_forward_branch (context_p, CBC_BRANCH_IF_FALSE_FORWARD, &if_statement.branch);
+      break;
+    }
+  }
 
   parser_stack_push (context_p, &if_statement, sizeof (parser_if_else_statement_t));
   parser_stack_push_uint8 (context_p, PARSER_STATEMENT_IF);
@@ -805,7 +827,10 @@ parser_parse_if_statement_end (parser_context_t *context_p) /**< context */
     parser_stack_pop (context_p, &if_statement, sizeof (parser_if_else_statement_t));
     parser_stack_iterator_init (context_p, &context_p->last_statement);
 
-    parser_set_branch_to_current_position (context_p, &if_statement.branch);
+    if (!parser_dead_code_remove (context_p, &if_statement.dead_code) && if_statement.branch.page_p != NULL)
+    {
+      parser_set_branch_to_current_position (context_p, &if_statement.branch);
+    }
 
     return false;
   }
@@ -815,9 +840,26 @@ parser_parse_if_statement_end (parser_context_t *context_p) /**< context */
   parser_stack_iterator_skip (&iterator, 1);
   parser_stack_iterator_read (&iterator, &if_statement, sizeof (parser_if_else_statement_t));
 
-  parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &else_statement.branch);
+  else_statement.dead_code.byte_code_size = PARSER_DEAD_CODE_NONE;
+
+  if (parser_dead_code_remove (context_p, &if_statement.dead_code))
+  {
+    else_statement.branch.page_p = NULL;
+  }
+  else
+  {
+    if (if_statement.branch.page_p == NULL)
+    {
+      parser_dead_code_start (context_p, &else_statement.dead_code);
+    }
+
+    parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &else_statement.branch);
 
-  parser_set_branch_to_current_position (context_p, &if_statement.branch);
+    if (if_statement.branch.page_p != NULL)
+    {
+      parser_set_branch_to_current_position (context_p, &if_statement.branch);
+    }
+  }
 
   parser_stack_iterator_write (&iterator, &else_statement, sizeof (parser_if_else_statement_t));
 
@@ -2053,7 +2095,7 @@ parser_parse_case_statement (parser_context_t *context_p) /**< context */
   parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
 
   parser_set_branch_to_current_position (context_p, &branch_p->branch);
-  parser_free (branch_p, sizeof (parser_branch_node_t));
+  parser_arena_free (branch_p, sizeof (parser_branch_node_t));
 } /* parser_parse_case_statement */
 
 /**
@@ -2065,6 +2107,7 @@ parser_parse_break_statement (parser_context_t *context_p) /**< context */
   parser_stack_iterator_t iterator;
   cbc_opcode_t opcode = CBC_JUMP_FORWARD;
 
+  context_p->jump_count++;
   lexer_next_token (context_p);
   parser_stack_iterator_init (context_p, &iterator);
 
@@ -2147,6 +2190,7 @@ parser_parse_continue_statement (parser_context_t *context_p) /**< context */
   parser_stack_iterator_t iterator;
   cbc_opcode_t opcode = CBC_JUMP_FORWARD;
 
+  context_p->jump_count++;
   lexer_next_token (context_p);
   parser_stack_iterator_init (context_p, &iterator);
 
@@ -2583,6 +2627,68 @@ parser_parse_label (parser_context_t *context_p) /**< context */
   parser_stack_iterator_init (context_p, &context_p->last_statement);
 } /* parser_parse_label */
 
+/**
+ * Checks whether the current token ends the statement list of the current statement.
+ *
+ * @return true - if the statement list is ended
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+parser_is_statement_list_end (parser_context_t *context_p) /**< context */
+{
+  return (context_p->token.type == LEXER_RIGHT_BRACE || context_p->token.type == LEXER_KEYW_CASE
+          || context_p->token.type == LEXER_KEYW_DEFAULT || context_p->token.type == LEXER_EOS);
+} /* parser_is_statement_list_end */
+
+/**
+ * Starts an unreachable code region when a return, throw, break or continue
+ * statement is followed by other statements of the same statement list.
+ *
+ * Note: the blocks of try statements are not supported, because the context
+ *       branch and stack depth of the try statement depend on their byte code.
+ */
+static void
+parser_start_dead_statements (parser_context_t *context_p) /**< context */
+{
+  if (context_p->dead_statements.byte_code_size != PARSER_DEAD_CODE_NONE || parser_is_statement_list_end (context_p))
+  {
+    return;
+  }
+
+  switch (context_p->stack_top_uint8)
+  {
+    case PARSER_STATEMENT_START:
+    case PARSER_STATEMENT_BLOCK:
+    case PARSER_STATEMENT_BLOCK_SCOPE:
+    case PARSER_STATEMENT_BLOCK_CONTEXT:
+    case PARSER_STATEMENT_SWITCH:
+    case PARSER_STATEMENT_SWITCH_NO_DEFAULT:
+    {
+      parser_dead_code_start (context_p, &context_p->dead_statements);
+      context_p->dead_statements_list = context_p->last_statement;
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+} /* parser_start_dead_statements */
+
+/**
+ * Removes the unreachable statements when the end of their statement list is reached.
+ */
+static void
+parser_end_dead_statements (parser_context_t *context_p) /**< context */
+{
+  if (context_p->dead_statements.byte_code_size != PARSER_DEAD_CODE_NONE && parser_is_statement_list_end (context_p)
+      && context_p->last_statement.current_p == context_p->dead_statements_list.current_p
+      && context_p->last_statement.current_position == context_p->dead_statements_list.current_position)
+  {
+    parser_dead_code_remove (context_p, &context_p->dead_statements);
+  }
+} /* parser_end_dead_statements */
+
 /**
  * Strict mode types for statement parsing.
  */
@@ -2707,10 +2813,14 @@ parser_parse_statements (parser_context_t *context_p) /**< context */
 
   while (context_p->token.type != LEXER_EOS || context_p->stack_top_uint8 != PARSER_STATEMENT_START)
   {
+    bool is_jump_statement = false;
+
 #ifndef JERRY_NDEBUG
     JERRY_ASSERT (context_p->stack_depth == context_p->context_stack_depth);
 #endif /* !JERRY_NDEBUG */
 
+    parser_end_dead_statements (context_p);
+
     JERRY_ASSERT (context_p->stack_top_uint8 != PARSER_STATEMENT_PRIVATE_SCOPE
                   && context_p->stack_top_uint8 != PARSER_STATEMENT_PRIVATE_CONTEXT);
 
@@ -2913,12 +3023,14 @@ parser_parse_statements (parser_context_t *context_p) /**< context */
       case LEXER_KEYW_BREAK:
       {
         parser_parse_break_statement (context_p);
+        is_jump_statement = true;
         break;
       }
 
       case LEXER_KEYW_CONTINUE:
       {
         parser_parse_continue_statement (context_p);
+        is_jump_statement = true;
         break;
       }
 
@@ -2931,6 +3043,7 @@ parser_parse_statements (parser_context_t *context_p) /**< context */
         }
         parser_parse_expression (context_p, PARSE_EXPR);
         parser_emit_cbc (context_p, CBC_THROW);
+        is_jump_statement = true;
         break;
       }
 
@@ -2945,6 +3058,7 @@ parser_parse_statements (parser_context_t *context_p) /**< context */
           parser_raise_error (context_p, PARSER_ERR_INVALID_RETURN);
         }
 
+        is_jump_statement = true;
         lexer_next_token (context_p);
 
         if ((context_p->token.flags & LEXER_WAS_NEWLINE) || context_p->token.type == LEXER_SEMICOLON
@@ -3155,13 +3269,21 @@ parser_parse_statements (parser_context_t *context_p) /**< context */
         parser_raise_error (context_p, PARSER_ERR_INVALID_RIGHT_SQUARE);
       }
     }
-    else if (context_p->token.type == LEXER_SEMICOLON)
-    {
-      lexer_next_token (context_p);
-    }
-    else if (context_p->token.type != LEXER_EOS && !(context_p->token.flags & LEXER_WAS_NEWLINE))
+    else
     {
-      parser_raise_error (context_p, PARSER_ERR_SEMICOLON_EXPECTED);
+      if (context_p->token.type == LEXER_SEMICOLON)
+      {
+        lexer_next_token (context_p);
+      }
+      else if (context_p->token.type != LEXER_EOS && !(context_p->token.flags & LEXER_WAS_NEWLINE))
+      {
+        parser_raise_error (context_p, PARSER_ERR_SEMICOLON_EXPECTED);
+      }
+
+      if (is_jump_statement)
+      {
+        parser_start_dead_statements (context_p);
+      }
     }
 
 consume_last_statement:
@@ -3198,7 +3320,10 @@ consume_last_statement:
           parser_stack_pop (context_p, &else_statement, sizeof (parser_if_else_statement_t));
           parser_stack_iterator_init (context_p, &context_p->last_statement);
 
-          parser_set_branch_to_current_position (context_p, &else_statement.branch);
+          if (!parser_dead_code_remove (context_p, &else_statement.dead_code) && else_statement.branch.page_p != NULL)
+          {
+            parser_set_branch_to_current_position (context_p, &else_statement.branch);
+          }
           continue;
         }
 
@@ -3291,6 +3416,7 @@ consume_last_statement:
     }
   }
 
+  parser_end_dead_statements (context_p);
   parser_stack_pop_uint8 (context_p);
   context_p->last_statement.current_p = NULL;
 
@@ -3352,7 +3478,7 @@ parser_free_jumps (parser_stack_iterator_t iterator) /**< iterator position */
         while (branch_list_p != NULL)
         {
           parser_branch_node_t *next_p = branch_list_p->next_p;
-          parser_free (branch_list_p, sizeof (parser_branch_node_t));
+          parser_arena_free (branch_list_p, sizeof (parser_branch_node_t));
           branch_list_p = next_p;
         }
         branch_list_p = loop.branch_list_p;
@@ -3384,7 +3510,7 @@ parser_free_jumps (parser_stack_iterator_t iterator) /**< iterator position */
     while (branch_list_p != NULL)
     {
       parser_branch_node_t *next_p = branch_list_p->next_p;
-      parser_free (branch_list_p, sizeof (parser_branch_node_t));
+      parser_arena_free (branch_list_p, sizeof (parser_branch_node_t));
       branch_list_p = next_p;
     }
   }
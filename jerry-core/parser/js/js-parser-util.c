@@ -19,9 +19,9 @@
 
 #if JERRY_PARSER
 
-#if JERRY_LINE_INFO
+#if JERRY_LINE_INFO || JERRY_DEBUGGER
 #include "jcontext.h"
-#endif /* JERRY_LINE_INFO */
+#endif /* JERRY_LINE_INFO || JERRY_DEBUGGER */
 
 /** \addtogroup parser Parser
  * @{
@@ -540,7 +540,7 @@ parser_emit_cbc_forward_branch_item (parser_context_t *context_p, /**< context *
    * the branch is constructed locally, and copied later. */
   parser_emit_cbc_forward_branch (context_p, opcode, &branch);
 
-  new_item = (parser_branch_node_t *) parser_malloc (context_p, sizeof (parser_branch_node_t));
+  new_item = (parser_branch_node_t *) parser_arena_alloc (context_p, sizeof (parser_branch_node_t));
   new_item->branch = branch;
   new_item->next_p = next_p;
   return new_item;
@@ -730,7 +730,7 @@ parser_set_breaks_to_current_position (parser_context_t *context_p, /**< context
     {
       parser_set_branch_to_current_position (context_p, &current_p->branch);
     }
-    parser_free (current_p, sizeof (parser_branch_node_t));
+    parser_arena_free (current_p, sizeof (parser_branch_node_t));
     current_p = next_p;
   }
 } /* parser_set_breaks_to_current_position */
@@ -752,6 +752,92 @@ parser_set_continues_to_current_position (parser_context_t *context_p, /**< cont
   }
 } /* parser_set_continues_to_current_position */
 
+/**
+ * Marks the current byte code position as the start of an unreachable code region.
+ */
+void
+parser_dead_code_start (parser_context_t *context_p, /**< context */
+                        parser_dead_code_t *dead_code_p) /**< [out] start of the region */
+{
+  if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
+  {
+    parser_flush_cbc (context_p);
+  }
+
+  dead_code_p->page_p = context_p->byte_code.last_p;
+  dead_code_p->last_position = context_p->byte_code.last_position;
+  dead_code_p->byte_code_size = context_p->byte_code_size;
+  dead_code_p->jump_count = context_p->jump_count;
+  dead_code_p->stack_depth = context_p->stack_depth;
+  dead_code_p->no_end_label = (uint16_t) (context_p->status_flags & PARSER_NO_END_LABEL);
+} /* parser_dead_code_start */
+
+/**
+ * Removes the byte code emitted since the start of an unreachable code region.
+ *
+ * The code cannot be removed when a break or continue statement of the region may jump
+ * out of it, or when line info or breakpoints refer to it. The caller must emit the
+ * instructions which skip the region before it is closed, so the code is correct either way.
+ *
+ * @return true - if the code is removed
+ *         false - otherwise
+ */
+bool
+parser_dead_code_remove (parser_context_t *context_p, /**< context */
+                         parser_dead_code_t *dead_code_p) /**< start of the region */
+{
+  if (dead_code_p->byte_code_size == PARSER_DEAD_CODE_NONE)
+  {
+    return false;
+  }
+
+  uint32_t byte_code_size = dead_code_p->byte_code_size;
+
+  /* The region is closed regardless of the result. */
+  dead_code_p->byte_code_size = PARSER_DEAD_CODE_NONE;
+
+  if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
+  {
+    parser_flush_cbc (context_p);
+  }
+
+  if (context_p->jump_count != dead_code_p->jump_count)
+  {
+    return false;
+  }
+
+#if JERRY_LINE_INFO
+  if (context_p->line_info_p != NULL && context_p->line_info_p->byte_code_position > byte_code_size)
+  {
+    return false;
+  }
+#endif /* JERRY_LINE_INFO */
+
+#if JERRY_DEBUGGER
+  if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+  {
+    return false;
+  }
+#endif /* JERRY_DEBUGGER */
+
+  JERRY_ASSERT (context_p->byte_code_size >= byte_code_size);
+
+  parser_cbc_stream_truncate (&context_p->byte_code, dead_code_p->page_p, dead_code_p->last_position);
+  context_p->byte_code_size = byte_code_size;
+  context_p->stack_depth = dead_code_p->stack_depth;
+  context_p->status_flags &= (uint32_t) ~PARSER_NO_END_LABEL;
+  context_p->status_flags |= dead_code_p->no_end_label;
+
+#if JERRY_PARSER_DUMP_BYTE_CODE
+  if (context_p->is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("  Note: unreachable code removed\n");
+  }
+#endif /* JERRY_PARSER_DUMP_BYTE_CODE */
+
+  return true;
+} /* parser_dead_code_remove */
+
 /**
  * Return the size of internal record corresponding to a class field
  *
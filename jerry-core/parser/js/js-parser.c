@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "ecma-eval.h"
 #include "ecma-exceptions.h"
 #include "ecma-extended-info.h"
 #include "ecma-helpers.h"
@@ -940,10 +941,10 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   total_size = JERRY_ALIGNUP (total_size, JMEM_ALIGNMENT);
   compiled_code_p = (ecma_compiled_code_t *) parser_malloc (context_p, total_size);
 
-#if JERRY_SNAPSHOT_SAVE || JERRY_PARSER_DUMP_BYTE_CODE
+#if JERRY_SNAPSHOT_SAVE || JERRY_PARSER_DUMP_BYTE_CODE || JERRY_PARSER_STATS
   // Avoid getting junk bytes
   memset (compiled_code_p, 0, total_size);
-#endif /* JERRY_SNAPSHOT_SAVE || JERRY_PARSER_DUMP_BYTE_CODE */
+#endif /* JERRY_SNAPSHOT_SAVE || JERRY_PARSER_DUMP_BYTE_CODE || JERRY_PARSER_STATS */
 
 #if JERRY_MEM_STATS
   jmem_stats_allocate_byte_code_bytes (total_size);
@@ -1401,6 +1402,9 @@ parser_resolve_private_identifier_eval (parser_context_t *context_p) /**< contex
   ecma_string_t *search_key_p;
   uint8_t *destination_p = (uint8_t *) parser_malloc (context_p, context_p->token.lit_location.length);
 
+  /* The resolved name depends on the lexical environment of the caller. */
+  context_p->global_status_flags &= (uint32_t) ~ECMA_PARSE_INTERNAL_CACHEABLE;
+
   lexer_convert_ident_to_cesu8 (destination_p,
                                 context_p->token.lit_location.char_p,
                                 context_p->token.lit_location.length);
@@ -1973,6 +1977,75 @@ parser_source_name (parser_context_t *context_p) /**< context */
 } /* parser_source_name */
 #endif /* JERRY_SOURCE_NAME */
 
+/**
+ * Get the user value of the script which calls eval
+ *
+ * @return user value of the caller script - if present
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t
+parser_get_eval_user_value (void)
+{
+  if (JERRY_CONTEXT (vm_top_context_p) == NULL)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  const ecma_compiled_code_t *bytecode_header_p = JERRY_CONTEXT (vm_top_context_p)->shared_p->bytecode_header_p;
+
+#if JERRY_SNAPSHOT_EXEC
+  if (JERRY_UNLIKELY (bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+#endif /* JERRY_SNAPSHOT_EXEC */
+
+  ecma_value_t parent_script_value = ((cbc_uint8_arguments_t *) bytecode_header_p)->script_value;
+  cbc_script_t *parent_script_p = ECMA_GET_INTERNAL_VALUE_POINTER (cbc_script_t, parent_script_value);
+
+  if (parent_script_p->refs_and_type & CBC_SCRIPT_HAS_USER_VALUE)
+  {
+    return CBC_SCRIPT_GET_USER_VALUE (parent_script_p);
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* parser_get_eval_user_value */
+
+/**
+ * Checks whether the compiled code of eval and dynamic function sources can be shared through the eval cache
+ *
+ * @return true - if the eval cache can be used
+ *         false - otherwise
+ */
+static bool
+parser_can_use_eval_cache (uint32_t parse_opts, /**< ecma_parse_opts_t option bits */
+                           const jerry_parse_options_t *options_p) /**< additional configuration options */
+{
+  if (options_p != NULL || !(parse_opts & ECMA_PARSE_HAS_SOURCE_VALUE)
+      || !(parse_opts & (ECMA_PARSE_EVAL | ECMA_PARSE_HAS_ARGUMENT_LIST_VALUE)))
+  {
+    return false;
+  }
+
+#if JERRY_DEBUGGER
+  if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+  {
+    /* The debugger client expects the source code and the breakpoints of each parsing. */
+    return false;
+  }
+#endif /* JERRY_DEBUGGER */
+
+#if JERRY_PARSER_DUMP_BYTE_CODE
+  if (JERRY_CONTEXT (jerry_init_flags) & JERRY_INIT_SHOW_OPCODES)
+  {
+    return false;
+  }
+#endif /* JERRY_PARSER_DUMP_BYTE_CODE */
+
+  /* Object user values are only kept alive by the functions created from the script. */
+  return !(parse_opts & ECMA_PARSE_EVAL) || parser_get_eval_user_value () == ECMA_VALUE_EMPTY;
+} /* parser_can_use_eval_cache */
+
 /**
  * Parse and compile EcmaScript source code
  *
@@ -1987,11 +2060,27 @@ parser_parse_source (void *source_p, /**< source code */
 {
   parser_context_t context;
   ecma_compiled_code_t *compiled_code_p;
+  bool is_cacheable = parser_can_use_eval_cache (parse_opts, options_p);
+
+  if (is_cacheable)
+  {
+    compiled_code_p = ecma_eval_cache_lookup ((ecma_value_t *) source_p, parse_opts);
+
+    if (compiled_code_p != NULL)
+    {
+      return compiled_code_p;
+    }
+  }
 
   context.error = PARSER_ERR_NO_ERROR;
   context.status_flags = parse_opts & PARSER_STRICT_MODE_MASK;
   context.global_status_flags = parse_opts;
 
+  if (is_cacheable)
+  {
+    context.global_status_flags |= ECMA_PARSE_INTERNAL_CACHEABLE;
+  }
+
   context.status_flags |= PARSER_RESTORE_STATUS_FLAGS (parse_opts);
   context.tagged_template_literal_cp = JMEM_CP_NULL;
 
@@ -2084,23 +2173,7 @@ parser_parse_source (void *source_p, /**< source code */
 
   if ((context.global_status_flags & ECMA_PARSE_EVAL) && JERRY_CONTEXT (vm_top_context_p) != NULL)
   {
-    const ecma_compiled_code_t *bytecode_header_p = JERRY_CONTEXT (vm_top_context_p)->shared_p->bytecode_header_p;
-
-#if JERRY_SNAPSHOT_EXEC
-    if (JERRY_LIKELY (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION)))
-    {
-#endif /* JERRY_SNAPSHOT_EXEC */
-      ecma_value_t parent_script_value = ((cbc_uint8_arguments_t *) bytecode_header_p)->script_value;
-      ;
-      cbc_script_t *parent_script_p = ECMA_GET_INTERNAL_VALUE_POINTER (cbc_script_t, parent_script_value);
-
-      if (parent_script_p->refs_and_type & CBC_SCRIPT_HAS_USER_VALUE)
-      {
-        context.user_value = CBC_SCRIPT_GET_USER_VALUE (parent_script_p);
-      }
-#if JERRY_SNAPSHOT_EXEC
-    }
-#endif /* JERRY_SNAPSHOT_EXEC */
+    context.user_value = parser_get_eval_user_value ();
   }
   else if (context.options_p != NULL && (context.options_p->options & JERRY_PARSE_HAS_USER_VALUE))
   {
@@ -2140,6 +2213,8 @@ parser_parse_source (void *source_p, /**< source code */
   context.scope_stack_global_end = 0;
   context.tagged_template_literal_cp = JMEM_CP_NULL;
   context.private_context_p = NULL;
+  context.jump_count = 0;
+  context.dead_statements.byte_code_size = PARSER_DEAD_CODE_NONE;
 
 #ifndef JERRY_NDEBUG
   context.context_stack_depth = 0;
@@ -2164,18 +2239,45 @@ parser_parse_source (void *source_p, /**< source code */
   }
 #endif /* JERRY_PARSER_DUMP_BYTE_CODE */
 
-  scanner_scan_all (&context);
+#if JERRY_PARSER_STATS
+  double parse_start_time = jerry_port_current_time ();
+#endif /* JERRY_PARSER_STATS */
+
+  parser_arena_t arena;
+  parser_arena_init (&arena);
+
+  scanner_cache_key_t scanner_cache_key;
+  bool use_scanner_cache = scanner_cache_get_key (&context, &scanner_cache_key);
+  uint8_t *scanner_cache_p = NULL;
+  size_t scanner_cache_size = 0;
 
-  if (JERRY_UNLIKELY (context.error != PARSER_ERR_NO_ERROR))
+  if (!use_scanner_cache || !scanner_cache_load (&context, &scanner_cache_key))
   {
-    JERRY_ASSERT (context.error == PARSER_ERR_OUT_OF_MEMORY);
+    scanner_scan_all (&context);
 
-    /* It is unlikely that memory can be allocated in an out-of-memory
-     * situation. However, a simple value can still be thrown. */
-    jcontext_raise_exception (ECMA_VALUE_NULL);
-    return NULL;
+    if (JERRY_UNLIKELY (context.error != PARSER_ERR_NO_ERROR))
+    {
+      JERRY_ASSERT (context.error == PARSER_ERR_OUT_OF_MEMORY);
+      parser_arena_release (&arena);
+
+      /* It is unlikely that memory can be allocated in an out-of-memory
+       * situation. However, a simple value can still be thrown. */
+      jcontext_raise_exception (ECMA_VALUE_NULL);
+      return NULL;
+    }
+
+    if (use_scanner_cache && JERRY_CONTEXT (parse_cache_store_callback_p) != NULL)
+    {
+      /* The parser consumes the scanner info list, so it is serialized now,
+       * but it is only stored when the parsing is successfully completed. */
+      scanner_cache_p = scanner_cache_save (&context, &scanner_cache_key, &scanner_cache_size);
+    }
   }
 
+#if JERRY_PARSER_STATS
+  double scan_end_time = jerry_port_current_time ();
+#endif /* JERRY_PARSER_STATS */
+
   if (context.arguments_start_p == NULL)
   {
     context.source_p = context.source_start_p;
@@ -2415,6 +2517,7 @@ parser_parse_source (void *source_p, /**< source code */
 #endif /* JERRY_PARSER_DUMP_BYTE_CODE */
 
   parser_stack_free (&context);
+  parser_arena_release (&arena);
 
   if (context.global_status_flags & ECMA_PARSE_INTERNAL_FREE_SOURCE)
   {
@@ -2426,8 +2529,35 @@ parser_parse_source (void *source_p, /**< source code */
     jmem_heap_free_block ((void *) context.arguments_start_p, context.arguments_size);
   }
 
+#if JERRY_PARSER_STATS
+  jerry_parse_stats_t *parse_stats_p = &JERRY_CONTEXT (parse_stats);
+
+  parse_stats_p->parse_count++;
+  parse_stats_p->source_size += context.source_size + context.arguments_size;
+  parse_stats_p->scanner_time += scan_end_time - parse_start_time;
+  parse_stats_p->parser_time += jerry_port_current_time () - scan_end_time;
+#endif /* JERRY_PARSER_STATS */
+
+  if (scanner_cache_p != NULL)
+  {
+    if (compiled_code_p != NULL)
+    {
+      JERRY_CONTEXT (parse_cache_store_callback_p) (scanner_cache_key.hash,
+                                                    scanner_cache_p,
+                                                    scanner_cache_size,
+                                                    JERRY_CONTEXT (parse_cache_user_p));
+    }
+
+    jmem_heap_free_block (scanner_cache_p, scanner_cache_size);
+  }
+
   if (compiled_code_p != NULL)
   {
+    if (context.global_status_flags & ECMA_PARSE_INTERNAL_CACHEABLE)
+    {
+      ecma_eval_cache_insert ((ecma_value_t *) source_p, parse_opts, compiled_code_p);
+    }
+
     return compiled_code_p;
   }
 
@@ -2544,6 +2674,9 @@ parser_save_context (parser_context_t *context_p, /**< context */
   saved_context_p->scope_stack_reg_top = context_p->scope_stack_reg_top;
   saved_context_p->scope_stack_global_end = context_p->scope_stack_global_end;
   saved_context_p->tagged_template_literal_cp = context_p->tagged_template_literal_cp;
+  saved_context_p->jump_count = context_p->jump_count;
+  saved_context_p->dead_statements = context_p->dead_statements;
+  saved_context_p->dead_statements_list = context_p->dead_statements_list;
 
 #ifndef JERRY_NDEBUG
   saved_context_p->context_stack_depth = context_p->context_stack_depth;
@@ -2579,6 +2712,7 @@ parser_save_context (parser_context_t *context_p, /**< context */
   context_p->scope_stack_reg_top = 0;
   context_p->scope_stack_global_end = 0;
   context_p->tagged_template_literal_cp = JMEM_CP_NULL;
+  context_p->dead_statements.byte_code_size = PARSER_DEAD_CODE_NONE;
 
 #ifndef JERRY_NDEBUG
   context_p->context_stack_depth = 0;
@@ -2631,6 +2765,9 @@ parser_restore_context (parser_context_t *context_p, /**< context */
   context_p->scope_stack_reg_top = saved_context_p->scope_stack_reg_top;
   context_p->scope_stack_global_end = saved_context_p->scope_stack_global_end;
   context_p->tagged_template_literal_cp = saved_context_p->tagged_template_literal_cp;
+  context_p->jump_count = saved_context_p->jump_count;
+  context_p->dead_statements = saved_context_p->dead_statements;
+  context_p->dead_statements_list = saved_context_p->dead_statements_list;
 
 #ifndef JERRY_NDEBUG
   context_p->context_stack_depth = saved_context_p->context_stack_depth;
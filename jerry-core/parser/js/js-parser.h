@@ -31,6 +31,10 @@
 /* Note: source must be a valid UTF-8 string */
 ecma_compiled_code_t *parser_parse_script (void *source_p, uint32_t parse_opts, const jerry_parse_options_t *options_p);
 
+#if JERRY_PARSER
+void parser_arena_free_cache (void);
+#endif /* JERRY_PARSER */
+
 /**
  * @}
  * @}
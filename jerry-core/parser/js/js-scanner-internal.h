@@ -345,6 +345,7 @@ void scanner_raise_error (parser_context_t *context_p);
 void scanner_raise_redeclaration_error (parser_context_t *context_p);
 
 void *scanner_malloc (parser_context_t *context_p, size_t size);
+void *scanner_malloc_info (parser_context_t *context_p, size_t size);
 void scanner_free (void *ptr, size_t size);
 
 size_t scanner_get_stream_size (scanner_info_t *info_p, size_t size);
@@ -78,6 +78,19 @@ scanner_raise_redeclaration_error (parser_context_t *context_p) /**< context */
   scanner_raise_error (context_p);
 } /* scanner_raise_redeclaration_error */
 
+/**
+ * Raise an out of memory error.
+ */
+static void JERRY_ATTR_NOINLINE
+scanner_raise_out_of_memory (parser_context_t *context_p) /**< context */
+{
+  scanner_cleanup (context_p);
+
+  /* This is the only error which specify its reason. */
+  context_p->error = PARSER_ERR_OUT_OF_MEMORY;
+  PARSER_THROW (context_p->try_buffer);
+} /* scanner_raise_out_of_memory */
+
 /**
  * Allocate memory for scanner.
  *
@@ -90,19 +103,40 @@ scanner_malloc (parser_context_t *context_p, /**< context */
   void *result;
 
   JERRY_ASSERT (size > 0);
-  result = jmem_heap_alloc_block_null_on_error (size);
+  result = parser_arena_alloc_null_on_error (size);
 
   if (result == NULL)
   {
-    scanner_cleanup (context_p);
-
-    /* This is the only error which specify its reason. */
-    context_p->error = PARSER_ERR_OUT_OF_MEMORY;
-    PARSER_THROW (context_p->try_buffer);
+    scanner_raise_out_of_memory (context_p);
   }
   return result;
 } /* scanner_malloc */
 
+/**
+ * Allocate memory for data which is used by the parser after scanning.
+ *
+ * Note:
+ *      this memory is allocated on the heap, since the space of the arena
+ *      blocks cannot be reused by the byte code created during parsing
+ *
+ * @return allocated memory
+ */
+void *
+scanner_malloc_info (parser_context_t *context_p, /**< context */
+                     size_t size) /**< size of the memory block */
+{
+  void *result;
+
+  JERRY_ASSERT (size > 0);
+  result = jmem_heap_alloc_block_null_on_error (size);
+
+  if (result == NULL)
+  {
+    scanner_raise_out_of_memory (context_p);
+  }
+  return result;
+} /* scanner_malloc_info */
+
 /**
  * Free memory allocated by scanner_malloc.
  */
@@ -110,7 +144,7 @@ extern inline void JERRY_ATTR_ALWAYS_INLINE
 scanner_free (void *ptr, /**< pointer to free */
               size_t size) /**< size of the memory block */
 {
-  jmem_heap_free_block (ptr, size);
+  parser_arena_free (ptr, size);
 } /* scanner_free */
 
 /**
@@ -180,7 +214,7 @@ scanner_insert_info (parser_context_t *context_p, /**< context */
                      const uint8_t *source_p, /**< triggering position */
                      size_t size) /**< size of the memory block */
 {
-  scanner_info_t *new_scanner_info_p = (scanner_info_t *) scanner_malloc (context_p, size);
+  scanner_info_t *new_scanner_info_p = (scanner_info_t *) scanner_malloc_info (context_p, size);
   scanner_info_t *scanner_info_p = context_p->next_scanner_info_p;
   scanner_info_t *prev_scanner_info_p = NULL;
 
@@ -227,7 +261,7 @@ scanner_insert_info_before (parser_context_t *context_p, /**< context */
 {
   JERRY_ASSERT (start_info_p != NULL);
 
-  scanner_info_t *new_scanner_info_p = (scanner_info_t *) scanner_malloc (context_p, size);
+  scanner_info_t *new_scanner_info_p = (scanner_info_t *) scanner_malloc_info (context_p, size);
   scanner_info_t *scanner_info_p = start_info_p->next_p;
   scanner_info_t *prev_scanner_info_p = start_info_p;
 
@@ -468,7 +502,7 @@ scanner_find_duplicated_arg (parser_context_t *context_p, lexer_lit_location_t *
     }
 
     ecma_string_t *arg_string = ecma_get_string_from_value (literal_start_p[literal_index]);
-    uint8_t *destination_p = (uint8_t *) parser_malloc (context_p, lit_loc_p->length);
+    uint8_t *destination_p = (uint8_t *) scanner_malloc (context_p, lit_loc_p->length);
     lexer_convert_ident_to_cesu8 (destination_p, lit_loc_p->char_p, lit_loc_p->length);
     ecma_string_t *search_key_p = ecma_new_ecma_string_from_utf8 (destination_p, lit_loc_p->length);
     scanner_free (destination_p, lit_loc_p->length);
@@ -502,6 +536,9 @@ scanner_scope_find_lexical_declaration (parser_context_t *context_p, /**< contex
     return false;
   }
 
+  /* The result depends on the current lexical environment. */
+  context_p->global_status_flags &= (uint32_t) ~ECMA_PARSE_INTERNAL_CACHEABLE;
+
   if (JERRY_LIKELY (!(literal_p->status_flags & LEXER_LIT_LOCATION_HAS_ESCAPE)))
   {
     name_p = ecma_new_ecma_string_from_utf8 (literal_p->char_p, literal_p->length);
@@ -1585,7 +1622,8 @@ scanner_add_private_identifier (parser_context_t *context_p, /**< context  */
   }
 
   scanner_class_private_member_t *p_member;
-  p_member = (scanner_class_private_member_t *) scanner_malloc (context_p, sizeof (scanner_class_private_member_t));
+  p_member =
+    (scanner_class_private_member_t *) scanner_malloc_info (context_p, sizeof (scanner_class_private_member_t));
   p_member->loc = context_p->token.lit_location;
   p_member->u8_arg = (uint8_t) opts;
   p_member->prev_p = class_info_p->members;
@@ -2004,7 +2042,7 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
       }
     }
 
-    scanner_free (scanner_info_p, size);
+    jmem_heap_free_block (scanner_info_p, size);
     scanner_info_p = next_scanner_info_p;
   }
 
@@ -2012,6 +2050,1012 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   context_p->active_scanner_info_p = NULL;
 } /* scanner_cleanup */
 
+/**
+ * Encoded position of a NULL pointer.
+ */
+#define SCANNER_CACHE_NULL_POSITION UINT32_MAX
+
+/**
+ * Maximum size of source codes whose positions can be encoded.
+ */
+#define SCANNER_CACHE_MAX_SOURCE_SIZE (UINT32_MAX >> 2)
+
+/**
+ * Option bits which affect scanning and stored in the key.
+ */
+#define SCANNER_CACHE_PARSE_OPTIONS \
+  (ECMA_PARSE_STRICT_MODE | ECMA_PARSE_MODULE | ECMA_PARSE_GENERATOR_FUNCTION | ECMA_PARSE_ASYNC_FUNCTION)
+
+/**
+ * Global status flags which are set by the scanner.
+ */
+#if JERRY_MODULE_SYSTEM && JERRY_FUNCTION_TO_STRING
+#define SCANNER_CACHE_GLOBAL_STATUS_FLAGS (ECMA_PARSE_INTERNAL_HAS_IMPORT_META | ECMA_PARSE_INTERNAL_HAS_4_BYTE_MARKER)
+#elif JERRY_MODULE_SYSTEM
+#define SCANNER_CACHE_GLOBAL_STATUS_FLAGS ECMA_PARSE_INTERNAL_HAS_IMPORT_META
+#elif JERRY_FUNCTION_TO_STRING
+#define SCANNER_CACHE_GLOBAL_STATUS_FLAGS ECMA_PARSE_INTERNAL_HAS_4_BYTE_MARKER
+#else /* !JERRY_MODULE_SYSTEM && !JERRY_FUNCTION_TO_STRING */
+#define SCANNER_CACHE_GLOBAL_STATUS_FLAGS 0
+#endif /* JERRY_MODULE_SYSTEM && JERRY_FUNCTION_TO_STRING */
+
+/**
+ * Build options and structure sizes which affect the serialized data. Data
+ * stored by a differently configured engine is ignored and the code is scanned.
+ */
+#define SCANNER_CACHE_BUILD_FLAGS                                                                                 \
+  ((uint32_t) JERRY_MODULE_SYSTEM | ((uint32_t) JERRY_FUNCTION_TO_STRING << 1) | ((uint32_t) JERRY_DEBUGGER << 2) \
+   | ((uint32_t) sizeof (uintptr_t) << 8) | ((uint32_t) sizeof (scanner_info_t) << 16)                            \
+   | ((uint32_t) sizeof (scanner_class_private_member_t) << 24))
+
+/**
+ * Writer of a serialized scanner info list.
+ */
+typedef struct
+{
+  uint8_t *buffer_p; /**< output buffer (NULL, if only the size is computed) */
+  size_t size; /**< size of the written data */
+  bool is_valid; /**< false, if a position cannot be encoded */
+} scanner_cache_writer_t;
+
+/**
+ * Reader of a serialized scanner info list.
+ */
+typedef struct
+{
+  const uint8_t *data_p; /**< next byte */
+  const uint8_t *data_end_p; /**< end of the data */
+} scanner_cache_reader_t;
+
+/**
+ * Compute the key of the scanner info list of the currently parsed source code.
+ *
+ * Note:
+ *      the scanner info list of eval code is never cached, since
+ *      its content depends on the enclosing lexical environments
+ *
+ * @return true - if the scanner info list can be cached, false - otherwise
+ */
+bool
+scanner_cache_get_key (parser_context_t *context_p, /**< context */
+                       scanner_cache_key_t *key_p) /**< [out] key */
+{
+  if ((JERRY_CONTEXT (parse_cache_load_callback_p) == NULL && JERRY_CONTEXT (parse_cache_store_callback_p) == NULL)
+      || (context_p->global_status_flags & ECMA_PARSE_EVAL) || context_p->source_size > SCANNER_CACHE_MAX_SOURCE_SIZE
+      || context_p->arguments_size > SCANNER_CACHE_MAX_SOURCE_SIZE)
+  {
+    return false;
+  }
+
+#if JERRY_DEBUGGER
+  if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+  {
+    /* The scanner produces different info blocks when the debugger is connected. */
+    return false;
+  }
+#endif /* JERRY_DEBUGGER */
+
+  key_p->version = SCANNER_CACHE_VERSION;
+  key_p->build_flags = SCANNER_CACHE_BUILD_FLAGS;
+  key_p->hash = 0;
+  key_p->source_size = context_p->source_size;
+  key_p->arguments_size = context_p->arguments_size;
+  key_p->status_flags = context_p->status_flags;
+  key_p->parse_options = context_p->global_status_flags & SCANNER_CACHE_PARSE_OPTIONS;
+  key_p->start_line = context_p->line;
+  key_p->start_column = context_p->column;
+
+  lit_string_hash_t hash = lit_utf8_string_calc_hash (context_p->source_start_p, context_p->source_size);
+
+  if (context_p->arguments_start_p != NULL)
+  {
+    hash = lit_utf8_string_hash_combine (hash, context_p->arguments_start_p, context_p->arguments_size);
+  }
+
+  key_p->hash = lit_utf8_string_hash_combine (hash, (const uint8_t *) key_p, sizeof (scanner_cache_key_t));
+  return true;
+} /* scanner_cache_get_key */
+
+/**
+ * Get the size of an entry of a compressed stream.
+ *
+ * @return size of the entry in bytes, 0 if the entry type is invalid
+ */
+static size_t
+scanner_cache_get_entry_size (const uint8_t *data_p, /**< stream entry */
+                              size_t available_size) /**< number of readable bytes */
+{
+  uint8_t type = data_p[0] & SCANNER_STREAM_TYPE_MASK;
+
+  if (type == SCANNER_STREAM_TYPE_HOLE || SCANNER_STREAM_TYPE_IS_ARGUMENTS (type))
+  {
+    return 1;
+  }
+
+  if (type < SCANNER_STREAM_TYPE_VAR || type > SCANNER_STREAM_TYPE_FUNC || available_size < 2 + 1)
+  {
+    return 0;
+  }
+
+  if (data_p[0] & SCANNER_STREAM_UINT16_DIFF)
+  {
+    return 2 + 2;
+  }
+
+  return (data_p[2] != 0) ? (2 + 1) : (2 + 1 + sizeof (uintptr_t));
+} /* scanner_cache_get_entry_size */
+
+/**
+ * Encode a source position which is independent from the address of the source code.
+ *
+ * @return encoded position
+ */
+static uint32_t
+scanner_cache_encode_position (parser_context_t *context_p, /**< context */
+                               scanner_cache_writer_t *writer_p, /**< writer */
+                               const uint8_t *source_p) /**< source position */
+{
+  if (source_p == NULL)
+  {
+    return SCANNER_CACHE_NULL_POSITION;
+  }
+
+  if (source_p >= context_p->source_start_p && source_p <= context_p->source_start_p + context_p->source_size)
+  {
+    return (uint32_t) (source_p - context_p->source_start_p) << 1;
+  }
+
+  if (context_p->arguments_start_p != NULL && source_p >= context_p->arguments_start_p
+      && source_p <= context_p->arguments_start_p + context_p->arguments_size)
+  {
+    return ((uint32_t) (source_p - context_p->arguments_start_p) << 1) | 0x1;
+  }
+
+  writer_p->is_valid = false;
+  return SCANNER_CACHE_NULL_POSITION;
+} /* scanner_cache_encode_position */
+
+/**
+ * Decode a source position encoded by scanner_cache_encode_position.
+ *
+ * @return true - if the position is valid, false - otherwise
+ */
+static bool
+scanner_cache_decode_position (parser_context_t *context_p, /**< context */
+                               uint32_t position, /**< encoded position */
+                               const uint8_t **source_p) /**< [out] source position */
+{
+  if (position == SCANNER_CACHE_NULL_POSITION)
+  {
+    *source_p = NULL;
+    return true;
+  }
+
+  const uint8_t *start_p = context_p->source_start_p;
+  uint32_t size = context_p->source_size;
+
+  if (position & 0x1)
+  {
+    if (context_p->arguments_start_p == NULL)
+    {
+      return false;
+    }
+
+    start_p = context_p->arguments_start_p;
+    size = context_p->arguments_size;
+  }
+
+  position >>= 1;
+
+  if (position > size)
+  {
+    return false;
+  }
+
+  *source_p = start_p + position;
+  return true;
+} /* scanner_cache_decode_position */
+
+/**
+ * Append data to the serialized scanner info list.
+ */
+static void
+scanner_cache_write (scanner_cache_writer_t *writer_p, /**< writer */
+                     const void *data_p, /**< data */
+                     size_t size) /**< size of the data */
+{
+  if (writer_p->buffer_p != NULL)
+  {
+    memcpy (writer_p->buffer_p + writer_p->size, data_p, size);
+  }
+
+  writer_p->size += size;
+} /* scanner_cache_write */
+
+/**
+ * Append a location to the serialized scanner info list.
+ */
+static void
+scanner_cache_write_location (parser_context_t *context_p, /**< context */
+                              scanner_cache_writer_t *writer_p, /**< writer */
+                              const scanner_location_t *location_p) /**< location */
+{
+  uint32_t data[3];
+
+  data[0] = scanner_cache_encode_position (context_p, writer_p, location_p->source_p);
+  data[1] = location_p->line;
+  data[2] = location_p->column;
+
+  scanner_cache_write (writer_p, data, sizeof (data));
+} /* scanner_cache_write_location */
+
+/**
+ * Checks whether a source position is inside the function arguments.
+ *
+ * @return true - if the position is inside the function arguments, false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+scanner_cache_is_argument_position (parser_context_t *context_p, /**< context */
+                                    const uint8_t *source_p) /**< source position */
+{
+  return (context_p->arguments_start_p != NULL && source_p >= context_p->arguments_start_p
+          && source_p <= context_p->arguments_start_p + context_p->arguments_size);
+} /* scanner_cache_is_argument_position */
+
+/**
+ * Append the compressed stream of a function or block info to the serialized scanner info list.
+ *
+ * Note:
+ *      positions are stored instead of pointers, and relative distances between
+ *      the function arguments and the source code are also replaced by positions,
+ *      since these buffers are not allocated at the same distance when reparsing
+ */
+static void
+scanner_cache_write_stream (parser_context_t *context_p, /**< context */
+                            scanner_cache_writer_t *writer_p, /**< writer */
+                            scanner_info_t *info_p) /**< function or block info */
+{
+  const uint8_t *data_p = (const uint8_t *) (info_p + 1);
+  const uint8_t *prev_source_p = info_p->source_p - 1;
+  bool prev_is_argument = scanner_cache_is_argument_position (context_p, info_p->source_p);
+
+  while (data_p[0] != SCANNER_STREAM_TYPE_END)
+  {
+    size_t entry_size = scanner_cache_get_entry_size (data_p, SIZE_MAX);
+
+    JERRY_ASSERT (entry_size > 0);
+
+    if (entry_size == 1)
+    {
+      scanner_cache_write (writer_p, data_p, 1);
+      data_p++;
+      continue;
+    }
+
+    const uint8_t *source_p;
+
+    if (entry_size == 2 + 1 + sizeof (uintptr_t))
+    {
+      memcpy (&source_p, data_p + 2 + 1, sizeof (uintptr_t));
+    }
+    else if (data_p[0] & SCANNER_STREAM_UINT16_DIFF)
+    {
+      int32_t diff = ((int32_t) data_p[2]) | ((int32_t) data_p[3]) << 8;
+
+      if (diff <= (int32_t) UINT8_MAX)
+      {
+        diff = -diff;
+      }
+
+      source_p = prev_source_p + diff;
+    }
+    else
+    {
+      source_p = prev_source_p + data_p[2];
+    }
+
+    bool is_argument = scanner_cache_is_argument_position (context_p, source_p);
+
+    if (entry_size == 2 + 1 + sizeof (uintptr_t) || is_argument != prev_is_argument)
+    {
+      uint8_t header[2 + 1];
+      uintptr_t position = (uintptr_t) scanner_cache_encode_position (context_p, writer_p, source_p);
+
+      header[0] = (uint8_t) (data_p[0] & ~SCANNER_STREAM_UINT16_DIFF);
+      header[1] = data_p[1];
+      header[2] = 0;
+
+      scanner_cache_write (writer_p, header, sizeof (header));
+      scanner_cache_write (writer_p, &position, sizeof (uintptr_t));
+    }
+    else
+    {
+      scanner_cache_write (writer_p, data_p, entry_size);
+    }
+
+    prev_source_p = source_p + data_p[1];
+    prev_is_argument = is_argument;
+    data_p += entry_size;
+  }
+
+  scanner_cache_write (writer_p, data_p, 1);
+} /* scanner_cache_write_stream */
+
+/**
+ * Serialize the scanner info list.
+ */
+static void
+scanner_cache_write_info_list (parser_context_t *context_p, /**< context */
+                               scanner_cache_writer_t *writer_p) /**< writer */
+{
+  scanner_info_t *info_p = context_p->next_scanner_info_p;
+
+  while (true)
+  {
+    scanner_cache_info_t info;
+
+    info.source_position = scanner_cache_encode_position (context_p, writer_p, info_p->source_p);
+    info.type = info_p->type;
+    info.u8_arg = info_p->u8_arg;
+    info.u16_arg = info_p->u16_arg;
+
+    scanner_cache_write (writer_p, &info, sizeof (scanner_cache_info_t));
+
+    switch (info_p->type)
+    {
+      case SCANNER_TYPE_END:
+      {
+        return;
+      }
+      case SCANNER_TYPE_FUNCTION:
+      case SCANNER_TYPE_BLOCK:
+      {
+        scanner_cache_write_stream (context_p, writer_p, info_p);
+        break;
+      }
+      case SCANNER_TYPE_WHILE:
+      case SCANNER_TYPE_FOR_IN:
+      case SCANNER_TYPE_FOR_OF:
+      case SCANNER_TYPE_CASE:
+      case SCANNER_TYPE_INITIALIZER:
+      case SCANNER_TYPE_CLASS_FIELD_INITIALIZER_END:
+      case SCANNER_TYPE_CLASS_STATIC_BLOCK_END:
+      {
+        scanner_cache_write_location (context_p, writer_p, &((scanner_location_info_t *) info_p)->location);
+        break;
+      }
+      case SCANNER_TYPE_FOR:
+      {
+        scanner_for_info_t *for_info_p = (scanner_for_info_t *) info_p;
+
+        scanner_cache_write_location (context_p, writer_p, &for_info_p->expression_location);
+        scanner_cache_write_location (context_p, writer_p, &for_info_p->end_location);
+        break;
+      }
+      case SCANNER_TYPE_SWITCH:
+      {
+        uint32_t count = 0;
+        scanner_case_info_t *case_p = ((scanner_switch_info_t *) info_p)->case_p;
+
+        for (scanner_case_info_t *current_p = case_p; current_p != NULL; current_p = current_p->next_p)
+        {
+          count++;
+        }
+
+        scanner_cache_write (writer_p, &count, sizeof (uint32_t));
+
+        while (case_p != NULL)
+        {
+          scanner_cache_write_location (context_p, writer_p, &case_p->location);
+          case_p = case_p->next_p;
+        }
+        break;
+      }
+      case SCANNER_TYPE_CLASS_CONSTRUCTOR:
+      {
+        uint32_t count = 0;
+        scanner_class_private_member_t *member_p = ((scanner_class_info_t *) info_p)->members;
+
+        for (scanner_class_private_member_t *current_p = member_p; current_p != NULL; current_p = current_p->prev_p)
+        {
+          count++;
+        }
+
+        scanner_cache_write (writer_p, &count, sizeof (uint32_t));
+
+        while (member_p != NULL)
+        {
+          uint32_t data[2];
+          uint8_t flags[4];
+
+          data[0] = scanner_cache_encode_position (context_p, writer_p, member_p->loc.char_p);
+          data[1] = member_p->loc.length;
+          flags[0] = member_p->loc.type;
+          flags[1] = member_p->loc.status_flags;
+          flags[2] = member_p->u8_arg;
+          flags[3] = 0;
+
+          scanner_cache_write (writer_p, data, sizeof (data));
+          scanner_cache_write (writer_p, flags, sizeof (flags));
+          member_p = member_p->prev_p;
+        }
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (info_p->type <= SCANNER_TYPE_EXPORT_MODULE_SPECIFIER);
+        break;
+      }
+    }
+
+    info_p = info_p->next_p;
+  }
+} /* scanner_cache_write_info_list */
+
+/**
+ * Compute the checksum of the global status flags and the serialized scanner info list.
+ *
+ * @return checksum
+ */
+static uint32_t
+scanner_cache_get_checksum (uint32_t global_status_flags, /**< global status flags stored in the header */
+                            const uint8_t *data_p, /**< serialized scanner info list */
+                            size_t size) /**< size of the list */
+{
+  lit_string_hash_t hash = lit_utf8_string_calc_hash ((const uint8_t *) &global_status_flags, sizeof (uint32_t));
+
+  return lit_utf8_string_hash_combine (hash, data_p, (lit_utf8_size_t) size);
+} /* scanner_cache_get_checksum */
+
+/**
+ * Serialize the scanner info list of the currently parsed source code. The
+ * result can be passed to the store callback of the embedding application.
+ *
+ * Note:
+ *      must be called before the parser starts consuming the scanner info list
+ *
+ * @return serialized data allocated on the heap, NULL if the list cannot be serialized
+ */
+uint8_t *
+scanner_cache_save (parser_context_t *context_p, /**< context */
+                    const scanner_cache_key_t *key_p, /**< key of the source code */
+                    size_t *size_p) /**< [out] size of the serialized data */
+{
+  scanner_cache_writer_t writer;
+
+  writer.buffer_p = NULL;
+  writer.size = 0;
+  writer.is_valid = true;
+
+  scanner_cache_write_info_list (context_p, &writer);
+
+  if (!writer.is_valid)
+  {
+    return NULL;
+  }
+
+  size_t size = sizeof (scanner_cache_header_t) + writer.size;
+  uint8_t *buffer_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (size);
+
+  if (buffer_p == NULL)
+  {
+    return NULL;
+  }
+
+  scanner_cache_header_t *header_p = (scanner_cache_header_t *) buffer_p;
+
+  writer.buffer_p = buffer_p + sizeof (scanner_cache_header_t);
+  writer.size = 0;
+
+  scanner_cache_write_info_list (context_p, &writer);
+
+  JERRY_ASSERT (writer.is_valid && sizeof (scanner_cache_header_t) + writer.size == size);
+
+  header_p->key = *key_p;
+  header_p->global_status_flags = context_p->global_status_flags & SCANNER_CACHE_GLOBAL_STATUS_FLAGS;
+  header_p->checksum = scanner_cache_get_checksum (header_p->global_status_flags, writer.buffer_p, writer.size);
+
+  *size_p = size;
+  return buffer_p;
+} /* scanner_cache_save */
+
+/**
+ * Read data from the serialized scanner info list.
+ *
+ * @return true - if the data is available, false - otherwise
+ */
+static bool
+scanner_cache_read (scanner_cache_reader_t *reader_p, /**< reader */
+                    void *data_p, /**< [out] data */
+                    size_t size) /**< size of the data */
+{
+  if ((size_t) (reader_p->data_end_p - reader_p->data_p) < size)
+  {
+    return false;
+  }
+
+  memcpy (data_p, reader_p->data_p, size);
+  reader_p->data_p += size;
+  return true;
+} /* scanner_cache_read */
+
+/**
+ * Read a location from the serialized scanner info list.
+ *
+ * @return true - if the location is valid, false - otherwise
+ */
+static bool
+scanner_cache_read_location (parser_context_t *context_p, /**< context */
+                             scanner_cache_reader_t *reader_p, /**< reader */
+                             scanner_location_t *location_p) /**< [out] location */
+{
+  uint32_t data[3];
+
+  if (!scanner_cache_read (reader_p, data, sizeof (data)))
+  {
+    return false;
+  }
+
+  location_p->line = data[1];
+  location_p->column = data[2];
+  return scanner_cache_decode_position (context_p, data[0], &location_p->source_p);
+} /* scanner_cache_read_location */
+
+/**
+ * Compute the size of a serialized compressed stream.
+ *
+ * @return size of the stream including its terminator, 0 if the stream is invalid
+ */
+static size_t
+scanner_cache_get_stream_size (scanner_cache_reader_t *reader_p) /**< reader */
+{
+  const uint8_t *data_p = reader_p->data_p;
+
+  while (data_p < reader_p->data_end_p)
+  {
+    if (data_p[0] == SCANNER_STREAM_TYPE_END)
+    {
+      return (size_t) (data_p - reader_p->data_p) + 1;
+    }
+
+    size_t available_size = (size_t) (reader_p->data_end_p - data_p);
+    size_t entry_size = scanner_cache_get_entry_size (data_p, available_size);
+
+    if (entry_size == 0 || entry_size > available_size)
+    {
+      return 0;
+    }
+
+    data_p += entry_size;
+  }
+
+  return 0;
+} /* scanner_cache_get_stream_size */
+
+/**
+ * Checks whether an identifier is inside the source code or the function arguments.
+ *
+ * @return true - if the identifier is inside one of these buffers, false - otherwise
+ */
+static bool
+scanner_cache_is_valid_identifier (parser_context_t *context_p, /**< context */
+                                   const uint8_t *source_p, /**< start of the identifier */
+                                   size_t length) /**< length of the identifier */
+{
+  if (source_p >= context_p->source_start_p && source_p < context_p->source_start_p + context_p->source_size)
+  {
+    return length <= (size_t) (context_p->source_start_p + context_p->source_size - source_p);
+  }
+
+  return (context_p->arguments_start_p != NULL && source_p >= context_p->arguments_start_p
+          && source_p < context_p->arguments_start_p + context_p->arguments_size
+          && length <= (size_t) (context_p->arguments_start_p + context_p->arguments_size - source_p));
+} /* scanner_cache_is_valid_identifier */
+
+/**
+ * Replace the encoded positions of a compressed stream with pointers.
+ *
+ * Note:
+ *      the identifiers referenced by the stream are also checked,
+ *      and only function streams may describe function arguments
+ *
+ * @return true - if the stream is valid, false - otherwise
+ */
+static bool
+scanner_cache_decode_stream (parser_context_t *context_p, /**< context */
+                             scanner_info_t *info_p) /**< function or block info */
+{
+  uint8_t *data_p = (uint8_t *) (info_p + 1);
+  const uint8_t *prev_source_p = info_p->source_p - 1;
+
+  while (data_p[0] != SCANNER_STREAM_TYPE_END)
+  {
+    uint8_t type = data_p[0] & SCANNER_STREAM_TYPE_MASK;
+    size_t entry_size = scanner_cache_get_entry_size (data_p, SIZE_MAX);
+
+    if (info_p->type != SCANNER_TYPE_FUNCTION
+        && (type == SCANNER_STREAM_TYPE_HOLE || SCANNER_STREAM_TYPE_IS_ARGUMENTS (type)
+            || SCANNER_STREAM_TYPE_IS_ARG (type) || SCANNER_STREAM_TYPE_IS_ARG_FUNC (type)))
+    {
+      return false;
+    }
+
+    if (entry_size == 1)
+    {
+      data_p++;
+      continue;
+    }
+
+    const uint8_t *source_p;
+
+    if (entry_size == 2 + 1 + sizeof (uintptr_t))
+    {
+      uintptr_t position;
+
+      memcpy (&position, data_p + 2 + 1, sizeof (uintptr_t));
+
+      if ((uint32_t) position != position || !scanner_cache_decode_position (context_p, (uint32_t) position, &source_p)
+          || source_p == NULL)
+      {
+        return false;
+      }
+
+      memcpy (data_p + 2 + 1, &source_p, sizeof (uintptr_t));
+    }
+    else if (data_p[0] & SCANNER_STREAM_UINT16_DIFF)
+    {
+      int32_t diff = ((int32_t) data_p[2]) | ((int32_t) data_p[3]) << 8;
+
+      if (diff <= (int32_t) UINT8_MAX)
+      {
+        diff = -diff;
+      }
+
+      source_p = prev_source_p + diff;
+    }
+    else
+    {
+      source_p = prev_source_p + data_p[2];
+    }
+
+    if (!scanner_cache_is_valid_identifier (context_p, source_p, data_p[1]))
+    {
+      return false;
+    }
+
+    prev_source_p = source_p + data_p[1];
+    data_p += entry_size;
+  }
+
+  return true;
+} /* scanner_cache_decode_stream */
+
+/**
+ * Rebuild the scanner info list from its serialized form.
+ *
+ * Note:
+ *      the already rebuilt part of the list is always kept
+ *      in a state which can be released by scanner_cleanup
+ *
+ * @return true - if the list is successfully rebuilt, false - otherwise
+ */
+static bool
+scanner_cache_read_info_list (parser_context_t *context_p, /**< context */
+                              scanner_cache_reader_t *reader_p) /**< reader */
+{
+  scanner_info_t *end_info_p = context_p->next_scanner_info_p;
+  scanner_info_t **next_p_p = &context_p->next_scanner_info_p;
+  uint32_t last_position[2] = { SCANNER_CACHE_NULL_POSITION, SCANNER_CACHE_NULL_POSITION };
+
+  while (true)
+  {
+    scanner_cache_info_t info;
+    const uint8_t *source_p;
+
+    if (!scanner_cache_read (reader_p, &info, sizeof (scanner_cache_info_t)))
+    {
+      return false;
+    }
+
+    if (info.type == SCANNER_TYPE_END)
+    {
+      return reader_p->data_p == reader_p->data_end_p;
+    }
+
+    /* Only the end of arguments marker has no source position. */
+    if (info.type > SCANNER_TYPE_EXPORT_MODULE_SPECIFIER
+        || !scanner_cache_decode_position (context_p, info.source_position, &source_p)
+        || (source_p == NULL) != (info.type == SCANNER_TYPE_END_ARGUMENTS))
+    {
+      return false;
+    }
+
+    if (source_p != NULL)
+    {
+      /* The parser consumes the list in source order, and a position has at most one info. */
+      uint32_t *last_position_p = last_position + (info.source_position & 0x1);
+
+      if (*last_position_p != SCANNER_CACHE_NULL_POSITION && info.source_position <= *last_position_p)
+      {
+        return false;
+      }
+
+      *last_position_p = info.source_position;
+    }
+
+    size_t size = sizeof (scanner_info_t);
+    size_t stream_size = 0;
+
+    switch (info.type)
+    {
+      case SCANNER_TYPE_FUNCTION:
+      case SCANNER_TYPE_BLOCK:
+      {
+        stream_size = scanner_cache_get_stream_size (reader_p);
+
+        if (stream_size == 0)
+        {
+          return false;
+        }
+
+        size += stream_size;
+        break;
+      }
+      case SCANNER_TYPE_WHILE:
+      case SCANNER_TYPE_FOR_IN:
+      case SCANNER_TYPE_FOR_OF:
+      case SCANNER_TYPE_CASE:
+      case SCANNER_TYPE_INITIALIZER:
+      case SCANNER_TYPE_CLASS_FIELD_INITIALIZER_END:
+      case SCANNER_TYPE_CLASS_STATIC_BLOCK_END:
+      {
+        size = sizeof (scanner_location_info_t);
+        break;
+      }
+      case SCANNER_TYPE_FOR:
+      {
+        size = sizeof (scanner_for_info_t);
+        break;
+      }
+      case SCANNER_TYPE_SWITCH:
+      {
+        size = sizeof (scanner_switch_info_t);
+        break;
+      }
+      case SCANNER_TYPE_CLASS_CONSTRUCTOR:
+      {
+        size = sizeof (scanner_class_info_t);
+        break;
+      }
+    }
+
+    scanner_info_t *info_p = (scanner_info_t *) jmem_heap_alloc_block_null_on_error (size);
+
+    if (info_p == NULL)
+    {
+      return false;
+    }
+
+    info_p->next_p = end_info_p;
+    info_p->source_p = source_p;
+    info_p->type = info.type;
+    info_p->u8_arg = info.u8_arg;
+    info_p->u16_arg = info.u16_arg;
+
+    switch (info.type)
+    {
+      case SCANNER_TYPE_SWITCH:
+      {
+        ((scanner_switch_info_t *) info_p)->case_p = NULL;
+        break;
+      }
+      case SCANNER_TYPE_CLASS_CONSTRUCTOR:
+      {
+        ((scanner_class_info_t *) info_p)->members = NULL;
+        break;
+      }
+      case SCANNER_TYPE_FUNCTION:
+      case SCANNER_TYPE_BLOCK:
+      {
+        /* The stream must be valid before the info is released by scanner_cleanup. */
+        memcpy (info_p + 1, reader_p->data_p, stream_size);
+        reader_p->data_p += stream_size;
+        break;
+      }
+    }
+
+    *next_p_p = info_p;
+    next_p_p = &info_p->next_p;
+
+    switch (info.type)
+    {
+      case SCANNER_TYPE_FUNCTION:
+      case SCANNER_TYPE_BLOCK:
+      {
+        if (!scanner_cache_decode_stream (context_p, info_p))
+        {
+          return false;
+        }
+        break;
+      }
+      case SCANNER_TYPE_WHILE:
+      case SCANNER_TYPE_FOR_IN:
+      case SCANNER_TYPE_FOR_OF:
+      case SCANNER_TYPE_CASE:
+      case SCANNER_TYPE_INITIALIZER:
+      case SCANNER_TYPE_CLASS_FIELD_INITIALIZER_END:
+      case SCANNER_TYPE_CLASS_STATIC_BLOCK_END:
+      {
+        if (!scanner_cache_read_location (context_p, reader_p, &((scanner_location_info_t *) info_p)->location))
+        {
+          return false;
+        }
+        break;
+      }
+      case SCANNER_TYPE_FOR:
+      {
+        scanner_for_info_t *for_info_p = (scanner_for_info_t *) info_p;
+
+        if (!scanner_cache_read_location (context_p, reader_p, &for_info_p->expression_location)
+            || !scanner_cache_read_location (context_p, reader_p, &for_info_p->end_location))
+        {
+          return false;
+        }
+        break;
+      }
+      case SCANNER_TYPE_SWITCH:
+      {
+        uint32_t count;
+        scanner_case_info_t **case_p_p = &((scanner_switch_info_t *) info_p)->case_p;
+
+        if (!scanner_cache_read (reader_p, &count, sizeof (uint32_t)))
+        {
+          return false;
+        }
+
+        while (count > 0)
+        {
+          scanner_case_info_t *case_p;
+          case_p = (scanner_case_info_t *) jmem_heap_alloc_block_null_on_error (sizeof (scanner_case_info_t));
+
+          if (case_p == NULL)
+          {
+            return false;
+          }
+
+          case_p->next_p = NULL;
+          *case_p_p = case_p;
+          case_p_p = &case_p->next_p;
+
+          if (!scanner_cache_read_location (context_p, reader_p, &case_p->location))
+          {
+            return false;
+          }
+
+          count--;
+        }
+        break;
+      }
+      case SCANNER_TYPE_CLASS_CONSTRUCTOR:
+      {
+        uint32_t count;
+        scanner_class_private_member_t **member_p_p = &((scanner_class_info_t *) info_p)->members;
+
+        if (!scanner_cache_read (reader_p, &count, sizeof (uint32_t)))
+        {
+          return false;
+        }
+
+        while (count > 0)
+        {
+          uint32_t data[2];
+          uint8_t flags[4];
+
+          if (!scanner_cache_read (reader_p, data, sizeof (data))
+              || !scanner_cache_read (reader_p, flags, sizeof (flags)) || data[1] > PARSER_MAXIMUM_IDENT_LENGTH)
+          {
+            return false;
+          }
+
+          scanner_class_private_member_t *member_p;
+          member_p = (scanner_class_private_member_t *) jmem_heap_alloc_block_null_on_error (
+            sizeof (scanner_class_private_member_t));
+
+          if (member_p == NULL)
+          {
+            return false;
+          }
+
+          member_p->prev_p = NULL;
+          *member_p_p = member_p;
+          member_p_p = &member_p->prev_p;
+
+          member_p->loc.length = (prop_length_t) data[1];
+          member_p->loc.type = flags[0];
+          member_p->loc.status_flags = flags[1];
+          member_p->u8_arg = flags[2];
+
+          if (!scanner_cache_decode_position (context_p, data[0], &member_p->loc.char_p))
+          {
+            return false;
+          }
+
+          count--;
+        }
+        break;
+      }
+    }
+  }
+} /* scanner_cache_read_info_list */
+
+/**
+ * Rebuild the scanner info list of the currently parsed source code
+ * from the data provided by the load callback of the embedding application.
+ *
+ * @return true - if the scanner info list is rebuilt, false - if the source code needs to be scanned
+ */
+bool
+scanner_cache_load (parser_context_t *context_p, /**< context */
+                    const scanner_cache_key_t *key_p) /**< key of the source code */
+{
+  jerry_parse_cache_load_cb_t load_callback_p = JERRY_CONTEXT (parse_cache_load_callback_p);
+
+  if (load_callback_p == NULL)
+  {
+    return false;
+  }
+
+  size_t size = 0;
+  const uint8_t *data_p = load_callback_p (key_p->hash, &size, JERRY_CONTEXT (parse_cache_user_p));
+  scanner_cache_header_t header;
+
+  if (data_p == NULL || size < sizeof (scanner_cache_header_t))
+  {
+    return false;
+  }
+
+  memcpy (&header, data_p, sizeof (scanner_cache_header_t));
+
+  if (memcmp (&header.key, key_p, sizeof (scanner_cache_key_t)) != 0)
+  {
+    return false;
+  }
+
+  /* The scanner info cannot be fully verified without scanning the source code,
+   * so data which is damaged after it was stored is detected by its checksum. */
+  const uint8_t *payload_p = data_p + sizeof (scanner_cache_header_t);
+  size_t payload_size = size - sizeof (scanner_cache_header_t);
+
+  if ((lit_utf8_size_t) payload_size != payload_size
+      || header.checksum != scanner_cache_get_checksum (header.global_status_flags, payload_p, payload_size))
+  {
+    return false;
+  }
+
+  scanner_info_t *end_info_p = context_p->next_scanner_info_p;
+  scanner_cache_reader_t reader;
+
+  JERRY_ASSERT (end_info_p->type == SCANNER_TYPE_END && end_info_p->next_p == NULL);
+
+  reader.data_p = payload_p;
+  reader.data_end_p = data_p + size;
+
+  if (!scanner_cache_read_info_list (context_p, &reader))
+  {
+    scanner_cleanup (context_p);
+    context_p->next_scanner_info_p = end_info_p;
+    return false;
+  }
+
+  context_p->global_status_flags |= header.global_status_flags & SCANNER_CACHE_GLOBAL_STATUS_FLAGS;
+
+#ifndef JERRY_NDEBUG
+  /* Only the data of successfully parsed source codes is stored. */
+  context_p->status_flags |= PARSER_SCANNING_SUCCESSFUL;
+#endif /* !JERRY_NDEBUG */
+  return true;
+} /* scanner_cache_load */
+
 /**
  * Checks whether a context needs to be created for a block.
  *
@@ -1534,7 +1534,7 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
       }
 
       scanner_case_info_t *case_info_p;
-      case_info_p = (scanner_case_info_t *) scanner_malloc (context_p, sizeof (scanner_case_info_t));
+      case_info_p = (scanner_case_info_t *) scanner_malloc_info (context_p, sizeof (scanner_case_info_t));
 
       *(scanner_context_p->active_switch_statement.last_case_p) = case_info_p;
       scanner_context_p->active_switch_statement.last_case_p = &case_info_p->next_p;
@@ -3059,7 +3059,8 @@ scanner_scan_all (parser_context_t *context_p) /**< context */
           if (context_p->token.type == LEXER_EOS && stack_top == SCAN_STACK_SCRIPT_FUNCTION)
           {
             /* End of argument parsing. */
-            scanner_info_t *scanner_info_p = (scanner_info_t *) scanner_malloc (context_p, sizeof (scanner_info_t));
+            scanner_info_t *scanner_info_p =
+              (scanner_info_t *) scanner_malloc_info (context_p, sizeof (scanner_info_t));
             scanner_info_p->next_p = context_p->next_scanner_info_p;
             scanner_info_p->source_p = NULL;
             scanner_info_p->type = SCANNER_TYPE_END_ARGUMENTS;
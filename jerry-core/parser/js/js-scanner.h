@@ -282,6 +282,49 @@ typedef enum
   SCANNER_LITERAL_OBJECT_HAS_REST = (1 << 3), /**< the object literal has a member prefixed with three dots */
 } scanner_literal_flags_t;
 
+/**
+ * Version of the serialized scanner info format. It must be
+ * updated when the scanner info blocks or streams are changed.
+ */
+#define SCANNER_CACHE_VERSION 2u
+
+/**
+ * Key of the serialized scanner info list of a source code.
+ */
+typedef struct
+{
+  uint32_t version; /**< format version combined with the engine version */
+  uint32_t build_flags; /**< build options and structure sizes which affect the serialized data */
+  uint32_t hash; /**< hash of the source code, the function arguments and the members below */
+  uint32_t source_size; /**< size of the source code */
+  uint32_t arguments_size; /**< size of the function arguments */
+  uint32_t status_flags; /**< parser status flags before scanning */
+  uint32_t parse_options; /**< ecma_parse_opts_t option bits which affect scanning */
+  parser_line_counter_t start_line; /**< line of the first character */
+  parser_line_counter_t start_column; /**< column of the first character */
+} scanner_cache_key_t;
+
+/**
+ * Header of the serialized scanner info list.
+ */
+typedef struct
+{
+  scanner_cache_key_t key; /**< key of the source code */
+  uint32_t global_status_flags; /**< global status flags set by the scanner */
+  uint32_t checksum; /**< hash of the data which follows the header */
+} scanner_cache_header_t;
+
+/**
+ * Header of a serialized scanner info block.
+ */
+typedef struct
+{
+  uint32_t source_position; /**< encoded triggering position (see scanner_cache_encode_position) */
+  uint8_t type; /**< type of the scanner info */
+  uint8_t u8_arg; /**< custom 8-bit value */
+  uint16_t u16_arg; /**< custom 16-bit value */
+} scanner_cache_info_t;
+
 /**
  * Option bits for scanner_create_variables function.
  */
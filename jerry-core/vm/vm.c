@@ -203,6 +203,26 @@ vm_op_set_value (ecma_value_t base, /**< base object */
   {
     object_p = ecma_get_object_from_value (base);
 
+    if (ecma_is_value_integer_number (property) && ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_ARRAY)
+    {
+      ecma_integer_value_t int_value = ecma_get_integer_from_value (property);
+      ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+      if (JERRY_LIKELY (ecma_op_array_is_fast_array (ext_object_p) && int_value >= 0
+                        && (uint32_t) int_value < ext_object_p->u.array.length))
+      {
+        ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_value_t, object_p->u1.property_list_cp);
+
+        /* Existing elements of fast arrays are writable data properties. */
+        if (JERRY_LIKELY (!ecma_is_value_array_hole (values_p[int_value])))
+        {
+          ecma_value_assign_value (values_p + int_value, value);
+          ecma_deref_object (object_p);
+          return ECMA_VALUE_TRUE;
+        }
+      }
+    }
+
     if (JERRY_UNLIKELY (!ecma_is_value_prop_name (property)))
     {
       property_p = ecma_op_to_string (property);
@@ -3352,6 +3372,30 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         case VM_OC_PLUS:
         case VM_OC_MINUS:
         {
+          if (ecma_is_value_float_number (left_value))
+          {
+            if (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_PLUS)
+            {
+              *stack_top_p++ = left_value;
+              continue;
+            }
+
+            *stack_top_p++ = ecma_update_float_number (left_value, -ecma_get_float_from_value (left_value));
+            continue;
+          }
+
+          if (ecma_is_value_integer_number (left_value))
+          {
+            if (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_MINUS)
+            {
+              /* Negative zero is not an integer value. */
+              left_value = ecma_make_number_value (-(ecma_number_t) ecma_get_integer_from_value (left_value));
+            }
+
+            *stack_top_p++ = left_value;
+            continue;
+          }
+
           result = opfunc_unary_operation (left_value, VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_PLUS);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -3544,6 +3588,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               continue;
             }
 
+            /* The product of two integer values always fits into 64 bits. */
+            int64_t int_multiply = (int64_t) left_integer * (int64_t) right_integer;
+
+            /* Zero is represented as an integer only when it is not negative zero. */
+            if (ECMA_IS_INTEGER_NUMBER (int_multiply) && (int_multiply != 0 || (left_integer | right_integer) >= 0))
+            {
+              *stack_top_p++ = ecma_make_integer_value ((ecma_integer_value_t) int_multiply);
+              continue;
+            }
+
             ecma_number_t multiply = (ecma_number_t) left_integer * (ecma_number_t) right_integer;
             *stack_top_p++ = ecma_make_number_value (multiply);
             continue;
@@ -3582,6 +3636,43 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+            /* Exact divisions which do not produce negative zero have an integer result. */
+            if (right_integer != 0 && left_integer % right_integer == 0 && (left_integer != 0 || right_integer > 0))
+            {
+              *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer / right_integer));
+              continue;
+            }
+
+            ecma_number_t left_number = (ecma_number_t) left_integer;
+            ecma_number_t right_number = (ecma_number_t) right_integer;
+            *stack_top_p++ = ecma_make_number_value (left_number / right_number);
+            continue;
+          }
+
+          if (ecma_is_value_float_number (left_value) && ecma_is_value_number (right_value))
+          {
+            ecma_number_t new_value =
+              (ecma_get_float_from_value (left_value) / ecma_get_number_from_value (right_value));
+
+            *stack_top_p++ = ecma_update_float_number (left_value, new_value);
+            ecma_free_number (right_value);
+            continue;
+          }
+
+          if (ecma_is_value_float_number (right_value) && ecma_is_value_integer_number (left_value))
+          {
+            ecma_number_t new_value =
+              ((ecma_number_t) ecma_get_integer_from_value (left_value) / ecma_get_float_from_value (right_value));
+
+            *stack_top_p++ = ecma_update_float_number (right_value, new_value);
+            continue;
+          }
+
           result = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION, left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -23,6 +23,14 @@
 
 #include "arguments/cli.h"
 
+#ifndef JERRY_SNAPSHOT_THREADS
+#define JERRY_SNAPSHOT_THREADS 0
+#endif /* !defined (JERRY_SNAPSHOT_THREADS) */
+
+#if JERRY_SNAPSHOT_THREADS
+#include <pthread.h>
+#endif /* JERRY_SNAPSHOT_THREADS */
+
 /**
  * Maximum size for loaded snapshots
  */
@@ -46,6 +54,60 @@ static const char *output_file_name_p = "js.snapshot";
 static jerry_length_t magic_string_lengths[JERRY_LITERAL_LENGTH];
 static const jerry_char_t *magic_string_items[JERRY_LITERAL_LENGTH];
 
+#if JERRY_SNAPSHOT_THREADS
+
+/**
+ * Context of the current thread.
+ *
+ * Note:
+ *      the batch command runs an engine instance on each worker thread,
+ *      so the context pointer of the default port cannot be used
+ */
+static __thread jerry_context_t *current_context_p = NULL;
+
+/**
+ * Allocate a context for the current thread.
+ *
+ * @return total size of the allocated buffer
+ */
+size_t
+jerry_port_context_alloc (size_t context_size) /**< size of the context */
+{
+  size_t total_size = context_size + JERRY_GLOBAL_HEAP_SIZE * 1024;
+  current_context_p = malloc (total_size);
+
+  if (current_context_p == NULL)
+  {
+    jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot allocate engine context\n");
+    jerry_port_fatal (JERRY_FATAL_OUT_OF_MEMORY);
+  }
+
+  return total_size;
+} /* jerry_port_context_alloc */
+
+/**
+ * Get the context of the current thread.
+ *
+ * @return context pointer
+ */
+jerry_context_t *
+jerry_port_context_get (void)
+{
+  return current_context_p;
+} /* jerry_port_context_get */
+
+/**
+ * Free the context of the current thread.
+ */
+void
+jerry_port_context_free (void)
+{
+  free (current_context_p);
+  current_context_p = NULL;
+} /* jerry_port_context_free */
+
+#endif /* JERRY_SNAPSHOT_THREADS */
+
 /**
  * Check whether JerryScript has a requested feature enabled or not. If not,
  * print a warning message.
@@ -163,6 +225,7 @@ typedef enum
 {
   OPT_GENERATE_HELP,
   OPT_GENERATE_STATIC,
+  OPT_GENERATE_OPTIMIZE_SIZE,
   OPT_GENERATE_SHOW_OP,
   OPT_GENERATE_FUNCTION,
   OPT_GENERATE_OUT,
@@ -175,6 +238,7 @@ typedef enum
 static const cli_opt_t generate_opts[] = {
   CLI_OPT_DEF (.id = OPT_GENERATE_HELP, .opt = "h", .longopt = "help", .help = "print this help and exit"),
   CLI_OPT_DEF (.id = OPT_GENERATE_STATIC, .opt = "s", .longopt = "static", .help = "generate static snapshot"),
+  CLI_OPT_DEF (.id = OPT_GENERATE_OPTIMIZE_SIZE, .longopt = "optimize-size", .help = "minimize the snapshot size"),
   CLI_OPT_DEF (.id = OPT_GENERATE_FUNCTION,
                .opt = "f",
                .longopt = "generate-function-snapshot",
@@ -229,6 +293,11 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
         snapshot_flags |= JERRY_SNAPSHOT_SAVE_STATIC;
         break;
       }
+      case OPT_GENERATE_OPTIMIZE_SIZE:
+      {
+        snapshot_flags |= JERRY_SNAPSHOT_SAVE_OPTIMIZE_SIZE;
+        break;
+      }
       case OPT_GENERATE_FUNCTION:
       {
         function_args_p = cli_consume_string (cli_state_p);
@@ -399,6 +468,372 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
   return JERRY_STANDALONE_EXIT_CODE_OK;
 } /* process_generate */
 
+/**
+ * Batch command line option IDs
+ */
+typedef enum
+{
+  OPT_BATCH_HELP,
+  OPT_BATCH_JOBS,
+  OPT_BATCH_OUT,
+} batch_opt_id_t;
+
+/**
+ * Batch command line options
+ */
+static const cli_opt_t batch_opts[] = {
+  CLI_OPT_DEF (.id = OPT_BATCH_HELP, .opt = "h", .longopt = "help", .help = "print this help and exit"),
+  CLI_OPT_DEF (.id = OPT_BATCH_JOBS,
+               .opt = "j",
+               .longopt = "jobs",
+               .meta = "NUM",
+               .help = "number of worker threads (default: 1)"),
+  CLI_OPT_DEF (.id = OPT_BATCH_OUT,
+               .opt = "o",
+               .meta = "FILE",
+               .help = "specify output file name (default: js.snapshot)"),
+  CLI_OPT_DEF (.id = CLI_OPT_DEFAULT, .meta = "FILE(S)", .help = "input source files")
+};
+
+/**
+ * Source file compiled by the batch command
+ */
+typedef struct
+{
+  const char *file_name_p; /**< file name */
+  uint8_t *source_p; /**< source code */
+  size_t source_size; /**< size of the source code */
+  uint32_t *snapshot_p; /**< generated snapshot (NULL on error) */
+  size_t snapshot_size; /**< size of the generated snapshot */
+} batch_source_t;
+
+/**
+ * Work item of a batch worker
+ */
+typedef struct
+{
+  batch_source_t *sources_p; /**< all source files */
+  uint32_t number_of_sources; /**< number of source files */
+  uint32_t first_index; /**< index of the first source compiled by the worker */
+  uint32_t index_step; /**< distance between the sources compiled by the worker */
+} batch_worker_t;
+
+/**
+ * Generate the snapshot of a single source file in a new engine instance.
+ */
+static void
+batch_generate_snapshot (batch_source_t *source_p, /**< source file */
+                         uint32_t *snapshot_buffer_p) /**< temporary snapshot buffer */
+{
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_validate_string (source_p->source_p, (jerry_size_t) source_p->source_size, JERRY_ENCODING_UTF8))
+  {
+    jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: Input must be a valid UTF-8 string: %s\n", source_p->file_name_p);
+    jerry_cleanup ();
+    return;
+  }
+
+  jerry_parse_options_t parse_options;
+  parse_options.options = JERRY_PARSE_HAS_SOURCE_NAME;
+  parse_options.source_name = jerry_string ((const jerry_char_t *) source_p->file_name_p,
+                                            (jerry_size_t) strlen (source_p->file_name_p),
+                                            JERRY_ENCODING_UTF8);
+
+  jerry_value_t snapshot_result = jerry_parse (source_p->source_p, source_p->source_size, &parse_options);
+
+  if (!jerry_value_is_exception (snapshot_result))
+  {
+    jerry_value_t parse_result = snapshot_result;
+    snapshot_result = jerry_generate_snapshot (parse_result, 0, snapshot_buffer_p, JERRY_BUFFER_SIZE / 4);
+    jerry_value_free (parse_result);
+  }
+
+  jerry_value_free (parse_options.source_name);
+
+  if (jerry_value_is_exception (snapshot_result))
+  {
+    jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: Generating snapshot failed: %s\n", source_p->file_name_p);
+
+    snapshot_result = jerry_exception_value (snapshot_result, true);
+    print_unhandled_exception (snapshot_result);
+  }
+  else
+  {
+    size_t snapshot_size = (size_t) jerry_value_as_number (snapshot_result);
+    source_p->snapshot_p = malloc (snapshot_size);
+
+    if (source_p->snapshot_p != NULL)
+    {
+      memcpy (source_p->snapshot_p, snapshot_buffer_p, snapshot_size);
+      source_p->snapshot_size = snapshot_size;
+    }
+    else
+    {
+      jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot allocate snapshot: %s\n", source_p->file_name_p);
+    }
+  }
+
+  jerry_value_free (snapshot_result);
+  jerry_cleanup ();
+} /* batch_generate_snapshot */
+
+/**
+ * Generate the snapshots of the source files assigned to a worker.
+ *
+ * @return NULL
+ */
+static void *
+batch_run_worker (void *worker_p) /**< batch_worker_t */
+{
+  batch_worker_t *batch_worker_p = (batch_worker_t *) worker_p;
+  uint32_t *snapshot_buffer_p = malloc (JERRY_BUFFER_SIZE);
+
+  if (snapshot_buffer_p == NULL)
+  {
+    jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot allocate snapshot buffer\n");
+    return NULL;
+  }
+
+  for (uint32_t i = batch_worker_p->first_index; i < batch_worker_p->number_of_sources; i += batch_worker_p->index_step)
+  {
+    batch_generate_snapshot (batch_worker_p->sources_p + i, snapshot_buffer_p);
+  }
+
+  free (snapshot_buffer_p);
+  return NULL;
+} /* batch_run_worker */
+
+/**
+ * Free the sources and the generated snapshots of the batch command.
+ */
+static void
+batch_free_sources (batch_source_t *sources_p, /**< source files */
+                    uint32_t number_of_sources) /**< number of source files */
+{
+  for (uint32_t i = 0; i < number_of_sources; i++)
+  {
+    free (sources_p[i].source_p);
+    free (sources_p[i].snapshot_p);
+  }
+} /* batch_free_sources */
+
+/**
+ * Process 'batch' command.
+ *
+ * @return error code (0 - no error)
+ */
+static int
+process_batch (cli_state_t *cli_state_p, /**< cli state */
+               int argc, /**< number of arguments */
+               char *prog_name_p) /**< program name */
+{
+  int number_of_jobs = 1;
+
+  cli_change_opts (cli_state_p, batch_opts);
+
+  JERRY_VLA (batch_source_t, sources, argc);
+  uint32_t number_of_sources = 0;
+
+  for (int id = cli_consume_option (cli_state_p); id != CLI_OPT_END; id = cli_consume_option (cli_state_p))
+  {
+    switch (id)
+    {
+      case OPT_BATCH_HELP:
+      {
+        cli_help (prog_name_p, "batch", batch_opts);
+        return JERRY_STANDALONE_EXIT_CODE_OK;
+      }
+      case OPT_BATCH_JOBS:
+      {
+        number_of_jobs = cli_consume_int (cli_state_p);
+
+        if (cli_state_p->error == NULL && number_of_jobs < 1)
+        {
+          cli_state_p->error = "Number of jobs must be positive:";
+        }
+        break;
+      }
+      case OPT_BATCH_OUT:
+      {
+        output_file_name_p = cli_consume_string (cli_state_p);
+        break;
+      }
+      case CLI_OPT_DEFAULT:
+      {
+        const char *file_name_p = cli_consume_string (cli_state_p);
+
+        if (cli_state_p->error == NULL)
+        {
+          /* Each source is copied out of the input buffer, so their total size is not limited by it. */
+          size_t size = read_file (input_buffer, file_name_p);
+          uint8_t *source_p = (size > 0) ? malloc (size) : NULL;
+
+          if (source_p == NULL)
+          {
+            if (size > 0)
+            {
+              jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot allocate source: %s\n", file_name_p);
+            }
+
+            batch_free_sources (sources, number_of_sources);
+            return JERRY_STANDALONE_EXIT_CODE_FAIL;
+          }
+
+          memcpy (source_p, input_buffer, size);
+
+          sources[number_of_sources].file_name_p = file_name_p;
+          sources[number_of_sources].source_p = source_p;
+          sources[number_of_sources].source_size = size;
+          sources[number_of_sources].snapshot_p = NULL;
+          sources[number_of_sources].snapshot_size = 0;
+          number_of_sources++;
+        }
+        break;
+      }
+      default:
+      {
+        cli_state_p->error = "Internal error";
+        break;
+      }
+    }
+  }
+
+  if (check_cli_error (cli_state_p))
+  {
+    batch_free_sources (sources, number_of_sources);
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  if (number_of_sources < 1)
+  {
+    jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: at least one input file must be specified.\n");
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  if ((uint32_t) number_of_jobs > number_of_sources)
+  {
+    number_of_jobs = (int) number_of_sources;
+  }
+
+#if JERRY_SNAPSHOT_THREADS
+  JERRY_VLA (pthread_t, threads, number_of_jobs);
+#else /* !JERRY_SNAPSHOT_THREADS */
+  if (number_of_jobs > 1)
+  {
+    jerry_log (JERRY_LOG_LEVEL_WARNING, "Ignoring '--jobs' option because threads require an external context!\n");
+    number_of_jobs = 1;
+  }
+#endif /* JERRY_SNAPSHOT_THREADS */
+
+  JERRY_VLA (batch_worker_t, workers, number_of_jobs);
+
+  for (int i = 0; i < number_of_jobs; i++)
+  {
+    workers[i].sources_p = sources;
+    workers[i].number_of_sources = number_of_sources;
+    workers[i].first_index = (uint32_t) i;
+    workers[i].index_step = (uint32_t) number_of_jobs;
+  }
+
+  /* The first worker runs on the main thread. */
+  int number_of_threads = 1;
+
+#if JERRY_SNAPSHOT_THREADS
+  while (number_of_threads < number_of_jobs)
+  {
+    if (pthread_create (threads + number_of_threads, NULL, batch_run_worker, workers + number_of_threads) != 0)
+    {
+      jerry_log (JERRY_LOG_LEVEL_ERROR,
+                 "Error: cannot create worker thread, %d jobs are run on the main thread\n",
+                 number_of_jobs - number_of_threads);
+      break;
+    }
+
+    number_of_threads++;
+  }
+#endif /* JERRY_SNAPSHOT_THREADS */
+
+  batch_run_worker (workers);
+
+  /* The sources are merged in their original order, so the output does not depend on the threads. */
+  for (int i = number_of_threads; i < number_of_jobs; i++)
+  {
+    batch_run_worker (workers + i);
+  }
+
+#if JERRY_SNAPSHOT_THREADS
+  for (int i = 1; i < number_of_threads; i++)
+  {
+    pthread_join (threads[i], NULL);
+  }
+#endif /* JERRY_SNAPSHOT_THREADS */
+
+  int result = JERRY_STANDALONE_EXIT_CODE_OK;
+  size_t snapshot_size = 0;
+  JERRY_VLA (const uint32_t *, snapshot_buffers, number_of_sources);
+  JERRY_VLA (size_t, snapshot_buffer_sizes, number_of_sources);
+
+  for (uint32_t i = 0; i < number_of_sources; i++)
+  {
+    if (sources[i].snapshot_p == NULL)
+    {
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+
+    snapshot_buffers[i] = sources[i].snapshot_p;
+    snapshot_buffer_sizes[i] = sources[i].snapshot_size;
+  }
+
+  if (result == JERRY_STANDALONE_EXIT_CODE_OK && number_of_sources == 1)
+  {
+    snapshot_size = sources[0].snapshot_size;
+    memcpy (output_buffer, sources[0].snapshot_p, snapshot_size);
+  }
+  else if (result == JERRY_STANDALONE_EXIT_CODE_OK)
+  {
+    jerry_init (JERRY_INIT_EMPTY);
+
+    const char *error_p = NULL;
+    snapshot_size = jerry_merge_snapshots (snapshot_buffers,
+                                           snapshot_buffer_sizes,
+                                           number_of_sources,
+                                           output_buffer,
+                                           JERRY_BUFFER_SIZE,
+                                           &error_p);
+
+    if (snapshot_size == 0)
+    {
+      jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: %s\n", error_p);
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+
+    jerry_cleanup ();
+  }
+
+  batch_free_sources (sources, number_of_sources);
+
+  if (result != JERRY_STANDALONE_EXIT_CODE_OK)
+  {
+    return result;
+  }
+
+  FILE *file_p = fopen (output_file_name_p, "wb");
+
+  if (file_p == NULL)
+  {
+    jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot open file: '%s'\n", output_file_name_p);
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  fwrite (output_buffer, 1u, snapshot_size, file_p);
+  fclose (file_p);
+
+  printf ("Created snapshot file: '%s' (%zu bytes)\n", output_file_name_p, snapshot_size);
+
+  return JERRY_STANDALONE_EXIT_CODE_OK;
+} /* process_batch */
+
 /**
  * Literal dump command line option IDs
  */
@@ -515,10 +950,6 @@ process_literal_dump (cli_state_t *cli_state_p, /**< cli state */
     return JERRY_STANDALONE_EXIT_CODE_FAIL;
   }
 
-#if defined(JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1)
-  context_init ();
-#endif /* defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1) */
-
   jerry_init (JERRY_INIT_EMPTY);
 
   size_t lit_buf_sz = 0;
@@ -679,10 +1110,6 @@ process_merge (cli_state_t *cli_state_p, /**< cli state */
     return JERRY_STANDALONE_EXIT_CODE_FAIL;
   }
 
-#if defined(JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1)
-  context_init ();
-#endif /* defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1) */
-
   jerry_init (JERRY_INIT_EMPTY);
 
   const char *error_p = NULL;
@@ -720,6 +1147,274 @@ process_merge (cli_state_t *cli_state_p, /**< cli state */
   return JERRY_STANDALONE_EXIT_CODE_OK;
 } /* process_merge */
 
+/**
+ * Stats command line option IDs
+ */
+typedef enum
+{
+  OPT_STATS_HELP,
+  OPT_STATS_FUNCTIONS,
+  OPT_STATS_OPCODES,
+} stats_opt_id_t;
+
+/**
+ * Stats command line options
+ */
+static const cli_opt_t stats_opts[] = {
+  CLI_OPT_DEF (.id = OPT_STATS_HELP, .opt = "h", .longopt = "help", .help = "print this help and exit"),
+  CLI_OPT_DEF (.id = OPT_STATS_FUNCTIONS, .longopt = "functions", .help = "print the statistics of each function"),
+  CLI_OPT_DEF (.id = OPT_STATS_OPCODES, .longopt = "opcodes", .help = "print the opcode histogram"),
+  CLI_OPT_DEF (.id = CLI_OPT_DEFAULT, .meta = "FILE(S)", .help = "input source files")
+};
+
+/**
+ * Maximum number of different opcodes
+ */
+#define JERRY_STATS_MAX_OPCODES (512)
+
+/**
+ * Opcode histogram entry
+ */
+typedef struct
+{
+  const char *name_p; /**< opcode name */
+  uint32_t count; /**< number of occurrences */
+  uint32_t size; /**< total size of the instructions */
+} stats_opcode_t;
+
+static stats_opcode_t stats_opcodes[JERRY_STATS_MAX_OPCODES];
+static uint32_t stats_opcode_count;
+
+/**
+ * Print the statistics of a function.
+ */
+static void
+stats_print_function (const jerry_function_stats_t *stats_p, /**< function stats */
+                      void *user_p) /**< unused */
+{
+  (void) user_p;
+
+  printf ("  %*s%u:%u  size: %u  instructions: %u (%u bytes)  arguments: %u  registers: %u  stack: %u"
+          "  identifiers: %u  literals: %u  functions: %u\n",
+          (int) (stats_p->depth * 2),
+          "",
+          (unsigned int) stats_p->line,
+          (unsigned int) stats_p->column,
+          (unsigned int) stats_p->byte_code_size,
+          (unsigned int) stats_p->instruction_count,
+          (unsigned int) stats_p->instruction_size,
+          (unsigned int) stats_p->argument_count,
+          (unsigned int) stats_p->register_count,
+          (unsigned int) stats_p->stack_limit,
+          (unsigned int) stats_p->identifier_count,
+          (unsigned int) stats_p->literal_count,
+          (unsigned int) stats_p->function_count);
+} /* stats_print_function */
+
+/**
+ * Store an opcode histogram entry.
+ */
+static void
+stats_store_opcode (const char *opcode_name_p, /**< opcode name */
+                    uint32_t count, /**< number of occurrences */
+                    uint32_t size, /**< total size of the instructions */
+                    void *user_p) /**< unused */
+{
+  (void) user_p;
+
+  if (stats_opcode_count < JERRY_STATS_MAX_OPCODES)
+  {
+    stats_opcodes[stats_opcode_count].name_p = opcode_name_p;
+    stats_opcodes[stats_opcode_count].count = count;
+    stats_opcodes[stats_opcode_count].size = size;
+    stats_opcode_count++;
+  }
+} /* stats_store_opcode */
+
+/**
+ * Compare opcode histogram entries: more frequent opcodes are ordered first.
+ *
+ * @return negative, zero, or positive value
+ */
+static int
+stats_compare_opcodes (const void *left_p, /**< left entry */
+                       const void *right_p) /**< right entry */
+{
+  const stats_opcode_t *left_opcode_p = (const stats_opcode_t *) left_p;
+  const stats_opcode_t *right_opcode_p = (const stats_opcode_t *) right_p;
+
+  if (left_opcode_p->count != right_opcode_p->count)
+  {
+    return (left_opcode_p->count > right_opcode_p->count) ? -1 : 1;
+  }
+
+  return strcmp (left_opcode_p->name_p, right_opcode_p->name_p);
+} /* stats_compare_opcodes */
+
+/**
+ * Process 'stats' command.
+ *
+ * @return error code (0 - no error)
+ */
+static int
+process_stats (cli_state_t *cli_state_p, /**< cli state */
+               int argc, /**< number of arguments */
+               char *prog_name_p) /**< program name */
+{
+  cli_change_opts (cli_state_p, stats_opts);
+
+  JERRY_VLA (const char *, file_names, argc);
+  uint32_t number_of_files = 0;
+  bool print_functions = false;
+  bool print_opcodes = false;
+
+  for (int id = cli_consume_option (cli_state_p); id != CLI_OPT_END; id = cli_consume_option (cli_state_p))
+  {
+    switch (id)
+    {
+      case OPT_STATS_HELP:
+      {
+        cli_help (prog_name_p, "stats", stats_opts);
+        return JERRY_STANDALONE_EXIT_CODE_OK;
+      }
+      case OPT_STATS_FUNCTIONS:
+      {
+        print_functions = true;
+        break;
+      }
+      case OPT_STATS_OPCODES:
+      {
+        print_opcodes = true;
+        break;
+      }
+      case CLI_OPT_DEFAULT:
+      {
+        const char *file_name_p = cli_consume_string (cli_state_p);
+
+        if (cli_state_p->error == NULL)
+        {
+          file_names[number_of_files++] = file_name_p;
+        }
+        break;
+      }
+      default:
+      {
+        cli_state_p->error = "Internal error";
+        break;
+      }
+    }
+  }
+
+  if (check_cli_error (cli_state_p))
+  {
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  if (number_of_files < 1)
+  {
+    jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: at least one input file must be specified.\n");
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_feature_enabled (JERRY_FEATURE_PARSER_STATS))
+  {
+    jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: parser statistics are disabled in this build.\n");
+    jerry_cleanup ();
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  int result = JERRY_STANDALONE_EXIT_CODE_OK;
+
+  for (uint32_t i = 0; i < number_of_files; i++)
+  {
+    size_t source_size = read_file (input_buffer, file_names[i]);
+
+    if (source_size == 0)
+    {
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+      break;
+    }
+
+    if (!jerry_validate_string (input_buffer, (jerry_size_t) source_size, JERRY_ENCODING_UTF8))
+    {
+      jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: Input must be a valid UTF-8 string.\n");
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+      break;
+    }
+
+    jerry_parse_options_t parse_options;
+    parse_options.options = JERRY_PARSE_HAS_SOURCE_NAME;
+    parse_options.source_name =
+      jerry_string ((const jerry_char_t *) file_names[i], (jerry_size_t) strlen (file_names[i]), JERRY_ENCODING_UTF8);
+
+    jerry_parse_stats_t parse_stats_before;
+    jerry_parse_stats_t parse_stats_after;
+
+    jerry_parse_stats (&parse_stats_before);
+    jerry_value_t parse_result = jerry_parse (input_buffer, source_size, &parse_options);
+    jerry_parse_stats (&parse_stats_after);
+
+    jerry_value_free (parse_options.source_name);
+
+    if (jerry_value_is_exception (parse_result))
+    {
+      jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: Parsing '%s' failed!\n", file_names[i]);
+      print_unhandled_exception (jerry_exception_value (parse_result, true));
+      result = JERRY_STANDALONE_EXIT_CODE_FAIL;
+      break;
+    }
+
+    printf ("Statistics of '%s':\n", file_names[i]);
+
+    if (print_functions)
+    {
+      printf ("Functions (line:column):\n");
+    }
+
+    jerry_byte_code_stats_t stats;
+    stats_opcode_count = 0;
+
+    jerry_byte_code_stats (parse_result,
+                           &stats,
+                           print_functions ? stats_print_function : NULL,
+                           print_opcodes ? stats_store_opcode : NULL,
+                           NULL);
+    jerry_value_free (parse_result);
+
+    printf ("  Scanner time: %.3f ms\n", parse_stats_after.scanner_time - parse_stats_before.scanner_time);
+    printf ("  Parser time: %.3f ms\n", parse_stats_after.parser_time - parse_stats_before.parser_time);
+    printf ("  Functions: %u\n", (unsigned int) stats.function_count);
+    printf ("  Byte code size: %u bytes\n", (unsigned int) stats.byte_code_size);
+    printf ("  Instructions: %u (%u bytes)\n",
+            (unsigned int) stats.instruction_count,
+            (unsigned int) stats.instruction_size);
+    printf ("  Identifiers: %u\n", (unsigned int) stats.identifier_count);
+    printf ("  Literals: %u\n", (unsigned int) stats.literal_count);
+    printf ("  Maximum registers: %u\n", (unsigned int) stats.max_register_count);
+    printf ("  Maximum stack depth: %u\n", (unsigned int) stats.max_stack_limit);
+
+    if (print_opcodes)
+    {
+      qsort (stats_opcodes, stats_opcode_count, sizeof (stats_opcode_t), stats_compare_opcodes);
+
+      printf ("Opcodes (count, bytes, name):\n");
+
+      for (uint32_t j = 0; j < stats_opcode_count; j++)
+      {
+        printf ("  %8u %8u %s\n",
+                (unsigned int) stats_opcodes[j].count,
+                (unsigned int) stats_opcodes[j].size,
+                stats_opcodes[j].name_p);
+      }
+    }
+  }
+
+  jerry_cleanup ();
+  return result;
+} /* process_stats */
+
 /**
  * Command line option IDs
  */
@@ -746,8 +1441,10 @@ print_commands (char *prog_name_p) /**< program name */
 
   printf ("\nAvailable commands:\n"
           "  generate\n"
+          "  batch\n"
           "  litdump\n"
           "  merge\n"
+          "  stats\n"
           "\nPassing -h or --help after a command displays its help.\n");
 } /* print_commands */
 
@@ -792,6 +1489,14 @@ main (int argc, /**< number of arguments */
         {
           return process_generate (&cli_state, argc, argv[0]);
         }
+        else if (!strcmp ("batch", command_p))
+        {
+          return process_batch (&cli_state, argc, argv[0]);
+        }
+        else if (!strcmp ("stats", command_p))
+        {
+          return process_stats (&cli_state, argc, argv[0]);
+        }
 
         jerry_log (JERRY_LOG_LEVEL_ERROR, "Error: unknown command: %s\n\n", command_p);
         print_commands (argv[0]);
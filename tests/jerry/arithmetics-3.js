@@ -35,3 +35,29 @@ check_type_error("o1 ^ o2")
 check_type_error("o1 << o2")
 check_type_error("o1 >> o2")
 check_type_error("o1 >>> o2")
+
+function mul (x, y) { return x * y; }
+function div (x, y) { return x / y; }
+
+assert (mul (40503, 1023) === 41434569);
+assert (mul (-40503, 1023) === -41434569);
+assert (mul (0x7ffffff, 1) === 0x7ffffff);
+assert (mul (0x4000, 0x2000) === 0x8000000);
+assert (mul (-0x4000, 0x2000) === -0x8000000);
+assert (mul (0x7ffffff, 0x4000) === 2199023239168);
+assert (1 / mul (0, -5) === -Infinity);
+assert (1 / mul (-5, 0) === -Infinity);
+assert (1 / mul (0, 5) === Infinity);
+assert (1 / mul (-40503, 0) === -Infinity);
+
+assert (div (42, 6) === 7);
+assert (div (-42, 6) === -7);
+assert (div (42, -6) === -7);
+assert (div (7, 2) === 3.5);
+assert (div (-0x8000000, -1) === 0x8000000);
+assert (div (-0x8000000, 1) === -0x8000000);
+assert (1 / div (0, -5) === -Infinity);
+assert (1 / div (0, 5) === Infinity);
+assert (div (5, 0) === Infinity);
+assert (div (-5, 0) === -Infinity);
+assert (isNaN (div (0, 0)));
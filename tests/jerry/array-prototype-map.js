@@ -109,3 +109,16 @@ var func3 = function(value, idx, thisobj) {
   return value * idx + thisobj.const;
 }
 assert(array_example.map(func3).equals(["0CT", "2CT"]));
+
+// Elements changed by the callback
+var changing = [1, 2, 3, 4];
+var mapped = changing.map(function (x, i) {
+  if (i === 0) {
+    changing[2] = 30;
+    changing.length = 3;
+    Array.prototype[3] = "proto";
+  }
+  return x * 2;
+});
+delete Array.prototype[3];
+assert(mapped.length === 4 && mapped.join() === "2,4,60,NaN");
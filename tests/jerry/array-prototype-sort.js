@@ -195,3 +195,67 @@ try {
 } catch (e) {
   assert(e === 42.5);
 }
+
+// Sorting arrays without holes
+var dense = [3, "b", 1, undefined, { toString: function () { return "a"; } }, 2];
+dense.sort();
+assert(dense.length === 6 && dense[0] === 1 && dense[1] === 2 && dense[2] === 3);
+assert(String(dense[3]) === "a" && dense[4] === "b" && dense[5] === undefined);
+
+var shrinking = [5, 4, 3, 2, 1];
+shrinking.sort(function (x, y) { shrinking.length = 2; return x - y; });
+assert(shrinking.length === 5 && shrinking.join() === "1,2,3,4,5");
+
+var holey = [3, , 1, , 2];
+holey.sort();
+assert(holey.length === 5 && holey.join() === "1,2,3,," && !(3 in holey) && !(4 in holey));
+
+// Stability and run detection
+var records = [];
+for (var i = 0; i < 200; i++) {
+  records.push({ key: (i * 7) % 5, index: i });
+}
+records.sort(function (x, y) { return x.key - y.key; });
+for (var i = 1; i < records.length; i++) {
+  assert(records[i - 1].key < records[i].key
+         || (records[i - 1].key === records[i].key && records[i - 1].index < records[i].index));
+}
+
+var runs = [];
+for (var i = 0; i < 300; i++) {
+  runs.push(i < 100 ? 200 - i : (i < 200 ? i : i - 250));
+}
+var expected = runs.slice();
+runs.sort(function (x, y) { return x - y; });
+for (var i = 1; i < runs.length; i++) {
+  assert(runs[i - 1] <= runs[i]);
+}
+assert(runs.length === expected.length);
+
+var numbers = [10, 9, 1, -5, 100, 2.5, -0.5];
+numbers.sort();
+assert(numbers.join() === "-0.5,-5,1,10,100,2.5,9");
+
+var strings = ["b", "ab", "a", "", "ba"];
+strings.sort();
+assert(strings.join() === ",a,ab,b,ba");
+
+// The array keeps all of its elements when the comparator throws
+var items = [];
+for (var i = 0; i < 100; i++) {
+  items.push((i * 37) % 100 + 1);
+}
+var calls = 0;
+try {
+  items.sort(function (x, y) { if (++calls === 150) { throw "stop"; } return x - y; });
+  assert(false);
+} catch (e) {
+  assert(e === "stop");
+}
+var seen = {};
+for (var i = 0; i < items.length; i++) {
+  seen[items[i]] = true;
+}
+for (var i = 1; i <= 100; i++) {
+  assert(seen[i] === true);
+}
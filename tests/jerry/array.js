@@ -168,3 +168,25 @@ assert (elision.hasOwnProperty(1) == false);
     assert (e instanceof TypeError);
   }
 }) ();
+
+// Overwriting the elements of fast arrays
+var samples = [0.5, 1.5, 2, "x", {}, , 7];
+for (var i = 0; i < 3; i++) {
+  samples[0] = samples[0] * 2;
+  samples[1] = samples[1] + 0.25;
+}
+assert (samples[0] === 4 && samples[1] === 2.25);
+samples[1] = 1 << 29;
+samples[2] = 0.75;
+samples[3] = -0;
+samples[4] = samples[4];
+assert (samples[1] === 536870912 && samples[2] === 0.75 && 1 / samples[3] === -Infinity);
+assert (typeof samples[4] === "object");
+Array.prototype[5] = "proto";
+assert (samples[5] === "proto");
+samples[5] = 6;
+assert (samples[5] === 6 && samples.hasOwnProperty (5));
+delete Array.prototype[5];
+Object.freeze (samples);
+samples[0] = 1;
+assert (samples[0] === 4);
@@ -245,3 +245,26 @@ try {
 } catch (e) {
   assert(e instanceof RangeError)
 }
+
+// Large multiplication and conversion
+
+var big_mask = (1n << 4096n) - 1n
+assert(big_mask * big_mask === (1n << 8192n) - (1n << 4097n) + 1n)
+
+var big_left = 7n ** 1500n
+var big_right = 13n ** 700n + 1n
+assert((big_left + big_right) ** 2n - (big_left - big_right) ** 2n === 4n * big_left * big_right)
+assert(big_left * big_right === big_right * big_left)
+assert((big_left << 2000n) * (1n << 3000n) === big_left << 5000n)
+
+assert((10n ** 500n).toString() === "1" + "0".repeat(500))
+assert((-(10n ** 500n) + 1n).toString() === "-" + "9".repeat(500))
+assert(BigInt(big_left.toString()) === big_left)
+assert(BigInt("0x" + big_left.toString(16)) === big_left)
+assert(BigInt("0o" + big_right.toString(8)) === big_right)
+assert(BigInt("0b" + big_right.toString(2)) === big_right)
+assert((36n ** 100n).toString(36) === "1" + "0".repeat(100))
+
+assert(BigInt("0 ") === 0n)
+assert(BigInt(" 000 ") === 0n)
+assert(BigInt("00000000000000000000000000000000000001") === 1n)
@@ -0,0 +1,164 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Operations on literals
+assert("a" + "b" === "ab");
+assert("a" + "" === "a" && "" + "b" === "b");
+assert("pre" + "fix" + 1 === "prefix1");
+assert(("a" < "b") === true && ("b" < "a") === false && ("a" < "ab") === true);
+assert(("￿" > "𐀀") === true);
+assert(("ab" === "a" + "b") === true && ("x" != "x") === false);
+assert((1000 < 2000) === true && (1000 === 1000) === true && (1.5 >= 2.5) === false && (0 === -0) === true);
+
+assert(!0 === true && !1 === false && !-1 === false && !1.5 === false);
+assert(!"" === true && !"x" === false && !!"x" === true);
+assert(!null === true && !undefined === true && !0n === true);
+
+assert(typeof 1 === "number" && typeof 1.5 === "number" && typeof "s" === "string");
+assert(typeof true === "boolean" && typeof null === "object" && typeof 5n === "bigint");
+assert(void 4 === undefined);
+
+// Logical and conditional operators with constant conditions
+function fail() {
+  assert(false);
+}
+
+assert((0 && fail()) === 0);
+assert(("" || "z") === "z");
+assert((1 && "w") === "w");
+assert((true || fail()) === true);
+assert((1 && 2 && "" && fail()) === "");
+assert(("" || 0 || null) === null);
+assert(((false && fail()) || 5) === 5);
+assert((false && (() => { for (;;) break; })()) === false);
+
+assert((true ? 1 : fail()) === 1);
+assert((false ? fail() : 2) === 2);
+assert((0 ? fail() : "c") === "c");
+assert((true ? false ? 1 : 2 : 3) === 2);
+assert((0 ? a : (b) => b + 1)(2) === 3);
+
+// Unreachable statements
+function missing_return(c) {
+  if (c) return 1;
+  if (false) fail();
+}
+
+assert(missing_return(true) === 1);
+assert(missing_return(false) === undefined);
+
+function hoisted() {
+  return h() + (v === undefined ? 0 : 1);
+  function h() {
+    return 3;
+  }
+  var v = 1;
+  fail();
+}
+
+assert(hoisted() === 3);
+
+function if_else(c) {
+  if (false) {
+    return 1;
+  } else if (!1 && c) {
+    return 2;
+  } else {
+    return 3;
+  }
+}
+
+assert(if_else(true) === 3);
+
+function cases(x) {
+  switch (x) {
+    case 1:
+      return 1;
+      fail();
+    default:
+      return 9;
+      fail();
+    case 2:
+      return 2;
+  }
+}
+
+assert(cases(1) === 1 && cases(2) === 2 && cases(5) === 9);
+
+function jumps() {
+  var i = 0;
+  a: {
+    if (false) break a;
+    for (; i < 3; i++) {
+      if (false) {
+        for (;;) {
+          break;
+        }
+      }
+      continue;
+      fail();
+    }
+  }
+  return i;
+}
+
+assert(jumps() === 3);
+
+function try_statement() {
+  try {
+    throw 1;
+    fail();
+  } catch (e) {
+    return e;
+    fail();
+  } finally {
+  }
+}
+
+assert(try_statement() === 1);
+
+try { throw 1; fail() } catch (e) {}
+
+function try_return() {
+  try { return 1; fail() } catch (e) {}
+}
+
+assert(try_return() === 1);
+
+for (;;) { try { break; fail() } catch (e) {} }
+
+function try_finally() {
+  try { return 1; fail() } finally {}
+}
+
+assert(try_finally() === 1);
+
+function try_nested_block() {
+  try { { return 1; fail() } } finally {}
+}
+
+assert(try_nested_block() === 1);
+
+function* gen() {
+  yield 1;
+  return;
+  yield 2;
+}
+
+var it = gen();
+assert(it.next().value === 1);
+assert(it.next().done);
+
+eval("if (false) { var ev = 1; }");
+assert(ev === undefined);
@@ -127,3 +127,19 @@ assert(isNaN(new Date(1970, 0, 100000000 + 2).getFullYear()));
 assert(new Date(1970, 0, 100000000).getFullYear() == 275760);
 assert(isNaN(new Date(4294967295, -51536298411).getFullYear()));
 assert((new Date(4294967295, -51536300000).getFullYear()) == 275628);
+
+/* 9. test case */
+var dates = [new Date(2020, 1, 29, 12), new Date(2020, 2, 1, 12), new Date(2019, 11, 31, 12), new Date(1969, 11, 31, 12)];
+var expected = [[2020, 1, 29], [2020, 2, 1], [2019, 11, 31], [1969, 11, 31]];
+
+for (var i = 0; i < 3; i++) {
+  for (var j = 0; j < dates.length; j++) {
+    assert (dates[j].getDate() === expected[j][2]);
+    assert (dates[j].getMonth() === expected[j][1]);
+    assert (dates[j].getFullYear() === expected[j][0]);
+  }
+}
+
+assert (new Date(Date.UTC(2020, 0, 1) - 1).getUTCFullYear() === 2019);
+assert (new Date(Date.UTC(2020, 0, 1)).getUTCFullYear() === 2020);
+assert (new Date(Date.UTC(2020, 0, 1) - 1).getUTCDate() === 31);
@@ -190,3 +190,17 @@ assert(Date.parse('9999') == 253370764800000);
 assert(isNaN(Date.parse('10000')));
 assert(Date.parse('-100000') == -3217862419200000);
 assert(isNaN(Date.parse('-99999')));
+
+assert(Date.parse('2020-09-13T12:26:40.123Z') == 1600000000123);
+assert(Date.parse('1969-12-31T23:59:59.999Z') == -1);
+assert(Date.parse('0000-01-01T00:00:00.000Z') == -62167219200000);
+assert(Date.parse('9999-12-31T23:59:59.999Z') == 253402300799999);
+assert(Date.parse('2000-02-29T12:00:00.000Z') == 951825600000);
+assert(Date.parse('2021-02-31T00:00:00.000Z') == 1614729600000);
+assert(Date.parse('2021-01-01T24:00:00.000Z') == 1609545600000);
+assert(isNaN(Date.parse('2021-01-01T24:00:00.001Z')));
+assert(isNaN(Date.parse('2021-13-01T00:00:00.000Z')));
+assert(isNaN(Date.parse('2021-01-32T00:00:00.000Z')));
+assert(isNaN(Date.parse('2021-01-01T23:60:00.000Z')));
+assert(isNaN(Date.parse('2021-01-01T00:00:00.000Z ')));
+assert(isNaN(Date.parse('20a1-01-01T00:00:00.000Z')));
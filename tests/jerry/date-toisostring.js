@@ -52,3 +52,11 @@ try {
 } catch (e) {
     assert(e instanceof RangeError)
 }
+
+assert (new Date (1600000000123).toISOString () === "2020-09-13T12:26:40.123Z");
+assert (new Date (-1).toISOString () === "1969-12-31T23:59:59.999Z");
+assert (new Date (-62167219200000).toISOString () === "0000-01-01T00:00:00.000Z");
+assert (new Date (-62167219200001).toISOString () === "-000001-12-31T23:59:59.999Z");
+assert (new Date (253402300799999).toISOString () === "9999-12-31T23:59:59.999Z");
+assert (new Date (253402300800000).toISOString () === "+010000-01-01T00:00:00.000Z");
+assert (Date.parse (new Date (951825600007).toISOString ()) === 951825600007);
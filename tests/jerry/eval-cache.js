@@ -0,0 +1,111 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Dynamic functions with the same source are still different objects
+var body = "return a + b";
+var functions = [];
+
+for (var i = 0; i < 100; i++) {
+  functions.push(new Function("a", "b", body));
+}
+
+assert(functions[0] !== functions[1]);
+assert(functions[0].prototype !== functions[1].prototype);
+assert(functions[99](1, 2) === 3);
+assert(functions[99].toString() === functions[0].toString());
+
+assert(new Function("a", "c", "b", body)(1, 5, 2) === 3);
+assert(new Function("b", "a", body)("x", "y") === "yx");
+assert(new Function("a,b", body)("x", "y") === "xy");
+assert(Object.getPrototypeOf(new Function(body)) === Function.prototype);
+assert(Object.getPrototypeOf(new (Object.getPrototypeOf(function* () {}).constructor)(body)) !== Function.prototype);
+
+// Strictness is part of the key
+var code = "(function () { return this === undefined })()";
+
+function sloppy_eval() {
+  return eval(code);
+}
+
+function strict_eval() {
+  "use strict";
+  return eval(code);
+}
+
+for (var i = 0; i < 3; i++) {
+  assert(sloppy_eval() === false);
+  assert(strict_eval() === true);
+}
+
+// Each parsing creates new template objects
+function tag(strings) {
+  return strings;
+}
+
+assert(eval("tag`a`") !== eval("tag`a`"));
+assert(new Function("return tag`b`")() !== new Function("return tag`b`")());
+
+// Redeclaration checks depend on the calling environment
+function declare(has_let) {
+  if (has_let) {
+    let v = 1;
+    return eval("var v = 2; v");
+  }
+  return eval("var v = 2; v");
+}
+
+assert(declare(false) === 2);
+
+try {
+  declare(true);
+  assert(false);
+} catch (e) {
+  assert(e instanceof SyntaxError);
+}
+
+assert(declare(false) === 2);
+
+// Private names are resolved in the calling class
+class A {
+  #p = "A";
+  get() {
+    return eval("this.#p");
+  }
+}
+
+class B {
+  #p = "B";
+  get() {
+    return eval("this.#p");
+  }
+}
+
+assert(new A().get() === "A");
+assert(new B().get() === "B");
+assert(new A().get() === "A");
+
+// The compiled code belongs to a realm
+var realm = createRealm();
+
+for (var i = 0; i < 3; i++) {
+  assert(Object.getPrototypeOf(eval("[]")) === Array.prototype);
+  assert(Object.getPrototypeOf(realm.eval("[]")) === realm.Array.prototype);
+  assert(Object.getPrototypeOf(new Function("return []")()) === Array.prototype);
+  assert(Object.getPrototypeOf(new realm.Function("return []")()) === realm.Array.prototype);
+}
+
+realm = null;
+gc();
+
+assert(Object.getPrototypeOf(new Function("return []")()) === Array.prototype);
@@ -371,3 +371,46 @@ assert (result.a == 1);
 
 result = JSON.parse(str, [1, 2, 3]);
 assert (result.a == 1);
+
+// Checking records with repeated property names
+
+str = '[{"a":1,"b":2,"c":3},{"a":4,"b":5,"c":6},{"a":{"a":1,"b":{"a":0},"b":7},"b":8,"b":9},{"a":1,"b":2,"a":3}]';
+result = JSON.parse (str);
+assert (result.length === 4);
+assert (result[1].a === 4 && result[1].b === 5 && result[1].c === 6);
+assert (result[2].a.b === 7 && result[2].b === 9);
+assert (Object.keys (result[2]).length === 2);
+assert (result[3].a === 3 && Object.keys (result[3]).join () === "a,b");
+
+str = '{"x\\u0041":1, "xA":2, "__proto__":5, "0":1, "length":3}';
+result = JSON.parse (str);
+assert (result.xA === 2);
+assert (Object.keys (result).length === 4);
+assert (result.__proto__ === 5);
+assert (Object.getPrototypeOf (result) === Object.prototype);
+
+result = JSON.parse ('[1, [2, []], "s", null]');
+assert (result.length === 4);
+assert (result[1][1].length === 0);
+result.push (5);
+assert (result[4] === 5);
+
+// Checking number conversion
+assert (Object.is (JSON.parse ("-0"), -0));
+assert (JSON.parse ("[0.5, 10, 0e5, -12.5e-1, 1E+2]").join () === "0.5,10,0,-1.25,100");
+assert (JSON.parse ("0.30000000000000004") === 0.1 + 0.2);
+assert (JSON.parse ("9007199254740993") === 9007199254740992);
+assert (JSON.parse ("123456789012345678901234567890") === 1.2345678901234568e29);
+assert (JSON.parse ("0.00000000000000000000000000000000001234") === 1.234e-35);
+assert (JSON.parse ("1e99999999999") === Infinity);
+assert (Object.is (JSON.parse ("-1e-99999999999"), -0));
+
+// JSON.parse, Number () and numeric literals share the conversion
+var decimals = ["43248470876331970e-326", "0e312", "0.0001e309", "123456789012345678901234567890e-350", "1e-400"];
+for (var i = 0; i < decimals.length; i++) {
+  assert (Object.is (JSON.parse (decimals[i]), Number (decimals[i])));
+  assert (Object.is (JSON.parse (decimals[i]), eval (decimals[i])));
+}
+assert (JSON.parse ("43248470876331970e-326") === 4.3248470876332e-310);
+assert (Object.is (JSON.parse ("-0e312"), -0));
+assert (JSON.parse ("0.0001e309") === 1e305);
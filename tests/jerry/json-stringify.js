@@ -270,3 +270,38 @@ try {
 } catch (ex) {
   assert(ex instanceof TypeError);
 }
+
+// Checking the order and the values of plain objects and arrays
+var obj = { b: 1, a: [1, -0, 2.5, 1e21, NaN, -Infinity, "x", null, true, undefined, function () {}], c: {} };
+obj[1] = "one";
+obj.d = undefined;
+delete obj.b;
+obj.b = 2;
+assert(JSON.stringify(obj) === '{"1":"one","a":[1,0,2.5,1e+21,null,null,"x",null,true,null,null],"c":{},"b":2}');
+
+var arr = [1, , 3];
+Array.prototype[1] = "proto";
+assert(JSON.stringify(arr) === '[1,"proto",3]');
+delete Array.prototype[1];
+assert(JSON.stringify(arr) === '[1,null,3]');
+
+Object.prototype.toJSON = function (key) { return this.k ? "o:" + key : this; };
+assert(JSON.stringify({ a: { k: 1 } }) === '{"a":"o:a"}');
+assert(JSON.stringify([{ k: 1 }, [{ k: 1 }]]) === '["o:0",["o:0"]]');
+delete Object.prototype.toJSON;
+
+Array.prototype.toJSON = function (key) { return "a:" + key; };
+assert(JSON.stringify({ a: [1] }) === '{"a":"a:a"}');
+delete Array.prototype.toJSON;
+
+// Elements modified during the serialization
+var mutated = [{ toJSON: function () { mutated.length = 1; return 1; } }, 2, 3];
+assert(JSON.stringify(mutated) === '[1,null,null]');
+
+var mutated_obj = { a: { toJSON: function () { mutated_obj.b = 5; delete mutated_obj.c; return 1; } }, b: 2, c: 3 };
+assert(JSON.stringify(mutated_obj) === '{"a":1,"b":5}');
+
+var with_getter = { a: 1, get b () { return this.a + 1; } };
+Object.defineProperty(with_getter, "hidden", { value: 3, enumerable: false });
+with_getter[Symbol("s")] = 4;
+assert(JSON.stringify(with_getter) === '{"a":1,"b":2}');
@@ -0,0 +1,70 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function repeat (str, count) {
+  var result = "";
+  for (var i = 0; i < count; i++) {
+    result += str;
+  }
+  return result;
+}
+
+function check_syntax_error (code) {
+  try {
+    eval (code);
+    assert (false);
+  } catch (e) {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+/* Token lengths around the size of machine words. */
+for (var i = 0; i < 40; i++) {
+  var text = repeat ("a", i);
+  var ident = "x" + repeat ("Z", i) + "_$9";
+
+  assert (eval ("'" + text + "'").length === i);
+  assert (eval ("'" + text + "\\n" + text + "'") === text + "\n" + text);
+  assert (eval ("'" + text + "\"" + text + "'").length === 2 * i + 1);
+  assert (eval ("\"" + text + "'" + text + "\"").length === 2 * i + 1);
+  assert (eval ("'" + text + "é" + text + "一" + "'").length === 2 * i + 2);
+  assert (eval ("`" + text + "$" + text + "${i}" + text + "`") === text + "$" + text + i + text);
+  assert (eval ("`" + text + "${'" + text + "'}" + text + "`") === text + text + text);
+  assert (eval ("String.raw`" + text + "\\q" + text + "`") === text + "\\q" + text);
+
+  assert (eval ("var " + ident + " = " + i + "; " + ident) === i);
+  assert (eval ("var " + ident + "é" + ident + " = " + i + "; " + ident + "é" + ident) === i);
+  assert (eval ("var " + ident + "\\u0041" + " = " + i + "; " + ident + "A") === i);
+
+  assert (eval ("/*" + text + "*" + text + "**/ " + i) === i);
+  assert (eval ("/*" + text + "\n" + text + " " + text + "*/ " + i) === i);
+  assert (eval ("//" + text + "*/" + text + "\n" + i) === i);
+  assert (eval ("//" + text + "  " + i) === i);
+  assert (eval (i + " //" + text) === i);
+
+  check_syntax_error ("'" + text + "\n'");
+  check_syntax_error ("'" + text);
+  check_syntax_error ("/*" + text + "*");
+}
+
+/* Automatic semicolon insertion depends on newlines inside comments. */
+var value = 1;
+assert (eval ("value = 5 /* a long comment without newline characters */ + value") === 6);
+assert (eval ("value = 5 /* a long comment\nwith a newline character */ ++value") === 6);
+assert (value === 6);
+check_syntax_error ("value = 5 /* a long comment without newline characters */ ++value");
+
+/* Sources retained by the function toString. */
+function long_function_name_with_many_ascii_characters () { return '"long" string literal'; /* comment */ }
+assert (long_function_name_with_many_ascii_characters () === '"long" string literal');
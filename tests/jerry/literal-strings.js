@@ -0,0 +1,40 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Enough literal strings to search the literal storage with a hash index
+var source = "var sum = 0;\n";
+
+for (var i = 0; i < 2000; i++) {
+  source += "var identifier_" + i + " = '" + "value_" + i + "';\n";
+}
+
+for (var i = 0; i < 2000; i += 7) {
+  source += "sum += identifier_" + i + " === 'value_" + i + "' ? 1 : 0;\n";
+}
+
+source += "sum;";
+
+assert(eval(source) === 286);
+assert(identifier_0 === "value_0");
+assert(identifier_1999 === "value_1999");
+
+var func = new Function("a", source.replace("var sum = 0;", "var sum = a;") + "return sum;");
+assert(func(10) === 296);
+
+var object = {};
+for (var i = 0; i < 2000; i++) {
+  object["identifier_" + i] = i;
+}
+assert(eval("object.identifier_1234 + object.identifier_567") === 1801);
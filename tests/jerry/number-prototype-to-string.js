@@ -130,3 +130,23 @@ try {
 } catch (e) {
   assert(e instanceof RangeError);
 }
+
+// Shortest representation of numbers in radix 10
+assert(String(0.1) === "0.1");
+assert(String(0.1 + 0.2) === "0.30000000000000004");
+assert(String(1 / 3) === "0.3333333333333333");
+assert(String(123.456) === "123.456");
+assert(String(5e-324) === "5e-324");
+assert(String(2.2250738585072014e-308) === "2.2250738585072014e-308");
+assert(String(1.7976931348623157e308) === "1.7976931348623157e+308");
+assert(String(1e21) === "1e+21");
+assert(String(1e-7) === "1e-7");
+assert(String(-1.5e-10) === "-1.5e-10");
+assert(String(4294967296) === "4294967296");
+assert(String(10000000001) === "10000000001");
+assert(String(1000000000000000) === "1000000000000000");
+assert(String(9007199254740991) === "9007199254740991");
+assert(String(-9007199254740991) === "-9007199254740991");
+assert(String(9007199254740994) === "9007199254740994");
+assert(String(123456789012345680000) === "123456789012345680000");
+assert(JSON.stringify([1, 10, 99, 100, 12345, 4294967295, 0.25, -7]) === "[1,10,99,100,12345,4294967295,0.25,-7]");
@@ -0,0 +1,53 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Parsers allocating and releasing their temporary data one after another
+var sources = [
+  "var a = x; for (var i = 0; i < 3; i++) { a += i; } return a;",
+  "switch (x) { case 1: return 'one'; case 2: { let y = x; return y; } default: return x; }",
+  "var { a, b: [c, d] = [1, 2] } = { a: x }; return a + c + d;",
+  "class C { #p = x; static s = 1; get p () { return this.#p; } }; return new C ().p + C.s;",
+  "label: while (true) { try { if (x) break label; } finally { x = 0; } } return x;",
+];
+
+for (var i = 0; i < 500; i++) {
+  var source = sources[i % sources.length];
+
+  if (i % 3 == 0) {
+    try {
+      eval("(function (x) {" + source + " } + )");
+      assert(false);
+    } catch (e) {
+      assert(e instanceof SyntaxError);
+    }
+  }
+
+  var func = new Function("x", source);
+  assert(func(1) !== undefined);
+}
+
+assert(new Function("x", sources[0])(1) === 4);
+assert(new Function("x", sources[1])(2) === 2);
+assert(new Function("x", sources[2])(5) === 8);
+assert(new Function("x", sources[3])(5) === 6);
+assert(new Function("x", sources[4])(1) === 0);
+
+// Nested functions keep the temporary data of the enclosing ones alive
+var nested = "return 0";
+
+for (var i = 0; i < 40; i++) {
+  nested = "switch (" + i + ") { case " + i + ": return (function () { " + nested + " })() + 1; }";
+}
+
+assert(new Function(nested)() === 40);
@@ -19,7 +19,8 @@ for (var i = 0; i < 10; i++) {
   str = str + str;
 }
 
-str = "(function() { return " + str + "1 })";
+/* The tagged template prevents reusing the compiled code of the previous evals. */
+str = "(function() { String.raw``; return " + str + "1 })";
 
 /* Eat memory. */
 var array = [];
@@ -72,3 +72,56 @@ i.sort(function (lhs, rhs) {
   return { valueOf: function() { return rhs - lhs; } };
 });
 assert(i.toString() === '3,2,1');
+
+// Default sorting of every element type.
+var j = Int8Array.from([5, -128, 127, 0, -1, 1, -5]);
+assert(j.sort().toString() === '-128,-5,-1,0,1,5,127');
+
+var k = Int16Array.from([300, -32768, 32767, -300, 0, 256, -256]);
+assert(k.sort().toString() === '-32768,-300,-256,0,256,300,32767');
+
+var l = Uint16Array.from([65535, 256, 1, 0, 257]);
+assert(l.sort().toString() === '0,1,256,257,65535');
+
+var m = Int32Array.from([2147483647, -2147483648, 65536, -65536, 0, -1, 1]);
+assert(m.sort().toString() === '-2147483648,-65536,-1,0,1,65536,2147483647');
+
+var n = Uint32Array.from([4294967295, 16777216, 65536, 256, 0]);
+assert(n.sort().toString() === '0,256,65536,16777216,4294967295');
+
+var o = Float64Array.from([NaN, 1.5, -0, 0, -1.5, Infinity, -Infinity, 5e-324, -5e-324, -NaN, 1e300]);
+assert(o.sort().toString() === '-Infinity,-1.5,-5e-324,0,0,5e-324,1.5,1e+300,Infinity,NaN,NaN');
+assert(1 / o[3] === -Infinity);
+assert(1 / o[4] === Infinity);
+
+var p = Float32Array.from([3.5, -0, 0, -3.5, 0.25, -0.25]);
+p.sort();
+assert(p.toString() === '-3.5,-0.25,0,0,0.25,3.5');
+assert(1 / p[2] === -Infinity);
+
+// Arrays where some key digits are shared.
+var q = new Uint32Array(300);
+for (var idx = 0; idx < q.length; idx++) {
+  q[idx] = ((idx * 7919) % 300) * 65536 + 42;
+}
+q.sort();
+for (var idx = 0; idx < q.length; idx++) {
+  assert(q[idx] === idx * 65536 + 42);
+}
+
+var r = new Float64Array(300);
+for (var idx = 0; idx < r.length; idx++) {
+  r[idx] = ((idx * 7919) % 300) - 150.5;
+}
+r.sort();
+for (var idx = 0; idx < r.length; idx++) {
+  assert(r[idx] === idx - 150.5);
+}
+
+if (typeof BigInt64Array === 'function') {
+  var s = BigInt64Array.from([5n, -9223372036854775808n, 9223372036854775807n, 0n, -1n]);
+  assert(s.sort().toString() === '-9223372036854775808,-1,0,5,9223372036854775807');
+
+  var t = BigUint64Array.from([18446744073709551615n, 4294967296n, 1n, 0n]);
+  assert(t.sort().toString() === '0,1,4294967296,18446744073709551615');
+}
@@ -16,4 +16,18 @@ assert (+0 === -0);
 assert (1/-0 === -Infinity);
 assert (1/+0 === Infinity);
 assert ("3" -+-+-+ "1" + "1" / "3" * "6" + "2" === "42");
-assert (isNaN (-NaN));
\ No newline at end of file
+assert (isNaN (-NaN));
+
+var zero = 0, half = 0.5, max_int = 268435455;
+assert (1 / -zero === -Infinity);
+assert (1 / -(-zero) === Infinity);
+assert (-half === -0.5 && +half === 0.5);
+assert (-(-half) === 0.5);
+assert (-max_int === -268435455 && -(-max_int - 1) === 268435456);
+assert (-{ valueOf: function () { return half; } } === -0.5);
+
+var three = 3, one_and_half = 1.5;
+assert (three / 2 === 1.5 && three / three === 1);
+assert (1 / (zero / -three) === -Infinity);
+assert (isNaN (zero / zero));
+assert (three / one_and_half === 2 && one_and_half / half === 3 && 4.5 / one_and_half === three);
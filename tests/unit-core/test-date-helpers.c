@@ -13,12 +13,25 @@
  * limitations under the License.
  */
 
+#if defined(__unix__) || defined(__APPLE__)
+#if !defined(_XOPEN_SOURCE) || _XOPEN_SOURCE < 600
+#undef _XOPEN_SOURCE
+/* Required macro for setenv and tzset */
+#define _XOPEN_SOURCE 600
+#endif /* !defined(_XOPEN_SOURCE) || _XOPEN_SOURCE < 600 */
+#endif /* defined(__unix__) || defined(__APPLE__) */
+
 #include "ecma-builtin-helpers.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 
 #include "test-common.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <stdlib.h>
+#include <time.h>
+#endif /* defined(__unix__) || defined(__APPLE__) */
+
 #define MS_PER_DAY  ((ecma_number_t) 86400000)
 #define MS_PER_YEAR ((ecma_number_t) 365 * MS_PER_DAY)
 #define START_OF_GREGORIAN_CALENDAR                                                           \
@@ -31,6 +44,9 @@
 int
 main (void)
 {
+  /* The calendar date cache is stored in the context. */
+  jerry_init (JERRY_INIT_EMPTY);
+
   /* int ecma_date_year_from_time (time) */
 
   TEST_ASSERT (ecma_date_year_from_time (0) == 1970);
@@ -119,5 +135,25 @@ main (void)
 
   /* FIXME: Implement */
 
+  /* int32_t ecma_date_local_time_zone_adjustment (time) */
+
+#if defined(__unix__) || defined(__APPLE__)
+  /* The offset changes from +5:21:10 to +5:30 at 1905-12-31T18:38:50Z in this zone. */
+  setenv ("TZ", "Asia/Kolkata", 1);
+  tzset ();
+#endif /* defined(__unix__) || defined(__APPLE__) */
+
+  const ecma_number_t before_transition = -2019705900000.0; /* 1905-12-31T18:35Z */
+  const ecma_number_t after_transition = -2019705600000.0; /* 1905-12-31T18:40Z */
+
+  int32_t tza_before = jerry_port_local_tza (before_transition);
+  int32_t tza_after = jerry_port_local_tza (after_transition);
+
+  /* The result does not depend on the previously queried time values. */
+  TEST_ASSERT (ecma_date_local_time_zone_adjustment (before_transition) == tza_before);
+  TEST_ASSERT (ecma_date_local_time_zone_adjustment (after_transition) == tza_after);
+  TEST_ASSERT (ecma_date_local_time_zone_adjustment (before_transition) == tza_before);
+
+  jerry_cleanup ();
   return 0;
 } /* main */
@@ -30,6 +30,68 @@ custom_to_json (const jerry_call_info_t *call_info_p, /**< call information */
   return jerry_throw_sz (JERRY_ERROR_URI, "Error");
 } /* custom_to_json */
 
+static double stream_sum = 0;
+static uint32_t stream_count = 0;
+
+static void
+json_stream_callback (const jerry_value_t value, /**< parsed value */
+                      void *user_p) /**< user pointer */
+{
+  TEST_ASSERT (user_p == (void *) &stream_count);
+
+  if (jerry_value_is_object (value))
+  {
+    jerry_value_t id_value = jerry_object_get_sz (value, "id");
+
+    if (jerry_value_is_number (id_value))
+    {
+      stream_sum += jerry_value_as_number (id_value);
+    }
+
+    jerry_value_free (id_value);
+  }
+  else if (jerry_value_is_number (value))
+  {
+    stream_sum += jerry_value_as_number (value);
+  }
+
+  stream_count++;
+} /* json_stream_callback */
+
+static jerry_value_t
+json_stream_parse (uint32_t options, /**< parser options */
+                   const char *source_p, /**< source text */
+                   jerry_size_t chunk_size) /**< size of the chunks passed to the parser */
+{
+  jerry_json_parser_t *parser_p = jerry_json_parser_new (options, json_stream_callback, (void *) &stream_count);
+  jerry_size_t source_size = (jerry_size_t) strlen (source_p);
+
+  stream_sum = 0;
+  stream_count = 0;
+
+  for (jerry_size_t offset = 0; offset < source_size; offset += chunk_size)
+  {
+    jerry_size_t size = source_size - offset;
+
+    if (size > chunk_size)
+    {
+      size = chunk_size;
+    }
+
+    jerry_value_t result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) source_p + offset, size);
+
+    if (jerry_value_is_exception (result))
+    {
+      jerry_value_free (jerry_json_parser_finish (parser_p));
+      return result;
+    }
+
+    TEST_ASSERT (jerry_value_is_undefined (result));
+  }
+
+  return jerry_json_parser_finish (parser_p);
+} /* json_stream_parse */
+
 int
 main (void)
 {
@@ -116,6 +178,93 @@ main (void)
     jerry_value_free (parsed_json);
   }
 
+  /* Incremental JSON parser checks */
+  {
+    const char *elements_p = " [ {\"id\": 1, \"s\": \"a,]}\\\"\"}, {\"id\": 2, \"n\": [[], {}]}, 3 ,4] ";
+    const char *sequence_p = "{\"id\": 5}\n{\"id\": 6, \"a\": [\"}\"]}\n7 8";
+
+    for (jerry_size_t chunk_size = 1; chunk_size <= 64; chunk_size *= 4)
+    {
+      jerry_value_t result = json_stream_parse (JERRY_JSON_PARSER_ARRAY_ELEMENTS, elements_p, chunk_size);
+      TEST_ASSERT (jerry_value_is_undefined (result));
+      TEST_ASSERT (stream_count == 4 && stream_sum == 10);
+
+      result = json_stream_parse (JERRY_JSON_PARSER_VALUE_SEQUENCE, sequence_p, chunk_size);
+      TEST_ASSERT (jerry_value_is_undefined (result));
+      TEST_ASSERT (stream_count == 4 && stream_sum == 26);
+
+      result = json_stream_parse (JERRY_JSON_PARSER_NO_OPTS, elements_p, chunk_size);
+      TEST_ASSERT (jerry_value_is_array (result));
+      TEST_ASSERT (jerry_array_length (result) == 4 && stream_count == 0);
+      jerry_value_free (result);
+    }
+
+    jerry_value_t result = json_stream_parse (JERRY_JSON_PARSER_ARRAY_ELEMENTS, "[]", 1);
+    TEST_ASSERT (jerry_value_is_undefined (result) && stream_count == 0);
+
+    result = json_stream_parse (JERRY_JSON_PARSER_VALUE_SEQUENCE, "  ", 1);
+    TEST_ASSERT (jerry_value_is_undefined (result) && stream_count == 0);
+
+    const char *invalid_elements[] = { "", "{}", "[1,]", "[,]", "[1 2]", "[1} ", "[1] 2", "[1, [2]", "[\"a]" };
+
+    for (size_t i = 0; i < sizeof (invalid_elements) / sizeof (invalid_elements[0]); i++)
+    {
+      result = json_stream_parse (JERRY_JSON_PARSER_ARRAY_ELEMENTS, invalid_elements[i], 2);
+      TEST_ASSERT (jerry_value_is_exception (result));
+      TEST_ASSERT (jerry_error_type (result) == JERRY_ERROR_SYNTAX);
+      jerry_value_free (result);
+    }
+
+    const char *invalid_sequence[] = { "1 2]", "{} {", "1{}", "\"a" };
+
+    for (size_t i = 0; i < sizeof (invalid_sequence) / sizeof (invalid_sequence[0]); i++)
+    {
+      result = json_stream_parse (JERRY_JSON_PARSER_VALUE_SEQUENCE, invalid_sequence[i], 3);
+      TEST_ASSERT (jerry_value_is_exception (result));
+      TEST_ASSERT (jerry_error_type (result) == JERRY_ERROR_SYNTAX);
+      jerry_value_free (result);
+    }
+
+    /* Source text which cannot be stored is rejected with a RangeError. */
+    jerry_json_parser_t *parser_p = jerry_json_parser_new (JERRY_JSON_PARSER_NO_OPTS, NULL, NULL);
+    TEST_ASSERT (parser_p != NULL);
+
+    result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) "[", 1);
+    TEST_ASSERT (jerry_value_is_undefined (result));
+
+    result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) "1", UINT32_MAX);
+    TEST_ASSERT (jerry_value_is_exception (result));
+    TEST_ASSERT (jerry_error_type (result) == JERRY_ERROR_RANGE);
+    jerry_value_free (result);
+
+    result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) "1", 1);
+    TEST_ASSERT (jerry_value_is_exception (result));
+    jerry_value_free (result);
+    jerry_value_free (jerry_json_parser_finish (parser_p));
+
+    static jerry_char_t spaces[65536];
+    memset (spaces, ' ', sizeof (spaces));
+
+    parser_p = jerry_json_parser_new (JERRY_JSON_PARSER_NO_OPTS, NULL, NULL);
+    TEST_ASSERT (parser_p != NULL);
+
+    for (int i = 0; i < 256; i++)
+    {
+      result = jerry_json_parser_feed (parser_p, spaces, sizeof (spaces));
+
+      if (jerry_value_is_exception (result))
+      {
+        TEST_ASSERT (jerry_error_type (result) == JERRY_ERROR_RANGE);
+        jerry_value_free (result);
+        break;
+      }
+
+      TEST_ASSERT (jerry_value_is_undefined (result));
+    }
+
+    jerry_value_free (jerry_json_parser_finish (parser_p));
+  }
+
   /* JSON.stringify check */
   {
     jerry_value_t obj = jerry_object ();
@@ -184,6 +333,42 @@ main (void)
     jerry_value_free (obj);
   }
 
+  /* JSON.stringify into a buffer */
+  {
+    const jerry_char_t data[] = "{\"name\":\"J\u00f6hn\",\"list\":[1,2.5,\"\\ud83d\\ude00\"]}";
+    jerry_value_t obj = jerry_json_parse (data, sizeof (data) - 1);
+    TEST_ASSERT (jerry_value_is_object (obj));
+
+    const char check_value[] = "{\"name\":\"J\xc3\xb6hn\",\"list\":[1,2.5,\"\xf0\x9f\x98\x80\"]}";
+    const jerry_size_t check_size = (jerry_size_t) strlen (check_value);
+
+    jerry_value_t result = jerry_json_stringify_to_buffer (obj, NULL, 0);
+    TEST_ASSERT (jerry_value_is_number (result));
+    TEST_ASSERT ((jerry_size_t) jerry_value_as_number (result) == check_size);
+    jerry_value_free (result);
+
+    jerry_char_t buffer[64];
+    memset (buffer, 0, sizeof (buffer));
+
+    result = jerry_json_stringify_to_buffer (obj, buffer, check_size - 1);
+    TEST_ASSERT ((jerry_size_t) jerry_value_as_number (result) == check_size);
+    TEST_ASSERT (buffer[0] == 0);
+    jerry_value_free (result);
+
+    result = jerry_json_stringify_to_buffer (obj, buffer, sizeof (buffer));
+    TEST_ASSERT ((jerry_size_t) jerry_value_as_number (result) == check_size);
+    TEST_ASSERT (memcmp (buffer, check_value, check_size) == 0);
+    jerry_value_free (result);
+    jerry_value_free (obj);
+
+    jerry_value_t undefined_value = jerry_undefined ();
+    result = jerry_json_stringify_to_buffer (undefined_value, buffer, sizeof (buffer));
+    TEST_ASSERT (jerry_value_is_exception (result));
+    TEST_ASSERT (jerry_error_type (result) == JERRY_ERROR_SYNTAX);
+    jerry_value_free (result);
+    jerry_value_free (undefined_value);
+  }
+
   jerry_cleanup ();
 
   return 0;
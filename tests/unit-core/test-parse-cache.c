@@ -0,0 +1,222 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "config.h"
+#include "test-common.h"
+
+static uint8_t cache_buffer[8192];
+static size_t cache_size = 0;
+static size_t cache_available_size = 0;
+static uint32_t cache_hash = 0;
+static int load_count = 0;
+static int store_count = 0;
+
+static const uint8_t *
+parse_cache_load (uint32_t source_hash, /**< hash of the source code */
+                  size_t *data_size_p, /**< [out] size of the data */
+                  void *user_p) /**< user pointer */
+{
+  TEST_ASSERT (user_p == (void *) &cache_hash);
+
+  load_count++;
+
+  if (cache_size == 0 || source_hash != cache_hash)
+  {
+    return NULL;
+  }
+
+  *data_size_p = cache_available_size;
+  return cache_buffer;
+} /* parse_cache_load */
+
+static void
+parse_cache_store (uint32_t source_hash, /**< hash of the source code */
+                   const uint8_t *data_p, /**< data */
+                   size_t data_size, /**< size of the data */
+                   void *user_p) /**< user pointer */
+{
+  TEST_ASSERT (user_p == (void *) &cache_hash);
+  TEST_ASSERT (data_size <= sizeof (cache_buffer));
+
+  store_count++;
+  memcpy (cache_buffer, data_p, data_size);
+  cache_size = data_size;
+  cache_available_size = data_size;
+  cache_hash = source_hash;
+} /* parse_cache_store */
+
+static void
+run_source (const char *source_p, /**< source code */
+            const char *arguments_p, /**< function arguments (NULL for scripts) */
+            double expected_result) /**< expected result */
+{
+  jerry_parse_options_t parse_options;
+  parse_options.options = JERRY_PARSE_NO_OPTS;
+
+  if (arguments_p != NULL)
+  {
+    parse_options.options = JERRY_PARSE_HAS_ARGUMENT_LIST;
+    parse_options.argument_list = jerry_string_sz (arguments_p);
+  }
+
+  jerry_value_t script = jerry_parse ((const jerry_char_t *) source_p, strlen (source_p), &parse_options);
+  TEST_ASSERT (!jerry_value_is_exception (script));
+
+  if (arguments_p != NULL)
+  {
+    jerry_value_free (parse_options.argument_list);
+  }
+
+  jerry_value_t result;
+
+  if (arguments_p != NULL)
+  {
+    jerry_value_t args[2] = { jerry_number (3), jerry_number (4) };
+    jerry_value_t this_value = jerry_undefined ();
+
+    result = jerry_call (script, this_value, args, 2);
+    jerry_value_free (args[0]);
+    jerry_value_free (args[1]);
+  }
+  else
+  {
+    result = jerry_run (script);
+  }
+
+  TEST_ASSERT (jerry_value_is_number (result));
+  TEST_ASSERT (jerry_value_as_number (result) == expected_result);
+
+  jerry_value_free (result);
+  jerry_value_free (script);
+} /* run_source */
+
+static void
+test_source (const char *source_p, /**< source code */
+             const char *arguments_p, /**< function arguments (NULL for scripts) */
+             double expected_result) /**< expected result */
+{
+  cache_size = 0;
+  load_count = 0;
+  store_count = 0;
+
+  jerry_init (JERRY_INIT_EMPTY);
+  jerry_parse_cache (parse_cache_load, parse_cache_store, (void *) &cache_hash);
+
+  run_source (source_p, arguments_p, expected_result);
+  TEST_ASSERT (load_count == 1 && store_count == 1 && cache_size > 0);
+
+  /* The stored data is used after the engine is reinitialized. */
+  jerry_cleanup ();
+  jerry_init (JERRY_INIT_EMPTY);
+  jerry_parse_cache (parse_cache_load, parse_cache_store, (void *) &cache_hash);
+
+  run_source (source_p, arguments_p, expected_result);
+  TEST_ASSERT (load_count == 2 && store_count == 1);
+
+  /* Truncated data is ignored. */
+  for (size_t size = 0; size < cache_size; size += 3)
+  {
+    jerry_cleanup ();
+    jerry_init (JERRY_INIT_EMPTY);
+    jerry_parse_cache (parse_cache_load, parse_cache_store, (void *) &cache_hash);
+
+    cache_available_size = size;
+    run_source (source_p, arguments_p, expected_result);
+  }
+
+  TEST_ASSERT (store_count > 1);
+  TEST_ASSERT (cache_available_size == cache_size);
+
+  /* Damaged data is ignored: the code is scanned again, and the new data is stored. */
+  for (size_t offset = 0; offset < cache_size; offset++)
+  {
+    jerry_cleanup ();
+    jerry_init (JERRY_INIT_EMPTY);
+    jerry_parse_cache (parse_cache_load, parse_cache_store, (void *) &cache_hash);
+
+    int prev_store_count = store_count;
+    uint8_t original = cache_buffer[offset];
+
+    cache_buffer[offset] ^= (uint8_t) (1u << (offset & 0x7));
+    run_source (source_p, arguments_p, expected_result);
+
+    TEST_ASSERT (store_count == prev_store_count + 1);
+    TEST_ASSERT (cache_buffer[offset] == original);
+  }
+
+  jerry_cleanup ();
+} /* test_source */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  test_source (TEST_STRING_LITERAL ("var sum = 0;\n"
+                                    "for (let i = 0; i < 4; i++) {\n"
+                                    "  sum += i;\n"
+                                    "}\n"
+                                    "for (var key in { a: 1 }) {\n"
+                                    "  sum += key.length;\n"
+                                    "}\n"
+                                    "function f (a, [b, c] = [1, 2]) {\n"
+                                    "  switch (a) {\n"
+                                    "    case 0: { let d = b; return d; }\n"
+                                    "    case 1: return c;\n"
+                                    "    default: return a;\n"
+                                    "  }\n"
+                                    "}\n"
+                                    "class C {\n"
+                                    "  #x = 10;\n"
+                                    "  static s = 5;\n"
+                                    "  get x () { return this.#x; }\n"
+                                    "}\n"
+                                    "var { p, q = 2 } = { p: 1 };\n"
+                                    "sum + f (0) + f (1) + f (9) + new C ().x + C.s + p + q\n"),
+               NULL,
+               37);
+
+  test_source (TEST_STRING_LITERAL ("let r = a * b; { const s = r + a; r = s; } return r;"), "a, b", 15);
+
+  /* Large distances between declarations are stored as positions. */
+  static char long_source[70100];
+  const char *prefix_p = "var first = 5; /*";
+  const char *suffix_p = "*/ var second = 6; first * second";
+  size_t prefix_length = strlen (prefix_p);
+
+  memcpy (long_source, prefix_p, prefix_length);
+  memset (long_source + prefix_length, ' ', 70000);
+  memcpy (long_source + prefix_length + 70000, suffix_p, strlen (suffix_p) + 1);
+
+  test_source (long_source, NULL, 30);
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* Eval code is never cached. */
+  load_count = 0;
+  jerry_parse_cache (parse_cache_load, parse_cache_store, (void *) &cache_hash);
+
+  const char *eval_p = TEST_STRING_LITERAL ("eval ('1 + 2')");
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) eval_p, strlen (eval_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_number (result) && jerry_value_as_number (result) == 3);
+  jerry_value_free (result);
+  TEST_ASSERT (load_count == 0);
+
+  jerry_parse_cache (NULL, NULL, NULL);
+  jerry_cleanup ();
+  return 0;
+} /* main */
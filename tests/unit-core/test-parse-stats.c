@@ -0,0 +1,180 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * Collected statistics
+ */
+typedef struct
+{
+  uint32_t function_count; /**< number of reported functions */
+  uint32_t max_depth; /**< maximum nesting depth */
+  uint32_t instruction_count; /**< sum of the reported instruction counts */
+  uint32_t instruction_size; /**< sum of the reported instruction sizes */
+  uint32_t opcode_count; /**< sum of the reported opcode counts */
+  uint32_t opcode_size; /**< sum of the reported opcode sizes */
+  bool has_return; /**< CBC_RETURN opcode is reported */
+} test_stats_t;
+
+static void
+function_stats_callback (const jerry_function_stats_t *stats_p, /**< function stats */
+                         void *user_p) /**< user pointer */
+{
+  test_stats_t *test_stats_p = (test_stats_t *) user_p;
+
+  TEST_ASSERT (stats_p->byte_code_size > stats_p->instruction_size);
+  TEST_ASSERT (stats_p->instruction_count > 0 && stats_p->instruction_count <= stats_p->instruction_size);
+  TEST_ASSERT (stats_p->line > 0);
+
+  test_stats_p->function_count++;
+  test_stats_p->instruction_count += stats_p->instruction_count;
+  test_stats_p->instruction_size += stats_p->instruction_size;
+
+  if (stats_p->depth > test_stats_p->max_depth)
+  {
+    test_stats_p->max_depth = stats_p->depth;
+  }
+} /* function_stats_callback */
+
+static void
+opcode_stats_callback (const char *opcode_name_p, /**< opcode name */
+                       uint32_t count, /**< number of occurrences */
+                       uint32_t size, /**< total size of the instructions */
+                       void *user_p) /**< user pointer */
+{
+  test_stats_t *test_stats_p = (test_stats_t *) user_p;
+
+  TEST_ASSERT (opcode_name_p != NULL && count > 0 && size >= count);
+
+  test_stats_p->opcode_count += count;
+  test_stats_p->opcode_size += size;
+
+  if (strcmp (opcode_name_p, "CBC_RETURN") == 0)
+  {
+    test_stats_p->has_return = true;
+  }
+} /* opcode_stats_callback */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  const jerry_char_t source[] = TEST_STRING_LITERAL ("function f (a, b) {\n"
+                                                     "  function g () { return /ab+c/.test (a); }\n"
+                                                     "  return g () ? a + b : a - b;\n"
+                                                     "}\n"
+                                                     "var x = { y: f (1, 2), z: [1, 2, 3] };\n");
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_parse_stats_t parse_stats;
+  jerry_byte_code_stats_t byte_code_stats;
+
+  if (!jerry_feature_enabled (JERRY_FEATURE_PARSER_STATS))
+  {
+    jerry_value_t parsed_code_val = jerry_parse (source, sizeof (source) - 1, NULL);
+    TEST_ASSERT (!jerry_value_is_exception (parsed_code_val));
+
+    TEST_ASSERT (!jerry_parse_stats (&parse_stats));
+    TEST_ASSERT (!jerry_byte_code_stats (parsed_code_val, &byte_code_stats, NULL, NULL, NULL));
+
+    jerry_value_free (parsed_code_val);
+    jerry_cleanup ();
+    return 0;
+  }
+
+  TEST_ASSERT (jerry_parse_stats (&parse_stats));
+  TEST_ASSERT (parse_stats.version == 1);
+  TEST_ASSERT (parse_stats.parse_count == 0);
+  TEST_ASSERT (!jerry_parse_stats (NULL));
+
+  jerry_value_t parsed_code_val = jerry_parse (source, sizeof (source) - 1, NULL);
+  TEST_ASSERT (!jerry_value_is_exception (parsed_code_val));
+
+  TEST_ASSERT (jerry_parse_stats (&parse_stats));
+  TEST_ASSERT (parse_stats.parse_count == 1);
+  TEST_ASSERT (parse_stats.source_size == sizeof (source) - 1);
+  TEST_ASSERT (parse_stats.scanner_time >= 0 && parse_stats.parser_time >= 0);
+
+  /* Script with nested functions. */
+  test_stats_t test_stats;
+  memset (&test_stats, 0, sizeof (test_stats));
+
+  TEST_ASSERT (jerry_byte_code_stats (parsed_code_val,
+                                      &byte_code_stats,
+                                      function_stats_callback,
+                                      opcode_stats_callback,
+                                      &test_stats));
+  TEST_ASSERT (byte_code_stats.version == 1);
+  TEST_ASSERT (byte_code_stats.function_count == 3);
+  TEST_ASSERT (test_stats.function_count == 3);
+  TEST_ASSERT (test_stats.max_depth == 2);
+  TEST_ASSERT (test_stats.instruction_count == byte_code_stats.instruction_count);
+  TEST_ASSERT (test_stats.instruction_size == byte_code_stats.instruction_size);
+  TEST_ASSERT (test_stats.opcode_count == byte_code_stats.instruction_count);
+  TEST_ASSERT (test_stats.opcode_size == byte_code_stats.instruction_size);
+  TEST_ASSERT (test_stats.has_return);
+  TEST_ASSERT (byte_code_stats.byte_code_size > byte_code_stats.instruction_size);
+  TEST_ASSERT (byte_code_stats.identifier_count > 0 && byte_code_stats.literal_count > 0);
+  TEST_ASSERT (byte_code_stats.max_register_count >= 2 && byte_code_stats.max_stack_limit > 0);
+
+  /* Callbacks are optional. */
+  jerry_byte_code_stats_t byte_code_stats_no_callbacks;
+  TEST_ASSERT (jerry_byte_code_stats (parsed_code_val, &byte_code_stats_no_callbacks, NULL, NULL, NULL));
+  TEST_ASSERT (memcmp (&byte_code_stats, &byte_code_stats_no_callbacks, sizeof (jerry_byte_code_stats_t)) == 0);
+
+  /* Function created from an argument list. */
+  const jerry_char_t function_source[] = TEST_STRING_LITERAL ("return a * b;");
+  const jerry_char_t function_args[] = TEST_STRING_LITERAL ("a, b");
+
+  jerry_parse_options_t parse_options;
+  parse_options.options = JERRY_PARSE_HAS_ARGUMENT_LIST;
+  parse_options.argument_list = jerry_string_sz ((const char *) function_args);
+
+  jerry_value_t function_val = jerry_parse (function_source, sizeof (function_source) - 1, &parse_options);
+  TEST_ASSERT (!jerry_value_is_exception (function_val));
+  jerry_value_free (parse_options.argument_list);
+
+  TEST_ASSERT (jerry_parse_stats (&parse_stats));
+  TEST_ASSERT (parse_stats.parse_count == 2);
+  TEST_ASSERT (parse_stats.source_size == (sizeof (source) - 1) + (sizeof (function_source) - 1)
+                                            + (sizeof (function_args) - 1));
+
+  memset (&test_stats, 0, sizeof (test_stats));
+  TEST_ASSERT (jerry_byte_code_stats (function_val, &byte_code_stats, function_stats_callback, NULL, &test_stats));
+  TEST_ASSERT (byte_code_stats.function_count == 1);
+  TEST_ASSERT (test_stats.max_depth == 0);
+  TEST_ASSERT (byte_code_stats.max_register_count == 2);
+
+  /* Values without byte code. */
+  jerry_value_t object_val = jerry_object ();
+  jerry_value_t number_val = jerry_number (1);
+
+  TEST_ASSERT (!jerry_byte_code_stats (object_val, &byte_code_stats, NULL, NULL, NULL));
+  TEST_ASSERT (!jerry_byte_code_stats (number_val, &byte_code_stats, NULL, NULL, NULL));
+  TEST_ASSERT (!jerry_byte_code_stats (function_val, NULL, NULL, NULL, NULL));
+
+  jerry_value_free (number_val);
+  jerry_value_free (object_val);
+  jerry_value_free (function_val);
+  jerry_value_free (parsed_code_val);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
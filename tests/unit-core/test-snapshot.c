@@ -324,6 +324,112 @@ test_function_snapshot (void)
   jerry_cleanup ();
 } /* test_function_snapshot */
 
+static void
+test_regexp_snapshot (void)
+{
+  if (!jerry_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE) || !jerry_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC)
+      || !jerry_feature_enabled (JERRY_FEATURE_REGEXP))
+  {
+    return;
+  }
+
+  static uint32_t regexp_snapshot_buffer[SNAPSHOT_BUFFER_SIZE];
+  const jerry_char_t code_to_snapshot[] = "var s = 'xabcxabbc'.replace (/a(b+)c/g, '$1'); s + /[0-9]+/y.source";
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t parse_result = jerry_parse (code_to_snapshot, sizeof (code_to_snapshot) - 1, NULL);
+  TEST_ASSERT (!jerry_value_is_exception (parse_result));
+
+  jerry_value_t generate_result =
+    jerry_generate_snapshot (parse_result, 0, regexp_snapshot_buffer, sizeof (regexp_snapshot_buffer));
+  jerry_value_free (parse_result);
+
+  TEST_ASSERT (!jerry_value_is_exception (generate_result) && jerry_value_is_number (generate_result));
+
+  size_t snapshot_size = (size_t) jerry_value_as_number (generate_result);
+  jerry_value_free (generate_result);
+
+  jerry_cleanup ();
+
+  const uint32_t exec_flags[] = { 0, JERRY_SNAPSHOT_EXEC_COPY_DATA };
+
+  for (size_t i = 0; i < sizeof (exec_flags) / sizeof (exec_flags[0]); i++)
+  {
+    jerry_init (JERRY_INIT_EMPTY);
+
+    jerry_value_t res = jerry_exec_snapshot (regexp_snapshot_buffer, snapshot_size, 0, exec_flags[i], NULL);
+    TEST_ASSERT (!jerry_value_is_exception (res) && jerry_value_is_string (res));
+
+    char result_buffer[32];
+    jerry_size_t result_size = jerry_string_to_buffer (res, JERRY_ENCODING_UTF8, (jerry_char_t *) result_buffer, 32);
+    TEST_ASSERT (result_size == 11 && memcmp (result_buffer, "xbxbb[0-9]+", 11) == 0);
+
+    jerry_value_free (res);
+    jerry_cleanup ();
+  }
+} /* test_regexp_snapshot */
+
+static void
+test_optimized_snapshot (void)
+{
+  if (!jerry_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE) || !jerry_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC))
+  {
+    return;
+  }
+
+  static uint32_t snapshot_buffer[SNAPSHOT_BUFFER_SIZE];
+  static uint32_t optimized_snapshot_buffer[SNAPSHOT_BUFFER_SIZE];
+  const jerry_char_t code_to_snapshot[] = TEST_STRING_LITERAL ("var f = [function (x) { return x + 1 },"
+                                                               "         function (x) { return x + 1 }];"
+                                                               "var sum = 0;"
+                                                               "for (var i = 0; i < 5; i++) {"
+                                                               "  sum = f[i & 1] (sum);"
+                                                               "}"
+                                                               "f[0] !== f[1] ? sum : -1");
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t parse_result = jerry_parse (code_to_snapshot, sizeof (code_to_snapshot) - 1, NULL);
+  TEST_ASSERT (!jerry_value_is_exception (parse_result));
+
+  jerry_value_t generate_result = jerry_generate_snapshot (parse_result, 0, snapshot_buffer, SNAPSHOT_BUFFER_SIZE);
+  TEST_ASSERT (!jerry_value_is_exception (generate_result) && jerry_value_is_number (generate_result));
+
+  size_t snapshot_size = (size_t) jerry_value_as_number (generate_result);
+  jerry_value_free (generate_result);
+
+  generate_result = jerry_generate_snapshot (parse_result,
+                                             JERRY_SNAPSHOT_SAVE_OPTIMIZE_SIZE,
+                                             optimized_snapshot_buffer,
+                                             SNAPSHOT_BUFFER_SIZE);
+  jerry_value_free (parse_result);
+
+  TEST_ASSERT (!jerry_value_is_exception (generate_result) && jerry_value_is_number (generate_result));
+
+  size_t optimized_snapshot_size = (size_t) jerry_value_as_number (generate_result);
+  jerry_value_free (generate_result);
+
+  jerry_cleanup ();
+
+  /* The functions are shared unless their source code ranges are stored. */
+  TEST_ASSERT (optimized_snapshot_size <= snapshot_size);
+
+  const uint32_t exec_flags[] = { 0, JERRY_SNAPSHOT_EXEC_COPY_DATA };
+
+  for (size_t i = 0; i < sizeof (exec_flags) / sizeof (exec_flags[0]); i++)
+  {
+    jerry_init (JERRY_INIT_EMPTY);
+
+    jerry_value_t res =
+      jerry_exec_snapshot (optimized_snapshot_buffer, optimized_snapshot_size, 0, exec_flags[i], NULL);
+    TEST_ASSERT (!jerry_value_is_exception (res) && jerry_value_is_number (res));
+    TEST_ASSERT (jerry_value_as_number (res) == 5);
+
+    jerry_value_free (res);
+    jerry_cleanup ();
+  }
+} /* test_optimized_snapshot */
+
 static void
 arguments_test_exec_snapshot (uint32_t *snapshot_p, size_t snapshot_size, uint32_t exec_snapshot_flags)
 {
@@ -436,6 +542,43 @@ test_snapshot_with_user (void)
   }
 } /* test_snapshot_with_user */
 
+static void
+test_bigint_snapshot (void)
+{
+  if (jerry_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE) && jerry_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC)
+      && jerry_feature_enabled (JERRY_FEATURE_BIGINT))
+  {
+    static uint32_t snapshot_buffer[SNAPSHOT_BUFFER_SIZE];
+
+    /* The 0n literal is a direct value, which is not stored in the literal table. */
+    const jerry_char_t code_to_snapshot[] = TEST_STRING_LITERAL ("var a = [0n, 5n, -0n, 123456789012345678901234567890n];"
+                                                                 "a[0] === 0n && BigInt ('0 ') === a[2] && a[1] === 5n"
+                                                                 "&& a[3] % 10n === 0n");
+    jerry_init (JERRY_INIT_EMPTY);
+
+    jerry_value_t parse_result = jerry_parse (code_to_snapshot, sizeof (code_to_snapshot) - 1, NULL);
+    TEST_ASSERT (!jerry_value_is_exception (parse_result));
+
+    jerry_value_t generate_result = jerry_generate_snapshot (parse_result, 0, snapshot_buffer, SNAPSHOT_BUFFER_SIZE);
+    jerry_value_free (parse_result);
+
+    TEST_ASSERT (!jerry_value_is_exception (generate_result) && jerry_value_is_number (generate_result));
+
+    size_t snapshot_size = (size_t) jerry_value_as_number (generate_result);
+    jerry_value_free (generate_result);
+
+    jerry_cleanup ();
+
+    jerry_init (JERRY_INIT_EMPTY);
+
+    jerry_value_t result = jerry_exec_snapshot (snapshot_buffer, snapshot_size, 0, 0, NULL);
+    TEST_ASSERT (jerry_value_is_true (result));
+    jerry_value_free (result);
+
+    jerry_cleanup ();
+  }
+} /* test_bigint_snapshot */
+
 int
 main (void)
 {
@@ -449,9 +592,15 @@ main (void)
 
   test_function_snapshot ();
 
+  test_regexp_snapshot ();
+
+  test_optimized_snapshot ();
+
   test_function_arguments_snapshot ();
 
   test_snapshot_with_user ();
 
+  test_bigint_snapshot ();
+
   return 0;
 } /* main */
@@ -54,5 +54,35 @@ main (void)
     }
   }
 
+#if JERRY_NUMBER_TYPE_FLOAT64
+  const jerry_char_t *exact_strings[] = {
+    (const jerry_char_t *) "9007199254740993",        (const jerry_char_t *) "9007199254740995",
+    (const jerry_char_t *) "0.1",                     (const jerry_char_t *) "0.30000000000000004",
+    (const jerry_char_t *) "123.456e-5",              (const jerry_char_t *) "9999999999999999999e55",
+    (const jerry_char_t *) "1e-27",                   (const jerry_char_t *) "1e23",
+    (const jerry_char_t *) "2.2250738585072011e-308", (const jerry_char_t *) "4.9e-324",
+    (const jerry_char_t *) "1.7976931348623157e308",  (const jerry_char_t *) "-7.1e-10",
+    (const jerry_char_t *) "43248470876331970e-326",  (const jerry_char_t *) "0e312",
+    (const jerry_char_t *) "0.0001e309",              (const jerry_char_t *) "1e-400",
+  };
+
+  const ecma_number_t exact_nums[] = {
+    9007199254740992.0,      9007199254740996.0,    0.1,    0.30000000000000004,
+    123.456e-5,              9999999999999999999e55, 1e-27, 1e23,
+    2.2250738585072011e-308, 4.9e-324,              1.7976931348623157e308, -7.1e-10,
+    4.3248470876332e-310,    0.0,                   1e305,                  0.0,
+  };
+
+  for (uint32_t i = 0; i < sizeof (exact_nums) / sizeof (exact_nums[0]); i++)
+  {
+    ecma_number_t num = ecma_utf8_string_to_number (exact_strings[i], lit_zt_utf8_string_size (exact_strings[i]), 0);
+
+    if (num != exact_nums[i])
+    {
+      return 1;
+    }
+  }
+#endif /* JERRY_NUMBER_TYPE_FLOAT64 */
+
   return 0;
 } /* main */
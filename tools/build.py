@@ -140,6 +140,8 @@ def get_arguments():
                          help=devhelp('enable memory statistics (%(choices)s)'))
     coregrp.add_argument('--mem-stress-test', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable mem-stress test (%(choices)s)'))
+    coregrp.add_argument('--parser-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help=devhelp('enable parser and byte-code statistics (%(choices)s)'))
     coregrp.add_argument('--profile', metavar='FILE',
                          help='specify profile file')
     coregrp.add_argument('--promise-callback', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -221,6 +223,7 @@ def generate_build_options(arguments):
     build_options_append('JERRY_STACK_LIMIT', arguments.stack_limit)
     build_options_append('JERRY_MEM_STATS', arguments.mem_stats)
     build_options_append('JERRY_MEM_GC_BEFORE_EACH_ALLOC', arguments.mem_stress_test)
+    build_options_append('JERRY_PARSER_STATS', arguments.parser_stats)
     build_options_append('JERRY_PROFILE', arguments.profile)
     build_options_append('JERRY_PROMISE_CALLBACK', arguments.promise_callback)
     build_options_append('JERRY_REGEXP_STRICT_MODE', arguments.regexp_strict_mode)
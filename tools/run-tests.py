@@ -43,7 +43,8 @@ OPTIONS_DEBUG = ['--debug']
 OPTIONS_SNAPSHOT = ['--snapshot-save=on', '--snapshot-exec=on', '--jerry-cmdline-snapshot=on']
 OPTIONS_UNITTESTS = ['--unittests=on', '--jerry-cmdline=off', '--error-messages=on',
                      '--snapshot-save=on', '--snapshot-exec=on', '--vm-exec-stop=on',
-                     '--vm-throw=on', '--line-info=on', '--mem-stats=on', '--promise-callback=on']
+                     '--vm-throw=on', '--line-info=on', '--mem-stats=on', '--promise-callback=on',
+                     '--parser-stats=on']
 OPTIONS_DOCTESTS = ['--doctests=on', '--jerry-cmdline=off', '--error-messages=on',
                     '--snapshot-save=on', '--snapshot-exec=on', '--vm-exec-stop=on']
 OPTIONS_PROMISE_CALLBACK = ['--promise-callback=on']
@@ -76,6 +77,15 @@ JERRY_TESTS_OPTIONS = [
             + ['--external-context=on']),
 ]
 
+# Test options for the batch command of jerry-snapshot
+SNAPSHOT_BATCH_TEST_OPTIONS = [
+    Options('snapshot_batch_tests',
+            OPTIONS_COMMON + OPTIONS_SNAPSHOT + ['--external-context=on']),
+]
+
+# Number of jerry-tests compiled by the snapshot batch tests
+SNAPSHOT_BATCH_TEST_COUNT = 40
+
 # Test options for test262
 TEST262_TEST_SUITE_OPTIONS = [
     Options('test262',
@@ -104,6 +114,8 @@ JERRY_BUILDOPTIONS = [
             ['--mem-stats=on']),
     Options('buildoption_test-show_opcodes',
             ['--show-opcodes=on']),
+    Options('buildoption_test-parser_stats',
+            ['--parser-stats=on']),
     Options('buildoption_test-show_regexp_opcodes',
             ['--show-regexp-opcodes=on']),
     Options('buildoption_test-cpointer_32bit',
@@ -175,6 +187,8 @@ def get_arguments():
                         help='Run jerry-debugger tests')
     parser.add_argument('--jerry-tests', action='store_true',
                         help='Run jerry-tests')
+    parser.add_argument('--snapshot-batch-tests', action='store_true',
+                        help='Check that the output of jerry-snapshot batch does not depend on the number of jobs')
     parser.add_argument('--test262', default=False, const='default',
                         nargs='?', choices=['default', 'all', 'update'],
                         help='Run test262 - default: all tests except excludelist, ' +
@@ -257,9 +271,9 @@ def create_binary(job, options):
     BINARY_CACHE[binary_key] = (ret, build_dir_path)
     return ret, build_dir_path
 
-def get_binary_path(build_dir_path):
+def get_binary_path(build_dir_path, binary_name='jerry'):
     executable_extension = '.exe' if sys.platform == 'win32' else ''
-    return os.path.join(build_dir_path, 'local', 'bin', 'jerry' + executable_extension)
+    return os.path.join(build_dir_path, 'local', 'bin', binary_name + executable_extension)
 
 def hash_binary(bin_path):
     blocksize = 65536
@@ -376,6 +390,44 @@ def run_jerry_tests(options):
 
     return ret_build | ret_test
 
+def run_snapshot_batch_tests(options):
+    ret_build = ret_test = 0
+    for job in SNAPSHOT_BATCH_TEST_OPTIONS:
+        ret_build, build_dir_path = create_binary(job, options)
+        if ret_build:
+            print(f"\n{TERM_RED}Build failed{TERM_NORMAL}\n")
+            break
+
+        with open(settings.SNAPSHOT_TESTS_SKIPLIST, 'r', encoding='utf8') as snapshot_skip_list:
+            skip_list = [line.rstrip() for line in snapshot_skip_list]
+
+        test_files = []
+        for test_file in sorted(os.listdir(settings.JERRY_TESTS_DIR)):
+            test_path = os.path.join(settings.JERRY_TESTS_DIR, test_file)
+            if test_file.endswith('.js') and os.path.relpath(test_path, settings.PROJECT_DIR) not in skip_list:
+                test_files.append(test_path)
+
+        test_files = test_files[:SNAPSHOT_BATCH_TEST_COUNT]
+        snapshots = []
+
+        for jobs in [1, 4]:
+            snapshot_path = os.path.join(build_dir_path, f'batch-j{jobs}.snapshot')
+            test_cmd = [get_binary_path(build_dir_path, 'jerry-snapshot'), 'batch',
+                        '-j', str(jobs), '-o', snapshot_path] + test_files
+
+            ret_test |= run_check(options, test_cmd)
+            if ret_test:
+                break
+
+            with open(snapshot_path, 'rb') as snapshot_file:
+                snapshots.append(snapshot_file.read())
+
+        if not ret_test and snapshots[0] != snapshots[1]:
+            print(f"\n{TERM_RED}The snapshot depends on the number of jobs{TERM_NORMAL}\n")
+            ret_test = 1
+
+    return ret_build | ret_test
+
 def run_test262_test_suite(options):
     ret_build = ret_test = 0
 
@@ -466,6 +518,7 @@ def main(options):
         Check(options.check_strings, run_check, [settings.STRINGS_SCRIPT]),
         Check(options.jerry_debugger, run_jerry_debugger_tests, None),
         Check(options.jerry_tests, run_jerry_tests, None),
+        Check(options.snapshot_batch_tests, run_snapshot_batch_tests, None),
         Check(options.test262, run_test262_test_suite, None),
         Check(options.unittests, run_unittests, None),
         Check(options.buildoption_test, run_buildoption_test, None),